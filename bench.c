@@ -0,0 +1,77 @@
+#include <time.h>
+#include "scum.h"
+
+/* Reads all of IN into a malloc'd buffer and stores its length in LEN */
+static char*
+slurp (FILE *in, size_t *len)
+{
+    size_t cap = READ_CHUNK_LEN, n;
+    char *text = malloc (cap);
+
+    *len = 0;
+    while (text != NULL && (n = fread (text + *len, 1, cap - *len, in)) > 0)
+        if ((*len += n) == cap)
+            text = realloc (text, cap *= 2);
+    if (text == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    return text;
+}
+
+/* Times the evaluation of each scheme file given on the command line. Unlike
+ * interpret this stops cleanly at EOF so several files can run in one process.
+ * Each file is also parsed from memory over and over for a tenth of a second
+ * or so to report the reader's throughput. Built with SCUM_VM it times the
+ * bytecode VM instead of eval
+ */
+int
+main (int argc, char **argv)
+{
+    int i;
+    object *env = NULL, *data = NULL, *exp;
+
+    gc_root (&env);
+    gc_root (&data);
+#ifdef SCUM_VM
+    evaluate = vm_eval;
+#endif
+    for (i = 1; i < argc; i++)
+    {
+        FILE *in = fopen (argv[i], "r");
+        clock_t start, elapsed;
+        size_t allocs, len;
+        long reads = 0;
+        char *text;
+        if (in == NULL)
+        {
+            fprintf (stderr, "could not open %s\n", argv[i]);
+            return 1;
+        }
+        text = slurp (in, &len);
+        fclose (in);
+        make_singletons ();
+        env = make_env ();
+        start = clock ();
+        do
+        {
+            data = read_from_buffer (text, len);
+            reads++;
+        }
+        while ((elapsed = clock () - start) < CLOCKS_PER_SEC / 10);
+        allocs = gc_allocations ();
+        start = clock ();
+        for (exp = data; exp != nil; exp = cdr (exp))
+            evaluate (car (exp), env);
+        printf ("%-28s %8.3fs  %10lu allocations  (%lu live objects)"
+                "  %8.1f MB/s read\n",
+                argv[i], (double)(clock () - start) / CLOCKS_PER_SEC,
+                (unsigned long)(gc_allocations () - allocs),
+                (unsigned long)gc_heap_size (),
+                (double)len * reads / (1 << 20)
+                / ((double)elapsed / CLOCKS_PER_SEC));
+        free (text);
+    }
+    return 0;
+}
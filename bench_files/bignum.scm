@@ -0,0 +1,5 @@
+(define (fact n) (if (= n 0) 1 (* n (fact (- n 1)))))
+(define (choose n k) (quotient (fact n) (* (fact k) (fact (- n k)))))
+(define (loop i acc)
+  (if (= i 0) acc (loop (- i 1) (+ acc (choose 2000 (remainder i 1000))))))
+(loop 200 0)
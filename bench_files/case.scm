@@ -0,0 +1,9 @@
+(define ops '#(push pop add sub mul div jump call ret load store halt))
+(define (dispatch op)
+  (case op
+    ((push) 1) ((pop) 2) ((add) 3) ((sub) 4) ((mul) 5) ((div) 6)
+    ((jump) 7) ((call) 8) ((ret) 9) ((load) 10) ((store) 11) (else 0)))
+(let loop ((i 0) (sum 0))
+  (if (= i 1000000)
+      sum
+      (loop (+ i 1) (+ sum (dispatch (vector-ref ops (remainder i 12)))))))
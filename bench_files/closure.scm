@@ -0,0 +1,11 @@
+(define (make-accumulator)
+  (let ((total 0))
+    (lambda (x) (set! total (+ total x)) total)))
+(define (make-scaler a b c)
+  (lambda (x) (+ (* a x) (* b x) c)))
+(define acc (make-accumulator))
+(define scale (make-scaler 2 3 4))
+(let loop ((i 0))
+  (if (< i 500000)
+      (begin (acc (scale i)) (loop (+ i 1)))
+      (acc 0)))
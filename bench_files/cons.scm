@@ -0,0 +1,11 @@
+(define (build n acc)
+  (if (eq? n 0) acc
+    (build (- n 1) (cons n acc))))
+(define (walk lst sum)
+  (if (null? lst) sum
+    (walk (cdr lst) (+ sum (car lst)))))
+(define (repeat k)
+  (if (eq? k 0) 'done
+    (begin (walk (build 20000 '()) 0)
+           (repeat (- k 1)))))
+(repeat 40)
@@ -0,0 +1,4204 @@
+;; machine generated s-expression dump for the reader benchmark
+;; (bench-read times it with and without the vectorized scanner)
+(define dump
+  '(
+    ;; record 0, exported from table zeta
+    (record-gamma
+        (id 0)
+        (description "epsilon beta alpha sigma epsilon theta theta lambda")
+        (payload "delta epsilon kappa alpha delta sigma kappa alpha beta beta kappa theta alpha lambda omega theta")
+        (tags tag-zeta tag-alpha tag-delta tag-alpha)
+        (values 76218 47380 85234 21536 80395 27318))
+    ;; record 1, exported from table beta
+    (record-kappa
+        (id 1)
+        (description "zeta sigma zeta sigma epsilon omega zeta sigma")
+        (payload "gamma kappa sigma kappa omega omega gamma gamma gamma lambda zeta omega lambda delta sigma beta")
+        (tags tag-beta tag-beta tag-theta tag-alpha)
+        (values 73451 35119 74081 35777 76328 42360))
+    ;; record 2, exported from table epsilon
+    (record-gamma
+        (id 2)
+        (description "beta zeta epsilon lambda epsilon kappa lambda delta")
+        (payload "beta sigma beta kappa delta zeta lambda gamma sigma beta theta gamma kappa alpha alpha omega")
+        (tags tag-theta tag-theta tag-alpha tag-gamma)
+        (values 28575 89074 670 28125 96065 6455))
+    ;; record 3, exported from table alpha
+    (record-beta
+        (id 3)
+        (description "lambda kappa beta zeta alpha theta kappa delta")
+        (payload "epsilon kappa lambda delta kappa epsilon delta beta beta lambda lambda omega gamma lambda lambda delta")
+        (tags tag-epsilon tag-beta tag-theta tag-gamma)
+        (values 544 57287 98867 43929 85061 53324))
+    ;; record 4, exported from table theta
+    (record-theta
+        (id 4)
+        (description "gamma sigma theta beta omega delta lambda epsilon")
+        (payload "epsilon lambda sigma lambda alpha epsilon beta alpha omega gamma zeta lambda theta delta gamma omega")
+        (tags tag-beta tag-zeta tag-lambda tag-lambda)
+        (values 13895 29813 72512 60700 57930 93160))
+    ;; record 5, exported from table omega
+    (record-alpha
+        (id 5)
+        (description "epsilon alpha zeta theta alpha gamma theta delta")
+        (payload "gamma omega kappa theta beta theta epsilon kappa sigma lambda lambda gamma lambda lambda epsilon epsilon")
+        (tags tag-beta tag-delta tag-alpha tag-kappa)
+        (values 48460 1340 87260 58879 78309 52984))
+    ;; record 6, exported from table gamma
+    (record-theta
+        (id 6)
+        (description "epsilon omega zeta theta zeta epsilon epsilon zeta")
+        (payload "alpha theta omega kappa lambda epsilon lambda epsilon beta theta delta epsilon gamma lambda zeta beta")
+        (tags tag-sigma tag-kappa tag-beta tag-epsilon)
+        (values 73191 99884 56952 -5 3856 32984))
+    ;; record 7, exported from table epsilon
+    (record-delta
+        (id 7)
+        (description "beta delta sigma omega kappa alpha theta beta")
+        (payload "zeta sigma gamma sigma beta gamma lambda theta sigma omega zeta epsilon beta sigma omega sigma")
+        (tags tag-gamma tag-alpha tag-beta tag-gamma)
+        (values 1504 16837 79085 88518 17239 94931))
+    ;; record 8, exported from table beta
+    (record-zeta
+        (id 8)
+        (description "epsilon kappa epsilon sigma alpha alpha sigma sigma")
+        (payload "alpha gamma zeta beta gamma delta delta theta zeta sigma delta lambda sigma theta omega zeta")
+        (tags tag-lambda tag-omega tag-delta tag-lambda)
+        (values 96172 39873 58833 85468 82653 15934))
+    ;; record 9, exported from table omega
+    (record-lambda
+        (id 9)
+        (description "zeta theta epsilon alpha kappa theta zeta delta")
+        (payload "gamma delta zeta theta theta alpha alpha zeta theta kappa gamma sigma theta zeta delta zeta")
+        (tags tag-alpha tag-omega tag-epsilon tag-kappa)
+        (values 21692 51270 47149 74448 64306 1139))
+    ;; record 10, exported from table omega
+    (record-theta
+        (id 10)
+        (description "lambda sigma omega theta sigma gamma kappa delta")
+        (payload "beta kappa alpha theta omega theta epsilon alpha alpha theta theta zeta omega omega epsilon gamma")
+        (tags tag-gamma tag-sigma tag-beta tag-sigma)
+        (values 66434 59842 70107 97427 14904 7861))
+    ;; record 11, exported from table alpha
+    (record-lambda
+        (id 11)
+        (description "theta kappa omega gamma omega epsilon beta sigma")
+        (payload "sigma delta lambda omega delta zeta epsilon epsilon epsilon theta kappa lambda lambda epsilon zeta alpha")
+        (tags tag-delta tag-omega tag-sigma tag-lambda)
+        (values 19063 7300 89338 17307 86433 13731))
+    ;; record 12, exported from table omega
+    (record-alpha
+        (id 12)
+        (description "epsilon epsilon beta sigma beta beta alpha kappa")
+        (payload "lambda epsilon epsilon lambda sigma theta omega omega alpha delta omega omega beta omega gamma gamma")
+        (tags tag-delta tag-kappa tag-alpha tag-omega)
+        (values 17652 33077 -994 77654 49616 98506))
+    ;; record 13, exported from table gamma
+    (record-alpha
+        (id 13)
+        (description "alpha sigma sigma theta alpha omega alpha gamma")
+        (payload "zeta omega sigma lambda lambda theta alpha kappa beta kappa zeta epsilon omega sigma alpha gamma")
+        (tags tag-delta tag-epsilon tag-beta tag-gamma)
+        (values 19639 17328 75453 86709 13543 79443))
+    ;; record 14, exported from table sigma
+    (record-sigma
+        (id 14)
+        (description "theta lambda delta gamma lambda omega lambda omega")
+        (payload "delta beta epsilon omega sigma beta sigma gamma beta lambda theta zeta beta delta omega lambda")
+        (tags tag-theta tag-zeta tag-beta tag-delta)
+        (values 18357 47453 81697 54725 59228 27455))
+    ;; record 15, exported from table beta
+    (record-gamma
+        (id 15)
+        (description "gamma lambda lambda delta zeta alpha sigma sigma")
+        (payload "gamma beta lambda zeta omega alpha alpha kappa alpha gamma epsilon zeta delta kappa omega zeta")
+        (tags tag-epsilon tag-beta tag-theta tag-kappa)
+        (values 12687 51921 68723 86354 48512 48324))
+    ;; record 16, exported from table zeta
+    (record-gamma
+        (id 16)
+        (description "omega alpha gamma sigma omega beta alpha alpha")
+        (payload "beta omega omega omega zeta theta omega gamma theta epsilon gamma lambda epsilon lambda lambda sigma")
+        (tags tag-omega tag-sigma tag-sigma tag-sigma)
+        (values 81870 66100 51484 87490 95918 22312))
+    ;; record 17, exported from table lambda
+    (record-beta
+        (id 17)
+        (description "sigma epsilon theta zeta gamma alpha zeta epsilon")
+        (payload "kappa kappa zeta alpha theta omega beta epsilon gamma beta alpha sigma sigma delta zeta theta")
+        (tags tag-delta tag-sigma tag-beta tag-omega)
+        (values 67636 89820 33171 32559 25337 27035))
+    ;; record 18, exported from table zeta
+    (record-lambda
+        (id 18)
+        (description "omega gamma lambda gamma kappa zeta theta zeta")
+        (payload "delta sigma theta alpha theta zeta sigma beta beta alpha gamma beta gamma beta theta epsilon")
+        (tags tag-gamma tag-zeta tag-gamma tag-beta)
+        (values 86815 46629 42604 37629 73865 96993))
+    ;; record 19, exported from table lambda
+    (record-alpha
+        (id 19)
+        (description "kappa sigma delta sigma theta sigma sigma epsilon")
+        (payload "omega gamma omega alpha kappa lambda theta omega omega alpha gamma kappa alpha zeta omega kappa")
+        (tags tag-delta tag-lambda tag-gamma tag-omega)
+        (values 92669 24113 91277 3941 35770 74591))
+    ;; record 20, exported from table kappa
+    (record-lambda
+        (id 20)
+        (description "delta beta epsilon kappa sigma alpha epsilon epsilon")
+        (payload "kappa gamma sigma theta theta delta beta delta theta alpha theta beta epsilon gamma epsilon delta")
+        (tags tag-delta tag-delta tag-alpha tag-omega)
+        (values 88688 37547 66400 25380 53356 10224))
+    ;; record 21, exported from table alpha
+    (record-alpha
+        (id 21)
+        (description "gamma theta delta delta alpha lambda delta beta")
+        (payload "gamma zeta alpha sigma alpha lambda theta zeta sigma kappa omega beta delta epsilon alpha gamma")
+        (tags tag-alpha tag-beta tag-alpha tag-delta)
+        (values 13211 9993 31486 17292 10338 90045))
+    ;; record 22, exported from table lambda
+    (record-omega
+        (id 22)
+        (description "kappa lambda epsilon kappa kappa lambda alpha alpha")
+        (payload "gamma alpha zeta lambda sigma kappa alpha sigma theta delta zeta sigma sigma omega alpha zeta")
+        (tags tag-lambda tag-lambda tag-omega tag-lambda)
+        (values 22337 62863 46881 10487 25746 36539))
+    ;; record 23, exported from table delta
+    (record-omega
+        (id 23)
+        (description "zeta omega omega sigma epsilon epsilon delta theta")
+        (payload "alpha alpha beta zeta theta omega sigma theta theta delta sigma beta lambda gamma delta delta")
+        (tags tag-theta tag-beta tag-lambda tag-beta)
+        (values 57809 73382 86076 5789 61935 33945))
+    ;; record 24, exported from table lambda
+    (record-theta
+        (id 24)
+        (description "beta theta beta lambda delta alpha zeta gamma")
+        (payload "alpha lambda epsilon gamma delta zeta gamma gamma lambda gamma zeta kappa gamma theta alpha alpha")
+        (tags tag-delta tag-lambda tag-theta tag-delta)
+        (values 73811 27610 45893 18283 59219 2916))
+    ;; record 25, exported from table lambda
+    (record-kappa
+        (id 25)
+        (description "sigma lambda sigma kappa delta delta lambda kappa")
+        (payload "beta beta kappa zeta omega lambda theta zeta beta delta zeta gamma omega epsilon zeta delta")
+        (tags tag-alpha tag-zeta tag-sigma tag-omega)
+        (values 59039 37255 80416 30833 25294 10961))
+    ;; record 26, exported from table lambda
+    (record-beta
+        (id 26)
+        (description "gamma sigma alpha alpha zeta beta delta beta")
+        (payload "delta theta lambda beta zeta delta zeta sigma beta delta zeta zeta gamma sigma delta kappa")
+        (tags tag-gamma tag-epsilon tag-epsilon tag-beta)
+        (values 40287 92082 62923 30021 22757 76558))
+    ;; record 27, exported from table omega
+    (record-sigma
+        (id 27)
+        (description "theta lambda sigma epsilon lambda delta sigma gamma")
+        (payload "theta sigma theta sigma theta epsilon gamma theta alpha kappa beta sigma beta sigma beta alpha")
+        (tags tag-epsilon tag-sigma tag-gamma tag-alpha)
+        (values 55738 15702 62337 94407 43852 50019))
+    ;; record 28, exported from table delta
+    (record-theta
+        (id 28)
+        (description "epsilon omega sigma omega zeta theta epsilon zeta")
+        (payload "gamma omega theta zeta theta delta gamma beta theta gamma zeta alpha theta theta omega lambda")
+        (tags tag-beta tag-gamma tag-alpha tag-kappa)
+        (values 34797 9642 30042 73073 1835 18461))
+    ;; record 29, exported from table kappa
+    (record-epsilon
+        (id 29)
+        (description "omega sigma sigma epsilon zeta beta sigma delta")
+        (payload "beta kappa delta theta kappa kappa alpha delta omega kappa zeta kappa beta beta delta theta")
+        (tags tag-gamma tag-omega tag-beta tag-zeta)
+        (values 71101 4832 98336 92440 93819 13933))
+    ;; record 30, exported from table sigma
+    (record-zeta
+        (id 30)
+        (description "epsilon omega omega alpha lambda beta sigma delta")
+        (payload "delta kappa sigma lambda zeta zeta gamma delta zeta sigma alpha delta epsilon theta alpha kappa")
+        (tags tag-lambda tag-delta tag-gamma tag-alpha)
+        (values 84062 14738 66641 67833 57403 87624))
+    ;; record 31, exported from table omega
+    (record-omega
+        (id 31)
+        (description "lambda omega omega gamma lambda theta theta epsilon")
+        (payload "kappa beta zeta delta sigma alpha omega alpha lambda zeta beta theta lambda kappa delta delta")
+        (tags tag-gamma tag-delta tag-gamma tag-kappa)
+        (values 12567 37069 65006 33198 33809 63436))
+    ;; record 32, exported from table zeta
+    (record-zeta
+        (id 32)
+        (description "alpha beta alpha kappa epsilon kappa omega sigma")
+        (payload "sigma omega delta zeta alpha omega delta lambda theta kappa beta alpha sigma theta theta alpha")
+        (tags tag-beta tag-lambda tag-lambda tag-kappa)
+        (values 40196 23158 73281 82286 18169 92193))
+    ;; record 33, exported from table kappa
+    (record-kappa
+        (id 33)
+        (description "epsilon kappa beta alpha alpha zeta epsilon alpha")
+        (payload "zeta zeta alpha kappa alpha epsilon sigma delta lambda zeta beta alpha beta delta delta omega")
+        (tags tag-omega tag-sigma tag-delta tag-omega)
+        (values 69546 33784 51469 35075 90244 58430))
+    ;; record 34, exported from table epsilon
+    (record-zeta
+        (id 34)
+        (description "kappa alpha alpha delta beta gamma zeta sigma")
+        (payload "delta beta zeta zeta kappa alpha gamma theta sigma zeta sigma delta gamma theta epsilon gamma")
+        (tags tag-beta tag-gamma tag-theta tag-beta)
+        (values 38553 30719 55460 65504 35511 84447))
+    ;; record 35, exported from table epsilon
+    (record-alpha
+        (id 35)
+        (description "sigma alpha zeta zeta lambda theta zeta delta")
+        (payload "delta epsilon alpha lambda delta kappa gamma alpha lambda sigma kappa beta gamma gamma alpha delta")
+        (tags tag-epsilon tag-theta tag-kappa tag-zeta)
+        (values 65353 81071 74446 60609 53090 75672))
+    ;; record 36, exported from table alpha
+    (record-epsilon
+        (id 36)
+        (description "theta kappa zeta epsilon zeta lambda theta beta")
+        (payload "beta zeta epsilon zeta omega alpha zeta gamma lambda kappa kappa sigma epsilon zeta epsilon lambda")
+        (tags tag-epsilon tag-sigma tag-omega tag-lambda)
+        (values 20375 89662 11162 97589 55266 22453))
+    ;; record 37, exported from table sigma
+    (record-lambda
+        (id 37)
+        (description "gamma epsilon kappa gamma gamma zeta sigma zeta")
+        (payload "lambda omega theta theta delta lambda zeta lambda lambda gamma alpha gamma beta alpha epsilon kappa")
+        (tags tag-delta tag-gamma tag-kappa tag-kappa)
+        (values 56653 -778 68486 51373 84475 22418))
+    ;; record 38, exported from table kappa
+    (record-alpha
+        (id 38)
+        (description "omega lambda alpha gamma delta beta zeta beta")
+        (payload "alpha sigma lambda gamma sigma epsilon sigma epsilon alpha epsilon kappa theta omega omega beta sigma")
+        (tags tag-beta tag-gamma tag-beta tag-omega)
+        (values 35748 26152 99705 75486 20433 65743))
+    ;; record 39, exported from table alpha
+    (record-gamma
+        (id 39)
+        (description "zeta lambda zeta sigma omega epsilon beta zeta")
+        (payload "epsilon sigma gamma epsilon omega kappa alpha kappa delta beta zeta beta zeta kappa theta omega")
+        (tags tag-zeta tag-sigma tag-omega tag-epsilon)
+        (values 40888 42385 46686 32600 92825 29268))
+    ;; record 40, exported from table alpha
+    (record-delta
+        (id 40)
+        (description "gamma lambda delta lambda delta zeta beta theta")
+        (payload "delta beta gamma kappa sigma sigma delta lambda omega sigma theta zeta beta beta gamma zeta")
+        (tags tag-epsilon tag-omega tag-beta tag-zeta)
+        (values 20492 -834 49739 46286 49536 83296))
+    ;; record 41, exported from table omega
+    (record-gamma
+        (id 41)
+        (description "lambda alpha gamma omega theta alpha lambda gamma")
+        (payload "theta omega sigma gamma kappa delta kappa alpha beta omega theta epsilon gamma kappa theta kappa")
+        (tags tag-delta tag-theta tag-zeta tag-epsilon)
+        (values 36320 10456 79998 92898 14113 12246))
+    ;; record 42, exported from table kappa
+    (record-omega
+        (id 42)
+        (description "alpha theta gamma sigma sigma gamma lambda sigma")
+        (payload "zeta epsilon zeta sigma omega zeta delta alpha delta lambda beta beta lambda alpha gamma sigma")
+        (tags tag-epsilon tag-omega tag-lambda tag-sigma)
+        (values 58851 78882 99369 18429 18862 84811))
+    ;; record 43, exported from table delta
+    (record-delta
+        (id 43)
+        (description "gamma delta beta kappa beta beta alpha alpha")
+        (payload "omega sigma lambda alpha alpha gamma alpha zeta gamma theta gamma sigma omega omega epsilon epsilon")
+        (tags tag-delta tag-alpha tag-gamma tag-gamma)
+        (values 96963 42288 66873 35047 63696 70179))
+    ;; record 44, exported from table kappa
+    (record-lambda
+        (id 44)
+        (description "kappa theta alpha zeta delta sigma sigma kappa")
+        (payload "lambda kappa epsilon gamma kappa theta sigma omega zeta lambda gamma zeta lambda sigma epsilon alpha")
+        (tags tag-theta tag-epsilon tag-theta tag-theta)
+        (values 54202 30496 32780 2466 60425 -643))
+    ;; record 45, exported from table sigma
+    (record-zeta
+        (id 45)
+        (description "omega beta alpha alpha alpha sigma beta kappa")
+        (payload "gamma kappa zeta lambda beta epsilon kappa alpha alpha lambda lambda lambda delta beta delta beta")
+        (tags tag-alpha tag-delta tag-beta tag-alpha)
+        (values 87947 37356 57511 1065 75280 65246))
+    ;; record 46, exported from table epsilon
+    (record-beta
+        (id 46)
+        (description "kappa zeta alpha lambda epsilon gamma theta sigma")
+        (payload "lambda lambda beta beta alpha beta sigma lambda lambda gamma theta sigma zeta epsilon kappa sigma")
+        (tags tag-lambda tag-sigma tag-theta tag-kappa)
+        (values 81271 45232 11987 34696 20941 27662))
+    ;; record 47, exported from table delta
+    (record-beta
+        (id 47)
+        (description "sigma kappa kappa lambda omega alpha gamma gamma")
+        (payload "delta omega gamma theta gamma zeta lambda kappa epsilon kappa lambda theta omega delta epsilon lambda")
+        (tags tag-kappa tag-alpha tag-zeta tag-epsilon)
+        (values 49581 24252 94395 31628 15818 42236))
+    ;; record 48, exported from table omega
+    (record-theta
+        (id 48)
+        (description "zeta theta alpha omega kappa kappa zeta theta")
+        (payload "lambda lambda alpha sigma kappa zeta sigma theta theta kappa lambda sigma theta sigma kappa zeta")
+        (tags tag-sigma tag-kappa tag-kappa tag-lambda)
+        (values 57673 48991 59204 41098 36977 7502))
+    ;; record 49, exported from table gamma
+    (record-theta
+        (id 49)
+        (description "kappa beta kappa gamma omega beta gamma zeta")
+        (payload "beta kappa omega sigma gamma beta sigma alpha omega omega zeta epsilon omega lambda gamma gamma")
+        (tags tag-lambda tag-sigma tag-zeta tag-kappa)
+        (values 76405 2683 90354 11282 55130 11509))
+    ;; record 50, exported from table beta
+    (record-theta
+        (id 50)
+        (description "alpha alpha theta delta epsilon lambda epsilon kappa")
+        (payload "lambda kappa lambda delta delta delta zeta theta kappa lambda alpha gamma sigma beta beta alpha")
+        (tags tag-lambda tag-epsilon tag-alpha tag-zeta)
+        (values 23238 31874 59046 32311 98605 94467))
+    ;; record 51, exported from table kappa
+    (record-theta
+        (id 51)
+        (description "delta beta theta zeta lambda lambda epsilon alpha")
+        (payload "theta delta alpha delta zeta zeta alpha epsilon alpha theta kappa sigma epsilon delta epsilon alpha")
+        (tags tag-alpha tag-sigma tag-omega tag-gamma)
+        (values 69768 52160 10027 71304 11432 74497))
+    ;; record 52, exported from table alpha
+    (record-alpha
+        (id 52)
+        (description "lambda omega epsilon epsilon sigma omega gamma lambda")
+        (payload "sigma epsilon delta epsilon epsilon alpha gamma zeta gamma zeta delta kappa epsilon theta zeta zeta")
+        (tags tag-theta tag-lambda tag-alpha tag-theta)
+        (values 17655 85386 80109 79336 26830 46113))
+    ;; record 53, exported from table lambda
+    (record-zeta
+        (id 53)
+        (description "zeta theta epsilon kappa delta gamma sigma delta")
+        (payload "beta gamma kappa epsilon kappa omega epsilon beta omega alpha lambda delta lambda lambda epsilon kappa")
+        (tags tag-theta tag-beta tag-omega tag-omega)
+        (values 30629 23444 99345 46278 37068 73824))
+    ;; record 54, exported from table epsilon
+    (record-gamma
+        (id 54)
+        (description "zeta gamma sigma kappa theta gamma beta alpha")
+        (payload "beta theta beta sigma delta alpha theta gamma alpha theta beta beta kappa zeta omega delta")
+        (tags tag-lambda tag-omega tag-beta tag-kappa)
+        (values 53260 85091 3495 26290 21048 75286))
+    ;; record 55, exported from table delta
+    (record-gamma
+        (id 55)
+        (description "theta lambda omega zeta sigma beta sigma epsilon")
+        (payload "theta epsilon delta theta lambda theta zeta sigma zeta sigma zeta kappa lambda lambda alpha kappa")
+        (tags tag-kappa tag-delta tag-sigma tag-epsilon)
+        (values 53737 20366 47924 9260 37836 85231))
+    ;; record 56, exported from table theta
+    (record-sigma
+        (id 56)
+        (description "omega beta alpha lambda zeta zeta zeta beta")
+        (payload "zeta omega omega theta beta omega lambda kappa kappa gamma omega beta delta lambda sigma epsilon")
+        (tags tag-beta tag-gamma tag-omega tag-alpha)
+        (values 34432 75855 47349 39241 32988 43966))
+    ;; record 57, exported from table zeta
+    (record-beta
+        (id 57)
+        (description "lambda alpha gamma beta gamma omega alpha kappa")
+        (payload "zeta alpha epsilon omega sigma gamma epsilon sigma kappa alpha gamma delta gamma lambda lambda alpha")
+        (tags tag-lambda tag-sigma tag-zeta tag-zeta)
+        (values 13920 77445 71960 44157 65061 15494))
+    ;; record 58, exported from table epsilon
+    (record-beta
+        (id 58)
+        (description "kappa epsilon gamma gamma sigma gamma gamma omega")
+        (payload "delta alpha kappa zeta epsilon theta kappa lambda kappa zeta alpha zeta epsilon gamma epsilon theta")
+        (tags tag-epsilon tag-theta tag-epsilon tag-theta)
+        (values 85538 44794 68100 17048 72272 71358))
+    ;; record 59, exported from table omega
+    (record-delta
+        (id 59)
+        (description "sigma alpha epsilon kappa lambda lambda omega alpha")
+        (payload "kappa gamma theta lambda sigma theta gamma zeta delta alpha lambda omega kappa epsilon omega kappa")
+        (tags tag-alpha tag-delta tag-omega tag-theta)
+        (values 75040 46669 80144 46444 23879 43664))
+    ;; record 60, exported from table theta
+    (record-epsilon
+        (id 60)
+        (description "theta gamma gamma sigma alpha gamma kappa gamma")
+        (payload "delta sigma omega theta kappa zeta alpha sigma beta delta sigma omega gamma theta theta sigma")
+        (tags tag-sigma tag-gamma tag-gamma tag-kappa)
+        (values 12983 14295 48710 78739 25674 54580))
+    ;; record 61, exported from table lambda
+    (record-omega
+        (id 61)
+        (description "kappa sigma gamma omega zeta gamma delta lambda")
+        (payload "gamma alpha beta delta zeta alpha beta kappa lambda sigma lambda omega beta sigma kappa lambda")
+        (tags tag-kappa tag-delta tag-epsilon tag-delta)
+        (values 1297 37778 54568 88511 58882 13231))
+    ;; record 62, exported from table sigma
+    (record-kappa
+        (id 62)
+        (description "kappa theta theta sigma alpha kappa alpha zeta")
+        (payload "theta alpha omega alpha omega alpha lambda lambda zeta theta kappa zeta zeta gamma kappa gamma")
+        (tags tag-epsilon tag-sigma tag-zeta tag-zeta)
+        (values 61862 14288 19375 8828 26886 39271))
+    ;; record 63, exported from table lambda
+    (record-delta
+        (id 63)
+        (description "delta kappa alpha alpha delta beta sigma kappa")
+        (payload "gamma zeta sigma epsilon omega lambda theta beta omega omega theta alpha kappa zeta theta lambda")
+        (tags tag-gamma tag-omega tag-delta tag-beta)
+        (values 61961 82496 9459 36087 34273 74036))
+    ;; record 64, exported from table sigma
+    (record-theta
+        (id 64)
+        (description "gamma sigma zeta beta sigma theta gamma alpha")
+        (payload "theta omega beta alpha theta delta epsilon epsilon sigma sigma beta zeta gamma sigma alpha gamma")
+        (tags tag-omega tag-theta tag-omega tag-zeta)
+        (values 14874 56998 -596 72791 63880 6956))
+    ;; record 65, exported from table lambda
+    (record-gamma
+        (id 65)
+        (description "theta sigma epsilon zeta beta kappa zeta zeta")
+        (payload "theta lambda beta delta zeta lambda lambda omega gamma delta sigma epsilon omega gamma zeta zeta")
+        (tags tag-lambda tag-theta tag-sigma tag-sigma)
+        (values 47960 75968 52635 36240 76751 47647))
+    ;; record 66, exported from table theta
+    (record-epsilon
+        (id 66)
+        (description "alpha theta gamma lambda delta lambda omega zeta")
+        (payload "zeta zeta sigma epsilon epsilon theta kappa kappa kappa omega delta omega omega sigma gamma beta")
+        (tags tag-theta tag-alpha tag-alpha tag-sigma)
+        (values 80264 72598 74594 4038 20174 17859))
+    ;; record 67, exported from table lambda
+    (record-zeta
+        (id 67)
+        (description "gamma delta omega epsilon zeta lambda zeta zeta")
+        (payload "omega sigma sigma zeta zeta epsilon epsilon lambda theta beta alpha zeta gamma omega zeta theta")
+        (tags tag-sigma tag-gamma tag-gamma tag-omega)
+        (values 8966 5374 34580 66633 94505 14255))
+    ;; record 68, exported from table delta
+    (record-gamma
+        (id 68)
+        (description "epsilon zeta lambda lambda alpha delta gamma zeta")
+        (payload "epsilon theta alpha sigma kappa zeta alpha gamma kappa sigma omega alpha zeta gamma kappa epsilon")
+        (tags tag-alpha tag-gamma tag-theta tag-beta)
+        (values 85428 36083 47722 18518 1302 86992))
+    ;; record 69, exported from table gamma
+    (record-lambda
+        (id 69)
+        (description "epsilon epsilon lambda epsilon lambda omega delta gamma")
+        (payload "delta epsilon zeta beta sigma beta gamma gamma epsilon lambda theta gamma omega sigma kappa lambda")
+        (tags tag-zeta tag-kappa tag-delta tag-zeta)
+        (values 97536 40372 80283 56932 43017 14769))
+    ;; record 70, exported from table zeta
+    (record-delta
+        (id 70)
+        (description "delta omega alpha beta omega omega kappa epsilon")
+        (payload "beta omega omega omega sigma beta theta theta lambda kappa alpha theta zeta theta beta zeta")
+        (tags tag-lambda tag-lambda tag-omega tag-alpha)
+        (values 30857 64992 41014 5436 64079 42681))
+    ;; record 71, exported from table epsilon
+    (record-gamma
+        (id 71)
+        (description "alpha kappa theta lambda omega omega lambda zeta")
+        (payload "gamma theta alpha theta alpha delta gamma sigma zeta epsilon zeta omega omega omega gamma theta")
+        (tags tag-omega tag-omega tag-beta tag-kappa)
+        (values 2549 7271 77810 54362 87204 3424))
+    ;; record 72, exported from table beta
+    (record-gamma
+        (id 72)
+        (description "alpha omega omega theta lambda lambda kappa beta")
+        (payload "omega delta zeta theta epsilon sigma sigma kappa zeta gamma theta kappa beta alpha alpha alpha")
+        (tags tag-gamma tag-kappa tag-lambda tag-gamma)
+        (values 21807 69708 41679 14796 66923 13955))
+    ;; record 73, exported from table lambda
+    (record-omega
+        (id 73)
+        (description "zeta beta epsilon epsilon lambda zeta kappa lambda")
+        (payload "kappa zeta zeta beta kappa epsilon zeta beta kappa omega kappa theta delta gamma theta kappa")
+        (tags tag-lambda tag-theta tag-alpha tag-omega)
+        (values 49302 86973 59834 85485 37861 56755))
+    ;; record 74, exported from table sigma
+    (record-beta
+        (id 74)
+        (description "kappa kappa gamma delta epsilon sigma kappa alpha")
+        (payload "beta zeta alpha zeta theta gamma beta kappa gamma delta beta sigma delta kappa zeta delta")
+        (tags tag-sigma tag-epsilon tag-beta tag-delta)
+        (values 97932 58624 93268 78063 47934 30841))
+    ;; record 75, exported from table epsilon
+    (record-theta
+        (id 75)
+        (description "gamma alpha zeta alpha kappa alpha beta theta")
+        (payload "sigma sigma zeta lambda beta gamma epsilon gamma omega omega theta beta beta kappa omega beta")
+        (tags tag-gamma tag-omega tag-sigma tag-theta)
+        (values 17744 86249 40328 79266 25737 11610))
+    ;; record 76, exported from table delta
+    (record-zeta
+        (id 76)
+        (description "alpha zeta beta omega theta beta omega lambda")
+        (payload "epsilon beta omega alpha alpha omega omega sigma omega beta alpha kappa sigma beta alpha sigma")
+        (tags tag-zeta tag-beta tag-sigma tag-lambda)
+        (values 3028 53631 16930 80891 73028 49533))
+    ;; record 77, exported from table lambda
+    (record-gamma
+        (id 77)
+        (description "gamma kappa theta delta lambda zeta omega gamma")
+        (payload "delta alpha alpha delta lambda gamma delta epsilon alpha sigma theta sigma kappa kappa beta delta")
+        (tags tag-omega tag-theta tag-epsilon tag-gamma)
+        (values 37308 31841 96023 15305 19298 66862))
+    ;; record 78, exported from table omega
+    (record-epsilon
+        (id 78)
+        (description "theta beta beta gamma gamma kappa alpha alpha")
+        (payload "gamma kappa lambda kappa sigma theta omega alpha sigma omega alpha epsilon zeta theta sigma delta")
+        (tags tag-lambda tag-alpha tag-sigma tag-omega)
+        (values 671 57471 77994 30333 18530 72842))
+    ;; record 79, exported from table delta
+    (record-delta
+        (id 79)
+        (description "sigma beta epsilon omega beta omega delta theta")
+        (payload "gamma lambda alpha sigma zeta alpha lambda theta epsilon sigma sigma alpha beta theta beta alpha")
+        (tags tag-alpha tag-omega tag-lambda tag-epsilon)
+        (values 93709 50971 50817 62790 61071 11597))
+    ;; record 80, exported from table delta
+    (record-beta
+        (id 80)
+        (description "beta alpha beta beta gamma theta alpha omega")
+        (payload "epsilon zeta delta kappa gamma zeta gamma epsilon alpha sigma alpha delta omega omega gamma beta")
+        (tags tag-zeta tag-theta tag-delta tag-delta)
+        (values 15507 84435 99038 70455 9134 8277))
+    ;; record 81, exported from table gamma
+    (record-gamma
+        (id 81)
+        (description "sigma omega alpha zeta lambda beta sigma omega")
+        (payload "sigma beta gamma zeta alpha beta kappa theta sigma gamma lambda gamma beta epsilon alpha alpha")
+        (tags tag-zeta tag-sigma tag-lambda tag-gamma)
+        (values 74429 52626 60423 97973 13346 34436))
+    ;; record 82, exported from table omega
+    (record-theta
+        (id 82)
+        (description "kappa theta zeta kappa alpha kappa lambda epsilon")
+        (payload "alpha omega gamma theta gamma alpha beta alpha beta theta delta epsilon epsilon delta alpha gamma")
+        (tags tag-beta tag-alpha tag-delta tag-alpha)
+        (values 61679 15514 57034 71817 73127 65594))
+    ;; record 83, exported from table alpha
+    (record-sigma
+        (id 83)
+        (description "sigma gamma omega delta epsilon alpha kappa delta")
+        (payload "zeta kappa alpha omega delta zeta epsilon beta lambda kappa epsilon lambda zeta omega theta delta")
+        (tags tag-gamma tag-sigma tag-omega tag-delta)
+        (values 93371 27176 58054 61762 49423 53714))
+    ;; record 84, exported from table epsilon
+    (record-theta
+        (id 84)
+        (description "omega theta kappa delta beta kappa omega beta")
+        (payload "sigma gamma omega epsilon beta alpha lambda lambda delta zeta epsilon zeta theta beta beta delta")
+        (tags tag-kappa tag-sigma tag-epsilon tag-lambda)
+        (values 7647 66580 4756 45603 10195 3020))
+    ;; record 85, exported from table gamma
+    (record-alpha
+        (id 85)
+        (description "delta gamma kappa delta epsilon gamma kappa theta")
+        (payload "delta kappa zeta theta sigma zeta delta omega zeta omega beta lambda epsilon delta theta kappa")
+        (tags tag-zeta tag-lambda tag-beta tag-delta)
+        (values 83778 26689 58104 62575 68093 82121))
+    ;; record 86, exported from table gamma
+    (record-kappa
+        (id 86)
+        (description "kappa theta theta zeta omega epsilon zeta gamma")
+        (payload "gamma alpha theta kappa lambda sigma omega alpha zeta delta delta lambda beta sigma sigma zeta")
+        (tags tag-epsilon tag-epsilon tag-epsilon tag-zeta)
+        (values 80253 99865 25880 1561 26050 79990))
+    ;; record 87, exported from table beta
+    (record-delta
+        (id 87)
+        (description "zeta kappa delta sigma delta zeta kappa kappa")
+        (payload "omega sigma omega kappa sigma epsilon kappa sigma beta gamma gamma gamma lambda delta lambda alpha")
+        (tags tag-delta tag-epsilon tag-beta tag-epsilon)
+        (values 47529 54604 39712 31131 40193 37723))
+    ;; record 88, exported from table sigma
+    (record-beta
+        (id 88)
+        (description "delta omega theta theta kappa delta alpha gamma")
+        (payload "kappa gamma alpha delta lambda kappa alpha omega delta kappa theta omega kappa beta beta lambda")
+        (tags tag-alpha tag-kappa tag-lambda tag-sigma)
+        (values 77921 89060 37240 49006 18894 84847))
+    ;; record 89, exported from table zeta
+    (record-zeta
+        (id 89)
+        (description "sigma lambda epsilon lambda theta beta theta gamma")
+        (payload "theta omega beta delta kappa sigma epsilon epsilon gamma theta alpha delta kappa omega delta gamma")
+        (tags tag-epsilon tag-lambda tag-delta tag-beta)
+        (values 37875 -178 52693 38066 36517 72210))
+    ;; record 90, exported from table sigma
+    (record-sigma
+        (id 90)
+        (description "beta alpha beta theta kappa omega epsilon omega")
+        (payload "gamma zeta lambda sigma zeta alpha sigma delta delta gamma sigma kappa gamma lambda kappa epsilon")
+        (tags tag-beta tag-lambda tag-beta tag-kappa)
+        (values 46635 90876 33156 66713 52084 50231))
+    ;; record 91, exported from table beta
+    (record-gamma
+        (id 91)
+        (description "kappa epsilon theta alpha lambda kappa delta omega")
+        (payload "epsilon gamma beta beta delta alpha delta delta alpha sigma alpha delta sigma zeta delta sigma")
+        (tags tag-delta tag-epsilon tag-theta tag-gamma)
+        (values 81912 55540 85971 -602 70911 15762))
+    ;; record 92, exported from table alpha
+    (record-kappa
+        (id 92)
+        (description "epsilon epsilon theta gamma kappa beta kappa kappa")
+        (payload "lambda delta epsilon beta kappa omega beta theta alpha delta delta omega alpha beta delta delta")
+        (tags tag-delta tag-beta tag-lambda tag-theta)
+        (values 97696 79391 37626 66655 25176 24066))
+    ;; record 93, exported from table delta
+    (record-zeta
+        (id 93)
+        (description "beta lambda omega kappa gamma gamma theta sigma")
+        (payload "sigma omega kappa alpha beta kappa sigma lambda epsilon alpha theta beta epsilon alpha theta lambda")
+        (tags tag-kappa tag-beta tag-beta tag-beta)
+        (values 74329 27093 86971 43081 83382 94622))
+    ;; record 94, exported from table zeta
+    (record-delta
+        (id 94)
+        (description "alpha zeta zeta kappa omega beta beta epsilon")
+        (payload "omega sigma lambda epsilon beta zeta delta lambda kappa theta gamma sigma kappa omega delta epsilon")
+        (tags tag-gamma tag-omega tag-zeta tag-omega)
+        (values 33232 98341 8080 53604 26206 62081))
+    ;; record 95, exported from table delta
+    (record-omega
+        (id 95)
+        (description "lambda kappa lambda sigma delta delta lambda lambda")
+        (payload "zeta lambda omega sigma omega theta gamma beta beta zeta delta gamma theta theta epsilon sigma")
+        (tags tag-omega tag-alpha tag-epsilon tag-kappa)
+        (values 42502 40863 47688 82545 60069 55016))
+    ;; record 96, exported from table sigma
+    (record-gamma
+        (id 96)
+        (description "alpha delta beta alpha alpha delta delta kappa")
+        (payload "sigma omega gamma alpha sigma epsilon lambda beta sigma kappa omega sigma zeta alpha zeta omega")
+        (tags tag-beta tag-lambda tag-omega tag-alpha)
+        (values 37450 22282 37442 19815 9987 27472))
+    ;; record 97, exported from table gamma
+    (record-delta
+        (id 97)
+        (description "lambda theta beta lambda lambda delta zeta alpha")
+        (payload "gamma zeta omega epsilon kappa zeta omega lambda omega delta gamma theta sigma gamma zeta gamma")
+        (tags tag-beta tag-delta tag-kappa tag-kappa)
+        (values 79226 26215 6156 75096 91260 48141))
+    ;; record 98, exported from table epsilon
+    (record-beta
+        (id 98)
+        (description "theta sigma lambda omega beta lambda sigma kappa")
+        (payload "theta gamma omega omega alpha delta kappa zeta lambda lambda beta sigma beta beta gamma epsilon")
+        (tags tag-zeta tag-gamma tag-sigma tag-zeta)
+        (values 79998 63237 5804 31251 21288 75003))
+    ;; record 99, exported from table beta
+    (record-epsilon
+        (id 99)
+        (description "alpha zeta kappa gamma theta zeta beta epsilon")
+        (payload "delta theta theta beta gamma lambda beta omega zeta delta theta epsilon epsilon beta alpha beta")
+        (tags tag-theta tag-gamma tag-beta tag-epsilon)
+        (values 16262 29443 58296 59462 32607 91805))
+    ;; record 100, exported from table beta
+    (record-lambda
+        (id 100)
+        (description "theta gamma lambda lambda delta lambda lambda theta")
+        (payload "theta lambda beta zeta zeta theta theta omega alpha zeta omega theta beta alpha lambda beta")
+        (tags tag-alpha tag-alpha tag-alpha tag-zeta)
+        (values 28964 39611 84286 79670 5665 83617))
+    ;; record 101, exported from table beta
+    (record-delta
+        (id 101)
+        (description "epsilon gamma beta lambda alpha lambda lambda beta")
+        (payload "alpha delta delta delta delta theta beta lambda zeta lambda alpha delta omega kappa epsilon zeta")
+        (tags tag-theta tag-kappa tag-delta tag-epsilon)
+        (values 77504 70664 78255 80613 58582 6448))
+    ;; record 102, exported from table beta
+    (record-theta
+        (id 102)
+        (description "gamma sigma beta kappa zeta theta sigma kappa")
+        (payload "alpha sigma omega alpha kappa kappa beta kappa sigma zeta alpha alpha beta kappa omega epsilon")
+        (tags tag-epsilon tag-beta tag-kappa tag-omega)
+        (values 25499 27839 97570 68706 41282 55572))
+    ;; record 103, exported from table delta
+    (record-kappa
+        (id 103)
+        (description "beta beta omega sigma beta omega lambda kappa")
+        (payload "lambda lambda sigma omega alpha alpha sigma gamma gamma zeta gamma lambda alpha theta sigma gamma")
+        (tags tag-theta tag-epsilon tag-theta tag-alpha)
+        (values 89120 96833 45974 18010 43641 64155))
+    ;; record 104, exported from table beta
+    (record-gamma
+        (id 104)
+        (description "omega theta beta gamma lambda gamma sigma zeta")
+        (payload "theta lambda kappa alpha epsilon zeta omega kappa beta delta theta epsilon lambda kappa gamma alpha")
+        (tags tag-epsilon tag-gamma tag-omega tag-omega)
+        (values 71710 76741 68705 4887 97416 63384))
+    ;; record 105, exported from table theta
+    (record-beta
+        (id 105)
+        (description "kappa sigma theta alpha alpha lambda lambda theta")
+        (payload "epsilon zeta beta delta epsilon gamma zeta theta zeta sigma epsilon omega beta omega zeta zeta")
+        (tags tag-theta tag-alpha tag-zeta tag-gamma)
+        (values 74889 45857 50560 -766 57717 31811))
+    ;; record 106, exported from table beta
+    (record-zeta
+        (id 106)
+        (description "beta epsilon omega theta alpha lambda kappa epsilon")
+        (payload "kappa zeta lambda epsilon theta lambda beta lambda theta delta lambda epsilon beta kappa gamma delta")
+        (tags tag-kappa tag-sigma tag-epsilon tag-delta)
+        (values 97006 23461 17533 76690 7986 87746))
+    ;; record 107, exported from table gamma
+    (record-epsilon
+        (id 107)
+        (description "delta sigma epsilon epsilon epsilon beta gamma lambda")
+        (payload "delta sigma zeta sigma omega zeta delta zeta beta omega beta epsilon epsilon lambda alpha delta")
+        (tags tag-epsilon tag-omega tag-gamma tag-omega)
+        (values 18415 92717 70197 15905 20220 50294))
+    ;; record 108, exported from table sigma
+    (record-omega
+        (id 108)
+        (description "lambda delta omega zeta delta alpha zeta sigma")
+        (payload "gamma kappa delta theta lambda kappa theta theta alpha lambda kappa alpha kappa kappa delta zeta")
+        (tags tag-sigma tag-theta tag-delta tag-delta)
+        (values 29178 55663 97811 44080 33077 21964))
+    ;; record 109, exported from table theta
+    (record-beta
+        (id 109)
+        (description "lambda sigma epsilon kappa epsilon beta lambda zeta")
+        (payload "sigma theta delta lambda zeta zeta alpha omega beta kappa lambda theta sigma theta sigma gamma")
+        (tags tag-delta tag-zeta tag-epsilon tag-omega)
+        (values 95287 69058 3220 58205 64250 70548))
+    ;; record 110, exported from table sigma
+    (record-zeta
+        (id 110)
+        (description "theta beta omega gamma epsilon sigma alpha epsilon")
+        (payload "beta beta alpha alpha beta sigma zeta beta zeta lambda sigma delta delta delta omega omega")
+        (tags tag-theta tag-omega tag-zeta tag-epsilon)
+        (values 7694 90034 65439 70708 66376 8293))
+    ;; record 111, exported from table kappa
+    (record-epsilon
+        (id 111)
+        (description "lambda zeta omega gamma kappa delta epsilon lambda")
+        (payload "alpha sigma epsilon omega kappa beta theta delta omega gamma zeta delta gamma delta theta zeta")
+        (tags tag-theta tag-lambda tag-delta tag-theta)
+        (values 60594 23166 20048 93381 25814 12745))
+    ;; record 112, exported from table gamma
+    (record-gamma
+        (id 112)
+        (description "lambda epsilon epsilon lambda delta epsilon beta alpha")
+        (payload "sigma beta sigma delta sigma epsilon epsilon epsilon gamma delta omega gamma epsilon theta lambda zeta")
+        (tags tag-delta tag-beta tag-omega tag-theta)
+        (values 15868 98501 86170 30331 15063 52054))
+    ;; record 113, exported from table zeta
+    (record-gamma
+        (id 113)
+        (description "omega delta theta theta alpha zeta gamma delta")
+        (payload "sigma alpha omega alpha theta omega epsilon alpha beta delta beta beta alpha alpha beta gamma")
+        (tags tag-omega tag-omega tag-omega tag-beta)
+        (values 44129 98609 34897 5186 94950 64492))
+    ;; record 114, exported from table kappa
+    (record-theta
+        (id 114)
+        (description "alpha delta omega beta omega beta beta lambda")
+        (payload "sigma gamma lambda zeta delta sigma delta gamma lambda beta alpha theta alpha delta theta epsilon")
+        (tags tag-alpha tag-lambda tag-kappa tag-kappa)
+        (values 23042 87606 93701 74175 72337 37366))
+    ;; record 115, exported from table gamma
+    (record-alpha
+        (id 115)
+        (description "gamma omega zeta gamma delta gamma omega kappa")
+        (payload "zeta gamma gamma lambda gamma alpha omega zeta epsilon sigma kappa alpha lambda beta lambda omega")
+        (tags tag-kappa tag-delta tag-kappa tag-epsilon)
+        (values 95609 99000 68412 1318 63836 6617))
+    ;; record 116, exported from table gamma
+    (record-beta
+        (id 116)
+        (description "omega beta lambda kappa epsilon kappa kappa epsilon")
+        (payload "zeta gamma omega kappa omega gamma lambda beta omega kappa zeta omega beta beta theta delta")
+        (tags tag-beta tag-theta tag-beta tag-zeta)
+        (values 43779 22997 68036 61560 30020 741))
+    ;; record 117, exported from table epsilon
+    (record-lambda
+        (id 117)
+        (description "lambda alpha lambda epsilon sigma alpha lambda kappa")
+        (payload "beta sigma gamma sigma kappa alpha beta alpha delta beta omega delta lambda sigma sigma alpha")
+        (tags tag-zeta tag-beta tag-epsilon tag-delta)
+        (values 55044 40555 25043 8949 50160 31935))
+    ;; record 118, exported from table beta
+    (record-lambda
+        (id 118)
+        (description "alpha sigma gamma omega omega lambda theta zeta")
+        (payload "theta delta kappa epsilon sigma gamma sigma delta gamma beta sigma sigma alpha alpha theta theta")
+        (tags tag-delta tag-beta tag-beta tag-omega)
+        (values 2806 83329 53031 48788 5119 81460))
+    ;; record 119, exported from table omega
+    (record-zeta
+        (id 119)
+        (description "kappa omega alpha omega beta zeta epsilon epsilon")
+        (payload "beta omega theta beta kappa beta zeta gamma theta zeta alpha gamma theta sigma omega theta")
+        (tags tag-epsilon tag-sigma tag-omega tag-sigma)
+        (values 58938 2166 63212 19201 14468 50078))
+    ;; record 120, exported from table omega
+    (record-epsilon
+        (id 120)
+        (description "theta theta epsilon kappa zeta theta beta zeta")
+        (payload "theta zeta theta alpha epsilon lambda omega delta zeta alpha beta epsilon kappa lambda zeta beta")
+        (tags tag-beta tag-alpha tag-sigma tag-omega)
+        (values 7228 631 12648 81189 23979 74987))
+    ;; record 121, exported from table omega
+    (record-sigma
+        (id 121)
+        (description "beta sigma omega delta kappa lambda theta zeta")
+        (payload "epsilon omega beta omega lambda zeta zeta gamma gamma kappa alpha delta beta sigma gamma zeta")
+        (tags tag-kappa tag-beta tag-lambda tag-kappa)
+        (values 92654 1001 64170 9101 33860 41847))
+    ;; record 122, exported from table zeta
+    (record-theta
+        (id 122)
+        (description "delta sigma alpha theta kappa lambda zeta alpha")
+        (payload "zeta delta omega omega omega gamma kappa gamma beta sigma gamma beta theta zeta beta sigma")
+        (tags tag-kappa tag-gamma tag-sigma tag-theta)
+        (values 96140 95586 92549 50065 61754 81958))
+    ;; record 123, exported from table zeta
+    (record-sigma
+        (id 123)
+        (description "epsilon delta omega lambda kappa kappa theta theta")
+        (payload "gamma gamma theta alpha alpha kappa gamma alpha omega omega beta gamma alpha omega omega zeta")
+        (tags tag-lambda tag-beta tag-kappa tag-beta)
+        (values 20639 97770 7956 45756 70847 80417))
+    ;; record 124, exported from table sigma
+    (record-lambda
+        (id 124)
+        (description "omega theta zeta kappa zeta kappa gamma kappa")
+        (payload "lambda epsilon omega omega sigma delta epsilon gamma sigma kappa alpha beta theta alpha theta beta")
+        (tags tag-alpha tag-gamma tag-lambda tag-sigma)
+        (values 14470 23814 63124 94553 26257 63217))
+    ;; record 125, exported from table beta
+    (record-gamma
+        (id 125)
+        (description "beta theta sigma kappa sigma omega zeta omega")
+        (payload "beta epsilon delta kappa omega theta lambda sigma gamma gamma delta lambda sigma omega sigma beta")
+        (tags tag-beta tag-epsilon tag-theta tag-delta)
+        (values 97145 40373 30617 79038 55617 80551))
+    ;; record 126, exported from table alpha
+    (record-gamma
+        (id 126)
+        (description "sigma omega gamma beta theta epsilon lambda delta")
+        (payload "gamma lambda gamma alpha sigma theta gamma delta zeta lambda theta omega lambda epsilon omega theta")
+        (tags tag-lambda tag-kappa tag-delta tag-zeta)
+        (values 6103 9342 47443 41556 45440 24348))
+    ;; record 127, exported from table gamma
+    (record-alpha
+        (id 127)
+        (description "gamma zeta delta sigma epsilon theta theta omega")
+        (payload "sigma beta epsilon gamma beta lambda sigma kappa lambda delta epsilon theta sigma delta gamma alpha")
+        (tags tag-epsilon tag-sigma tag-alpha tag-lambda)
+        (values 32851 12138 89611 62221 67181 25))
+    ;; record 128, exported from table epsilon
+    (record-omega
+        (id 128)
+        (description "alpha delta beta theta gamma beta epsilon zeta")
+        (payload "epsilon sigma lambda beta lambda gamma lambda epsilon kappa lambda gamma zeta theta zeta alpha gamma")
+        (tags tag-delta tag-omega tag-kappa tag-zeta)
+        (values 89909 6904 97444 98904 19888 57382))
+    ;; record 129, exported from table kappa
+    (record-gamma
+        (id 129)
+        (description "kappa kappa omega theta beta sigma zeta omega")
+        (payload "alpha epsilon theta zeta beta lambda kappa beta theta sigma beta gamma theta epsilon omega sigma")
+        (tags tag-sigma tag-lambda tag-gamma tag-zeta)
+        (values 69202 25041 22907 54231 7019 96763))
+    ;; record 130, exported from table beta
+    (record-omega
+        (id 130)
+        (description "beta kappa beta alpha alpha alpha kappa omega")
+        (payload "sigma omega beta sigma delta omega sigma sigma delta beta kappa epsilon kappa alpha epsilon epsilon")
+        (tags tag-epsilon tag-zeta tag-beta tag-beta)
+        (values 72963 50753 3054 57250 91901 67722))
+    ;; record 131, exported from table lambda
+    (record-gamma
+        (id 131)
+        (description "lambda kappa theta alpha theta epsilon epsilon sigma")
+        (payload "lambda beta alpha omega alpha beta kappa beta zeta epsilon theta alpha omega lambda beta alpha")
+        (tags tag-zeta tag-epsilon tag-zeta tag-lambda)
+        (values 65695 96892 87305 35853 67130 79182))
+    ;; record 132, exported from table delta
+    (record-omega
+        (id 132)
+        (description "lambda beta theta kappa beta beta omega kappa")
+        (payload "beta delta lambda kappa omega gamma beta zeta gamma kappa theta beta delta theta epsilon theta")
+        (tags tag-alpha tag-epsilon tag-lambda tag-theta)
+        (values 61076 79204 17798 79586 52230 75124))
+    ;; record 133, exported from table lambda
+    (record-omega
+        (id 133)
+        (description "gamma epsilon epsilon epsilon lambda kappa epsilon kappa")
+        (payload "lambda zeta omega delta gamma omega delta lambda alpha sigma alpha beta zeta lambda lambda zeta")
+        (tags tag-theta tag-beta tag-kappa tag-alpha)
+        (values 79997 98568 14423 77377 57019 69299))
+    ;; record 134, exported from table zeta
+    (record-alpha
+        (id 134)
+        (description "zeta beta epsilon alpha zeta gamma kappa kappa")
+        (payload "lambda sigma gamma delta gamma alpha theta kappa kappa theta gamma omega kappa gamma theta sigma")
+        (tags tag-zeta tag-gamma tag-theta tag-zeta)
+        (values 4925 16920 88236 65139 66797 18454))
+    ;; record 135, exported from table zeta
+    (record-epsilon
+        (id 135)
+        (description "alpha gamma delta beta kappa beta kappa kappa")
+        (payload "lambda zeta zeta zeta zeta omega zeta epsilon beta lambda kappa zeta gamma gamma omega alpha")
+        (tags tag-sigma tag-epsilon tag-sigma tag-theta)
+        (values 88418 24808 85766 66182 83087 66164))
+    ;; record 136, exported from table gamma
+    (record-theta
+        (id 136)
+        (description "lambda sigma delta sigma delta sigma kappa gamma")
+        (payload "alpha kappa omega gamma sigma theta sigma theta lambda gamma beta beta kappa lambda gamma beta")
+        (tags tag-zeta tag-theta tag-theta tag-omega)
+        (values 13253 12327 54935 11885 23898 7040))
+    ;; record 137, exported from table theta
+    (record-beta
+        (id 137)
+        (description "delta theta gamma sigma sigma alpha zeta theta")
+        (payload "omega zeta theta delta omega gamma omega delta zeta delta kappa omega gamma gamma beta lambda")
+        (tags tag-theta tag-epsilon tag-zeta tag-delta)
+        (values 11272 24267 98487 14565 93723 8981))
+    ;; record 138, exported from table omega
+    (record-alpha
+        (id 138)
+        (description "delta kappa zeta epsilon theta delta epsilon beta")
+        (payload "omega alpha alpha sigma zeta epsilon zeta delta gamma sigma lambda beta omega zeta omega sigma")
+        (tags tag-gamma tag-omega tag-omega tag-omega)
+        (values 16794 20034 97539 19896 27134 34869))
+    ;; record 139, exported from table sigma
+    (record-alpha
+        (id 139)
+        (description "delta theta omega epsilon delta delta alpha gamma")
+        (payload "gamma gamma omega theta lambda delta gamma kappa gamma delta delta sigma zeta lambda zeta sigma")
+        (tags tag-gamma tag-delta tag-delta tag-delta)
+        (values 48649 95866 98164 10018 74736 47918))
+    ;; record 140, exported from table delta
+    (record-delta
+        (id 140)
+        (description "omega sigma epsilon epsilon theta alpha sigma delta")
+        (payload "zeta kappa delta omega epsilon gamma epsilon omega alpha theta delta epsilon omega beta alpha lambda")
+        (tags tag-gamma tag-alpha tag-gamma tag-kappa)
+        (values 99609 10780 56717 37254 9606 25874))
+    ;; record 141, exported from table sigma
+    (record-delta
+        (id 141)
+        (description "sigma epsilon theta sigma sigma kappa kappa omega")
+        (payload "theta epsilon gamma epsilon lambda epsilon omega gamma lambda epsilon delta alpha sigma gamma gamma gamma")
+        (tags tag-zeta tag-epsilon tag-alpha tag-gamma)
+        (values 45670 55999 9358 49775 9935 61525))
+    ;; record 142, exported from table delta
+    (record-beta
+        (id 142)
+        (description "theta lambda omega epsilon theta gamma zeta lambda")
+        (payload "beta beta omega delta theta delta theta lambda lambda sigma epsilon lambda theta beta alpha epsilon")
+        (tags tag-gamma tag-epsilon tag-epsilon tag-epsilon)
+        (values 29474 63644 97090 29804 48009 7809))
+    ;; record 143, exported from table delta
+    (record-lambda
+        (id 143)
+        (description "gamma epsilon epsilon delta zeta sigma kappa gamma")
+        (payload "gamma gamma omega theta omega zeta alpha lambda sigma gamma gamma gamma gamma beta zeta delta")
+        (tags tag-omega tag-zeta tag-gamma tag-kappa)
+        (values 3171 65133 12115 69963 46766 56639))
+    ;; record 144, exported from table lambda
+    (record-sigma
+        (id 144)
+        (description "zeta theta zeta zeta omega gamma lambda kappa")
+        (payload "delta lambda alpha zeta epsilon epsilon gamma epsilon theta delta theta zeta alpha alpha beta delta")
+        (tags tag-kappa tag-alpha tag-delta tag-zeta)
+        (values 48905 75844 31758 53516 88569 22028))
+    ;; record 145, exported from table theta
+    (record-theta
+        (id 145)
+        (description "omega delta beta kappa delta delta alpha omega")
+        (payload "kappa gamma beta delta beta beta zeta lambda sigma sigma beta epsilon beta lambda epsilon theta")
+        (tags tag-omega tag-beta tag-epsilon tag-lambda)
+        (values 88030 96720 76996 29747 10042 60075))
+    ;; record 146, exported from table theta
+    (record-kappa
+        (id 146)
+        (description "zeta gamma epsilon omega sigma kappa alpha lambda")
+        (payload "delta theta theta theta delta theta omega zeta kappa alpha lambda kappa zeta kappa zeta sigma")
+        (tags tag-alpha tag-sigma tag-zeta tag-theta)
+        (values 47855 10402 30696 62093 80609 76042))
+    ;; record 147, exported from table theta
+    (record-gamma
+        (id 147)
+        (description "kappa gamma delta delta alpha beta epsilon sigma")
+        (payload "epsilon alpha zeta beta sigma theta theta omega omega theta sigma omega gamma epsilon gamma omega")
+        (tags tag-omega tag-zeta tag-beta tag-delta)
+        (values 91017 62090 62167 88019 2336 54915))
+    ;; record 148, exported from table theta
+    (record-alpha
+        (id 148)
+        (description "theta kappa alpha lambda sigma kappa lambda theta")
+        (payload "lambda beta omega kappa zeta omega theta gamma lambda theta lambda zeta zeta theta gamma omega")
+        (tags tag-theta tag-theta tag-omega tag-alpha)
+        (values 83950 10876 40579 14792 89444 43970))
+    ;; record 149, exported from table omega
+    (record-zeta
+        (id 149)
+        (description "theta epsilon epsilon lambda lambda theta theta zeta")
+        (payload "kappa zeta omega gamma zeta zeta gamma lambda gamma omega theta kappa delta zeta theta omega")
+        (tags tag-theta tag-gamma tag-zeta tag-zeta)
+        (values 40056 71422 11443 17537 87383 41176))
+    ;; record 150, exported from table omega
+    (record-lambda
+        (id 150)
+        (description "omega delta sigma sigma lambda delta zeta epsilon")
+        (payload "zeta alpha omega epsilon epsilon gamma omega alpha lambda sigma zeta gamma zeta delta delta beta")
+        (tags tag-gamma tag-omega tag-omega tag-theta)
+        (values 12086 74590 9345 72064 64666 15131))
+    ;; record 151, exported from table delta
+    (record-sigma
+        (id 151)
+        (description "kappa lambda kappa gamma epsilon alpha sigma lambda")
+        (payload "delta epsilon gamma delta omega epsilon omega gamma sigma zeta sigma kappa delta omega lambda theta")
+        (tags tag-kappa tag-alpha tag-lambda tag-theta)
+        (values 41444 61148 36233 46111 44264 15536))
+    ;; record 152, exported from table omega
+    (record-kappa
+        (id 152)
+        (description "beta omega alpha epsilon delta lambda zeta kappa")
+        (payload "delta beta gamma gamma kappa zeta delta omega epsilon delta delta alpha epsilon epsilon delta delta")
+        (tags tag-sigma tag-delta tag-gamma tag-omega)
+        (values 35949 23132 82073 20990 45857 47078))
+    ;; record 153, exported from table kappa
+    (record-zeta
+        (id 153)
+        (description "kappa kappa beta beta gamma zeta theta beta")
+        (payload "sigma beta lambda beta alpha sigma zeta zeta theta delta alpha zeta lambda lambda sigma kappa")
+        (tags tag-gamma tag-theta tag-theta tag-epsilon)
+        (values 85835 27856 53736 99574 32644 33677))
+    ;; record 154, exported from table beta
+    (record-alpha
+        (id 154)
+        (description "beta lambda omega omega zeta beta sigma epsilon")
+        (payload "alpha lambda sigma epsilon theta kappa omega alpha theta zeta lambda delta omega theta zeta zeta")
+        (tags tag-alpha tag-kappa tag-sigma tag-omega)
+        (values 72099 83599 8000 50914 46036 17289))
+    ;; record 155, exported from table alpha
+    (record-omega
+        (id 155)
+        (description "alpha beta zeta omega zeta gamma lambda lambda")
+        (payload "beta gamma gamma delta zeta omega theta beta kappa lambda beta alpha beta beta gamma theta")
+        (tags tag-kappa tag-delta tag-gamma tag-gamma)
+        (values 75265 92165 66685 25399 35274 9348))
+    ;; record 156, exported from table gamma
+    (record-zeta
+        (id 156)
+        (description "zeta theta omega delta alpha epsilon lambda zeta")
+        (payload "delta sigma zeta omega kappa omega sigma epsilon lambda gamma delta sigma theta epsilon epsilon theta")
+        (tags tag-lambda tag-epsilon tag-delta tag-zeta)
+        (values 80111 17839 15764 68496 54736 45862))
+    ;; record 157, exported from table beta
+    (record-gamma
+        (id 157)
+        (description "epsilon gamma omega omega omega kappa gamma lambda")
+        (payload "theta omega delta kappa alpha delta omega zeta beta theta gamma sigma gamma gamma omega sigma")
+        (tags tag-omega tag-delta tag-delta tag-lambda)
+        (values 46429 68069 34140 99909 41391 25503))
+    ;; record 158, exported from table lambda
+    (record-zeta
+        (id 158)
+        (description "sigma zeta kappa beta omega beta epsilon omega")
+        (payload "kappa gamma alpha gamma omega theta kappa zeta theta gamma beta gamma omega beta sigma beta")
+        (tags tag-zeta tag-theta tag-kappa tag-theta)
+        (values 13281 735 42106 4031 35485 48448))
+    ;; record 159, exported from table epsilon
+    (record-epsilon
+        (id 159)
+        (description "epsilon zeta lambda omega lambda lambda lambda delta")
+        (payload "omega theta omega epsilon beta lambda theta sigma kappa beta gamma lambda kappa kappa delta kappa")
+        (tags tag-kappa tag-delta tag-gamma tag-theta)
+        (values 73702 25719 35149 20170 71496 50393))
+    ;; record 160, exported from table alpha
+    (record-zeta
+        (id 160)
+        (description "alpha kappa epsilon delta theta delta theta omega")
+        (payload "gamma gamma omega alpha omega epsilon alpha sigma epsilon kappa lambda gamma delta delta delta omega")
+        (tags tag-omega tag-alpha tag-alpha tag-delta)
+        (values 88700 9346 27278 20601 55753 86865))
+    ;; record 161, exported from table omega
+    (record-kappa
+        (id 161)
+        (description "sigma theta lambda zeta epsilon alpha sigma zeta")
+        (payload "alpha kappa omega epsilon gamma sigma sigma omega kappa theta sigma epsilon alpha delta sigma gamma")
+        (tags tag-epsilon tag-zeta tag-epsilon tag-lambda)
+        (values 16131 11976 40000 11063 53112 68399))
+    ;; record 162, exported from table lambda
+    (record-delta
+        (id 162)
+        (description "alpha omega alpha beta delta omega lambda alpha")
+        (payload "kappa omega gamma gamma omega delta epsilon kappa kappa epsilon sigma theta kappa sigma zeta theta")
+        (tags tag-theta tag-theta tag-alpha tag-kappa)
+        (values 30548 35465 3432 58009 2994 69990))
+    ;; record 163, exported from table theta
+    (record-epsilon
+        (id 163)
+        (description "alpha alpha zeta sigma alpha kappa kappa zeta")
+        (payload "epsilon sigma lambda delta omega beta lambda delta beta epsilon alpha lambda alpha lambda epsilon lambda")
+        (tags tag-delta tag-epsilon tag-zeta tag-zeta)
+        (values 33181 49185 13657 31542 69670 73611))
+    ;; record 164, exported from table epsilon
+    (record-epsilon
+        (id 164)
+        (description "lambda zeta sigma delta zeta beta epsilon sigma")
+        (payload "epsilon beta gamma gamma sigma gamma gamma theta delta beta sigma gamma lambda beta sigma gamma")
+        (tags tag-lambda tag-kappa tag-kappa tag-omega)
+        (values 66773 25169 52215 5690 28603 30846))
+    ;; record 165, exported from table delta
+    (record-sigma
+        (id 165)
+        (description "epsilon alpha theta zeta lambda alpha alpha zeta")
+        (payload "kappa epsilon kappa kappa beta lambda alpha alpha zeta kappa theta alpha lambda theta gamma lambda")
+        (tags tag-lambda tag-delta tag-sigma tag-theta)
+        (values 24394 1659 81294 354 74271 66699))
+    ;; record 166, exported from table beta
+    (record-beta
+        (id 166)
+        (description "kappa alpha gamma delta theta theta alpha zeta")
+        (payload "epsilon epsilon lambda sigma epsilon beta zeta alpha delta epsilon theta sigma sigma epsilon omega zeta")
+        (tags tag-omega tag-theta tag-delta tag-lambda)
+        (values 79838 1780 15696 86036 8178 13681))
+    ;; record 167, exported from table alpha
+    (record-kappa
+        (id 167)
+        (description "epsilon lambda theta zeta theta zeta beta alpha")
+        (payload "omega sigma kappa zeta zeta gamma gamma gamma epsilon delta theta omega omega zeta delta alpha")
+        (tags tag-kappa tag-alpha tag-beta tag-zeta)
+        (values 59907 13724 40576 38379 93221 50265))
+    ;; record 168, exported from table zeta
+    (record-lambda
+        (id 168)
+        (description "sigma alpha lambda gamma zeta beta epsilon kappa")
+        (payload "epsilon omega alpha gamma kappa kappa zeta kappa delta kappa epsilon theta kappa alpha omega alpha")
+        (tags tag-sigma tag-epsilon tag-theta tag-beta)
+        (values 17114 46142 83017 55920 1374 29102))
+    ;; record 169, exported from table omega
+    (record-beta
+        (id 169)
+        (description "beta sigma omega omega sigma sigma zeta beta")
+        (payload "zeta kappa lambda omega epsilon beta omega gamma beta omega alpha delta lambda sigma gamma beta")
+        (tags tag-alpha tag-lambda tag-epsilon tag-lambda)
+        (values 51191 37461 46281 47452 14138 76777))
+    ;; record 170, exported from table gamma
+    (record-sigma
+        (id 170)
+        (description "beta zeta delta delta sigma kappa delta omega")
+        (payload "theta gamma theta theta sigma beta alpha delta gamma theta lambda beta epsilon delta beta omega")
+        (tags tag-beta tag-omega tag-omega tag-sigma)
+        (values 23594 87395 66047 97211 93961 15791))
+    ;; record 171, exported from table epsilon
+    (record-beta
+        (id 171)
+        (description "zeta delta lambda beta theta lambda kappa beta")
+        (payload "omega beta zeta gamma zeta sigma alpha gamma alpha kappa beta sigma zeta alpha alpha beta")
+        (tags tag-omega tag-zeta tag-omega tag-omega)
+        (values 38995 46612 94639 21768 20407 24202))
+    ;; record 172, exported from table omega
+    (record-delta
+        (id 172)
+        (description "epsilon kappa omega epsilon epsilon omega omega omega")
+        (payload "omega zeta sigma gamma lambda kappa kappa omega kappa gamma theta gamma beta kappa theta lambda")
+        (tags tag-theta tag-zeta tag-sigma tag-gamma)
+        (values 49218 53735 5176 87918 41207 16729))
+    ;; record 173, exported from table alpha
+    (record-zeta
+        (id 173)
+        (description "alpha epsilon kappa alpha alpha epsilon sigma kappa")
+        (payload "gamma zeta kappa lambda sigma lambda kappa kappa theta beta gamma lambda zeta gamma alpha lambda")
+        (tags tag-zeta tag-gamma tag-sigma tag-theta)
+        (values 33380 95349 12823 74131 8382 71309))
+    ;; record 174, exported from table omega
+    (record-zeta
+        (id 174)
+        (description "omega delta beta zeta delta kappa lambda alpha")
+        (payload "sigma theta theta gamma epsilon zeta lambda lambda sigma gamma zeta gamma zeta lambda omega epsilon")
+        (tags tag-delta tag-lambda tag-sigma tag-kappa)
+        (values 48939 80659 40739 40125 98321 92640))
+    ;; record 175, exported from table delta
+    (record-lambda
+        (id 175)
+        (description "lambda gamma zeta zeta delta beta theta gamma")
+        (payload "lambda lambda sigma alpha theta delta alpha theta delta beta sigma beta kappa lambda sigma gamma")
+        (tags tag-epsilon tag-sigma tag-zeta tag-theta)
+        (values 7100 86316 85993 30273 43044 75133))
+    ;; record 176, exported from table lambda
+    (record-theta
+        (id 176)
+        (description "kappa omega zeta theta epsilon zeta alpha gamma")
+        (payload "theta theta theta zeta gamma sigma lambda beta beta gamma delta omega delta delta epsilon lambda")
+        (tags tag-omega tag-zeta tag-lambda tag-zeta)
+        (values 73268 91080 28855 27461 44381 40174))
+    ;; record 177, exported from table delta
+    (record-gamma
+        (id 177)
+        (description "beta delta kappa alpha alpha kappa delta omega")
+        (payload "epsilon epsilon sigma kappa delta sigma kappa lambda sigma delta omega sigma epsilon omega delta epsilon")
+        (tags tag-omega tag-sigma tag-theta tag-omega)
+        (values 14481 43939 74681 17747 87625 76448))
+    ;; record 178, exported from table lambda
+    (record-sigma
+        (id 178)
+        (description "omega theta theta sigma gamma lambda lambda theta")
+        (payload "sigma alpha gamma omega delta zeta epsilon theta kappa omega omega alpha theta sigma beta kappa")
+        (tags tag-epsilon tag-delta tag-omega tag-beta)
+        (values 98999 25122 58397 47843 97935 76305))
+    ;; record 179, exported from table sigma
+    (record-kappa
+        (id 179)
+        (description "epsilon theta theta theta omega zeta delta gamma")
+        (payload "gamma kappa beta delta gamma kappa delta omega epsilon gamma sigma kappa omega epsilon epsilon zeta")
+        (tags tag-sigma tag-kappa tag-epsilon tag-theta)
+        (values 76201 65746 12375 19689 36153 63798))
+    ;; record 180, exported from table gamma
+    (record-epsilon
+        (id 180)
+        (description "gamma beta kappa lambda epsilon alpha alpha omega")
+        (payload "alpha delta lambda epsilon kappa kappa zeta gamma alpha lambda delta alpha delta theta beta beta")
+        (tags tag-lambda tag-epsilon tag-theta tag-lambda)
+        (values 19930 55309 1729 51994 33468 43875))
+    ;; record 181, exported from table alpha
+    (record-lambda
+        (id 181)
+        (description "kappa theta epsilon alpha zeta epsilon epsilon beta")
+        (payload "delta sigma lambda zeta omega alpha zeta kappa delta gamma delta kappa epsilon lambda theta delta")
+        (tags tag-kappa tag-kappa tag-epsilon tag-kappa)
+        (values 6198 27181 56908 43837 12476 5938))
+    ;; record 182, exported from table beta
+    (record-gamma
+        (id 182)
+        (description "kappa kappa kappa alpha sigma alpha zeta sigma")
+        (payload "lambda sigma alpha beta omega epsilon omega theta lambda lambda epsilon sigma delta theta zeta lambda")
+        (tags tag-zeta tag-gamma tag-lambda tag-beta)
+        (values 86019 21773 24006 75903 6037 43149))
+    ;; record 183, exported from table omega
+    (record-omega
+        (id 183)
+        (description "gamma lambda zeta beta sigma omega alpha sigma")
+        (payload "theta sigma epsilon epsilon omega beta sigma lambda omega beta epsilon delta delta theta sigma omega")
+        (tags tag-alpha tag-epsilon tag-omega tag-beta)
+        (values 79136 41939 56587 27965 53345 45464))
+    ;; record 184, exported from table epsilon
+    (record-beta
+        (id 184)
+        (description "kappa sigma epsilon theta kappa gamma gamma beta")
+        (payload "lambda epsilon gamma gamma alpha theta kappa lambda sigma kappa kappa sigma zeta sigma lambda gamma")
+        (tags tag-sigma tag-theta tag-alpha tag-theta)
+        (values 10823 62784 44323 23384 83414 55565))
+    ;; record 185, exported from table alpha
+    (record-epsilon
+        (id 185)
+        (description "delta gamma gamma delta gamma gamma omega epsilon")
+        (payload "omega kappa omega kappa delta alpha delta theta kappa alpha beta zeta theta lambda beta zeta")
+        (tags tag-theta tag-theta tag-sigma tag-gamma)
+        (values 98591 17903 3285 13696 72056 97841))
+    ;; record 186, exported from table kappa
+    (record-beta
+        (id 186)
+        (description "delta epsilon zeta zeta zeta beta kappa delta")
+        (payload "alpha kappa sigma alpha theta alpha theta delta sigma lambda kappa zeta alpha theta theta delta")
+        (tags tag-kappa tag-delta tag-gamma tag-alpha)
+        (values 66270 25193 77940 68381 94323 43161))
+    ;; record 187, exported from table theta
+    (record-zeta
+        (id 187)
+        (description "delta alpha epsilon alpha zeta zeta lambda theta")
+        (payload "zeta omega theta zeta lambda delta lambda alpha sigma omega delta zeta epsilon beta alpha beta")
+        (tags tag-lambda tag-delta tag-beta tag-delta)
+        (values 20561 13872 10601 485 15761 5749))
+    ;; record 188, exported from table kappa
+    (record-omega
+        (id 188)
+        (description "epsilon kappa lambda gamma delta alpha omega zeta")
+        (payload "beta sigma theta gamma theta omega theta theta alpha theta delta beta omega beta gamma beta")
+        (tags tag-epsilon tag-zeta tag-lambda tag-theta)
+        (values 99788 16249 20674 75539 374 53820))
+    ;; record 189, exported from table sigma
+    (record-kappa
+        (id 189)
+        (description "gamma theta theta sigma epsilon delta delta zeta")
+        (payload "omega sigma zeta delta omega alpha zeta delta kappa gamma alpha beta omega theta epsilon alpha")
+        (tags tag-epsilon tag-theta tag-alpha tag-theta)
+        (values 61858 50897 91447 -368 61355 -308))
+    ;; record 190, exported from table lambda
+    (record-omega
+        (id 190)
+        (description "theta sigma sigma omega beta beta lambda epsilon")
+        (payload "sigma lambda omega lambda sigma lambda kappa beta kappa zeta zeta lambda zeta zeta lambda omega")
+        (tags tag-beta tag-kappa tag-sigma tag-alpha)
+        (values 68945 75704 60918 59127 76978 27324))
+    ;; record 191, exported from table delta
+    (record-kappa
+        (id 191)
+        (description "lambda beta delta gamma sigma zeta zeta omega")
+        (payload "beta lambda theta delta epsilon gamma delta beta sigma epsilon delta alpha sigma sigma theta gamma")
+        (tags tag-omega tag-delta tag-alpha tag-kappa)
+        (values 34699 19336 15522 99029 97356 8673))
+    ;; record 192, exported from table sigma
+    (record-kappa
+        (id 192)
+        (description "epsilon beta zeta beta alpha omega omega alpha")
+        (payload "delta omega kappa omega theta alpha omega kappa gamma epsilon beta theta gamma gamma zeta lambda")
+        (tags tag-delta tag-lambda tag-theta tag-beta)
+        (values 55410 76654 69880 68150 27943 78390))
+    ;; record 193, exported from table sigma
+    (record-delta
+        (id 193)
+        (description "kappa epsilon kappa alpha theta delta theta delta")
+        (payload "lambda zeta sigma omega alpha zeta omega omega sigma sigma gamma alpha lambda epsilon theta beta")
+        (tags tag-sigma tag-kappa tag-theta tag-lambda)
+        (values 22553 38312 17384 45162 29906 25625))
+    ;; record 194, exported from table delta
+    (record-gamma
+        (id 194)
+        (description "gamma gamma lambda zeta delta zeta epsilon kappa")
+        (payload "lambda gamma epsilon gamma sigma beta gamma zeta omega omega epsilon beta zeta theta sigma zeta")
+        (tags tag-lambda tag-gamma tag-alpha tag-kappa)
+        (values 66189 56962 19948 88398 7350 78147))
+    ;; record 195, exported from table kappa
+    (record-epsilon
+        (id 195)
+        (description "beta kappa zeta delta lambda delta beta lambda")
+        (payload "zeta omega omega sigma kappa omega gamma delta gamma delta kappa delta theta delta zeta delta")
+        (tags tag-delta tag-sigma tag-zeta tag-kappa)
+        (values 83465 78519 88563 5551 52366 400))
+    ;; record 196, exported from table epsilon
+    (record-beta
+        (id 196)
+        (description "epsilon alpha gamma sigma beta theta beta gamma")
+        (payload "omega omega beta omega theta alpha beta zeta delta epsilon beta delta gamma beta zeta epsilon")
+        (tags tag-lambda tag-gamma tag-epsilon tag-epsilon)
+        (values 29977 99541 56090 58272 73705 57640))
+    ;; record 197, exported from table epsilon
+    (record-sigma
+        (id 197)
+        (description "kappa zeta zeta beta alpha sigma theta delta")
+        (payload "zeta gamma zeta alpha omega epsilon omega omega omega omega omega omega epsilon epsilon lambda theta")
+        (tags tag-alpha tag-delta tag-gamma tag-sigma)
+        (values 95862 64655 63086 82600 35742 82603))
+    ;; record 198, exported from table zeta
+    (record-alpha
+        (id 198)
+        (description "lambda alpha sigma beta theta zeta zeta omega")
+        (payload "gamma beta sigma gamma omega beta alpha kappa zeta gamma alpha beta delta epsilon delta zeta")
+        (tags tag-delta tag-gamma tag-theta tag-alpha)
+        (values 16970 32281 63925 80427 55438 460))
+    ;; record 199, exported from table lambda
+    (record-beta
+        (id 199)
+        (description "delta gamma zeta sigma beta theta delta beta")
+        (payload "alpha lambda omega kappa lambda gamma epsilon beta beta alpha delta theta sigma lambda alpha omega")
+        (tags tag-alpha tag-omega tag-epsilon tag-theta)
+        (values 94325 96611 71549 59251 -165 31627))
+    ;; record 200, exported from table beta
+    (record-delta
+        (id 200)
+        (description "beta kappa kappa delta kappa zeta delta omega")
+        (payload "omega epsilon delta kappa lambda epsilon lambda sigma sigma sigma alpha alpha delta alpha kappa theta")
+        (tags tag-kappa tag-zeta tag-kappa tag-delta)
+        (values 99582 63238 97267 28597 65045 21438))
+    ;; record 201, exported from table beta
+    (record-sigma
+        (id 201)
+        (description "theta theta gamma beta epsilon zeta alpha omega")
+        (payload "sigma alpha lambda gamma beta lambda zeta sigma omega delta epsilon omega kappa zeta gamma beta")
+        (tags tag-epsilon tag-gamma tag-theta tag-kappa)
+        (values 57018 50806 32145 6703 8117 90683))
+    ;; record 202, exported from table theta
+    (record-gamma
+        (id 202)
+        (description "theta theta epsilon alpha delta kappa delta alpha")
+        (payload "omega zeta delta epsilon beta gamma omega zeta zeta sigma gamma omega zeta zeta kappa sigma")
+        (tags tag-alpha tag-sigma tag-delta tag-sigma)
+        (values 79705 77153 66925 20953 89282 10684))
+    ;; record 203, exported from table alpha
+    (record-epsilon
+        (id 203)
+        (description "sigma theta gamma delta delta sigma beta epsilon")
+        (payload "theta lambda sigma zeta sigma kappa omega kappa omega zeta omega delta omega alpha lambda omega")
+        (tags tag-omega tag-sigma tag-omega tag-alpha)
+        (values 80309 77021 21758 96806 18572 74377))
+    ;; record 204, exported from table delta
+    (record-omega
+        (id 204)
+        (description "epsilon alpha kappa epsilon omega omega sigma omega")
+        (payload "zeta lambda alpha epsilon lambda alpha sigma epsilon delta delta alpha lambda epsilon alpha sigma sigma")
+        (tags tag-lambda tag-epsilon tag-omega tag-gamma)
+        (values 58768 2152 50725 95010 47949 41480))
+    ;; record 205, exported from table theta
+    (record-zeta
+        (id 205)
+        (description "omega theta epsilon sigma sigma alpha kappa gamma")
+        (payload "delta theta lambda epsilon alpha zeta gamma epsilon gamma beta omega theta beta kappa beta beta")
+        (tags tag-zeta tag-kappa tag-delta tag-gamma)
+        (values 71501 28010 17412 22774 49785 85852))
+    ;; record 206, exported from table gamma
+    (record-epsilon
+        (id 206)
+        (description "delta omega alpha delta beta epsilon beta lambda")
+        (payload "kappa beta theta omega omega delta epsilon theta alpha gamma sigma omega theta omega epsilon alpha")
+        (tags tag-delta tag-epsilon tag-sigma tag-epsilon)
+        (values 17927 26333 49950 18928 44869 29150))
+    ;; record 207, exported from table lambda
+    (record-alpha
+        (id 207)
+        (description "gamma theta alpha omega beta theta epsilon lambda")
+        (payload "beta delta gamma delta beta beta lambda epsilon alpha delta lambda zeta lambda omega omega lambda")
+        (tags tag-epsilon tag-gamma tag-kappa tag-sigma)
+        (values 47438 -910 12872 6186 44136 64005))
+    ;; record 208, exported from table zeta
+    (record-sigma
+        (id 208)
+        (description "beta theta lambda gamma kappa beta sigma delta")
+        (payload "lambda alpha delta gamma lambda theta lambda zeta gamma lambda beta gamma beta epsilon zeta zeta")
+        (tags tag-epsilon tag-delta tag-sigma tag-kappa)
+        (values 27932 1613 28590 45154 82263 72823))
+    ;; record 209, exported from table gamma
+    (record-theta
+        (id 209)
+        (description "theta kappa sigma alpha omega gamma zeta omega")
+        (payload "theta gamma theta lambda omega delta gamma omega alpha zeta lambda lambda alpha omega alpha delta")
+        (tags tag-theta tag-kappa tag-gamma tag-zeta)
+        (values 12671 11536 84488 36506 40095 83054))
+    ;; record 210, exported from table beta
+    (record-sigma
+        (id 210)
+        (description "kappa theta alpha gamma beta kappa omega sigma")
+        (payload "alpha delta gamma alpha gamma beta epsilon omega zeta sigma alpha sigma gamma kappa sigma sigma")
+        (tags tag-gamma tag-epsilon tag-theta tag-gamma)
+        (values 66289 40020 82961 32947 61150 55374))
+    ;; record 211, exported from table beta
+    (record-kappa
+        (id 211)
+        (description "zeta lambda alpha zeta beta alpha theta epsilon")
+        (payload "beta lambda sigma beta zeta omega gamma sigma kappa lambda lambda theta delta kappa delta delta")
+        (tags tag-beta tag-zeta tag-epsilon tag-alpha)
+        (values 77386 33041 56553 31573 86275 19589))
+    ;; record 212, exported from table beta
+    (record-omega
+        (id 212)
+        (description "sigma gamma gamma theta kappa epsilon epsilon theta")
+        (payload "delta epsilon delta omega alpha delta gamma alpha sigma alpha delta omega epsilon omega zeta epsilon")
+        (tags tag-epsilon tag-omega tag-lambda tag-alpha)
+        (values 41829 84156 37916 95865 98700 33748))
+    ;; record 213, exported from table kappa
+    (record-gamma
+        (id 213)
+        (description "gamma omega kappa kappa omega epsilon delta beta")
+        (payload "gamma gamma gamma omega kappa lambda theta gamma lambda sigma gamma lambda omega omega alpha lambda")
+        (tags tag-lambda tag-delta tag-delta tag-alpha)
+        (values 39807 48849 62929 89221 97547 72948))
+    ;; record 214, exported from table beta
+    (record-alpha
+        (id 214)
+        (description "epsilon omega theta kappa delta alpha zeta epsilon")
+        (payload "alpha delta kappa sigma beta alpha alpha delta beta delta sigma gamma theta lambda alpha alpha")
+        (tags tag-omega tag-lambda tag-lambda tag-zeta)
+        (values 48364 92699 90228 77488 63609 88642))
+    ;; record 215, exported from table lambda
+    (record-alpha
+        (id 215)
+        (description "theta omega epsilon kappa gamma theta alpha alpha")
+        (payload "gamma lambda alpha omega kappa kappa epsilon delta kappa alpha theta lambda epsilon zeta theta beta")
+        (tags tag-epsilon tag-lambda tag-alpha tag-epsilon)
+        (values 91002 22612 26566 26055 97674 23051))
+    ;; record 216, exported from table zeta
+    (record-delta
+        (id 216)
+        (description "epsilon theta lambda theta kappa delta sigma sigma")
+        (payload "zeta alpha kappa sigma theta alpha alpha gamma beta sigma sigma sigma lambda alpha beta omega")
+        (tags tag-zeta tag-theta tag-alpha tag-zeta)
+        (values 8621 71705 5103 16912 83723 76039))
+    ;; record 217, exported from table gamma
+    (record-lambda
+        (id 217)
+        (description "sigma alpha beta theta delta gamma zeta omega")
+        (payload "kappa sigma alpha beta epsilon sigma zeta theta gamma kappa epsilon zeta epsilon gamma gamma alpha")
+        (tags tag-alpha tag-epsilon tag-lambda tag-sigma)
+        (values 35020 18973 65192 34566 3190 89320))
+    ;; record 218, exported from table zeta
+    (record-lambda
+        (id 218)
+        (description "epsilon alpha sigma sigma zeta omega gamma beta")
+        (payload "omega epsilon kappa lambda delta zeta kappa lambda zeta lambda gamma epsilon omega delta kappa lambda")
+        (tags tag-alpha tag-epsilon tag-theta tag-gamma)
+        (values 6130 13671 85687 38606 24006 92006))
+    ;; record 219, exported from table alpha
+    (record-beta
+        (id 219)
+        (description "alpha alpha theta delta lambda alpha omega sigma")
+        (payload "theta zeta alpha kappa beta alpha beta delta gamma omega lambda beta epsilon beta zeta alpha")
+        (tags tag-alpha tag-lambda tag-kappa tag-kappa)
+        (values 83164 71426 60752 5424 88567 17315))
+    ;; record 220, exported from table alpha
+    (record-beta
+        (id 220)
+        (description "omega beta alpha omega beta gamma alpha epsilon")
+        (payload "alpha alpha gamma zeta beta lambda sigma epsilon gamma omega epsilon sigma omega lambda theta gamma")
+        (tags tag-theta tag-kappa tag-alpha tag-alpha)
+        (values 90542 95701 -24 61602 33448 -728))
+    ;; record 221, exported from table omega
+    (record-zeta
+        (id 221)
+        (description "theta beta alpha omega omega omega lambda kappa")
+        (payload "epsilon sigma epsilon alpha omega epsilon lambda epsilon theta lambda gamma omega alpha omega alpha alpha")
+        (tags tag-alpha tag-epsilon tag-lambda tag-omega)
+        (values 72787 32870 47711 19741 94513 55048))
+    ;; record 222, exported from table alpha
+    (record-lambda
+        (id 222)
+        (description "omega alpha epsilon epsilon sigma beta theta omega")
+        (payload "lambda lambda epsilon beta gamma epsilon gamma theta omega lambda omega kappa beta alpha sigma epsilon")
+        (tags tag-lambda tag-epsilon tag-gamma tag-sigma)
+        (values 57167 88591 73838 70361 95985 32721))
+    ;; record 223, exported from table epsilon
+    (record-beta
+        (id 223)
+        (description "gamma omega kappa delta delta omega kappa beta")
+        (payload "epsilon sigma gamma delta epsilon gamma sigma alpha omega lambda kappa omega kappa beta alpha epsilon")
+        (tags tag-sigma tag-delta tag-delta tag-kappa)
+        (values 42925 80599 25030 30726 44446 32620))
+    ;; record 224, exported from table kappa
+    (record-beta
+        (id 224)
+        (description "zeta zeta theta zeta beta omega zeta sigma")
+        (payload "alpha theta sigma kappa sigma epsilon delta theta gamma theta gamma zeta zeta lambda kappa zeta")
+        (tags tag-sigma tag-beta tag-epsilon tag-lambda)
+        (values 24668 62083 29009 65888 53618 41089))
+    ;; record 225, exported from table lambda
+    (record-sigma
+        (id 225)
+        (description "sigma zeta zeta zeta gamma sigma omega zeta")
+        (payload "gamma omega gamma theta alpha delta epsilon lambda theta zeta delta delta kappa beta gamma kappa")
+        (tags tag-epsilon tag-omega tag-alpha tag-gamma)
+        (values 14241 35789 91868 16914 47069 737))
+    ;; record 226, exported from table delta
+    (record-beta
+        (id 226)
+        (description "delta sigma beta lambda delta sigma omega epsilon")
+        (payload "lambda lambda omega gamma lambda beta alpha gamma sigma theta sigma zeta delta delta gamma delta")
+        (tags tag-kappa tag-omega tag-lambda tag-omega)
+        (values 22909 17771 6576 37592 10217 27359))
+    ;; record 227, exported from table sigma
+    (record-alpha
+        (id 227)
+        (description "zeta delta alpha delta lambda omega epsilon theta")
+        (payload "lambda theta zeta omega epsilon alpha omega zeta alpha zeta delta beta omega alpha beta lambda")
+        (tags tag-gamma tag-zeta tag-lambda tag-delta)
+        (values 94381 56247 4596 47126 57596 48884))
+    ;; record 228, exported from table omega
+    (record-beta
+        (id 228)
+        (description "omega epsilon epsilon epsilon sigma sigma kappa gamma")
+        (payload "theta kappa epsilon gamma omega beta kappa beta alpha lambda delta kappa alpha sigma delta omega")
+        (tags tag-omega tag-gamma tag-lambda tag-lambda)
+        (values 10976 72555 45685 38987 59155 57932))
+    ;; record 229, exported from table kappa
+    (record-beta
+        (id 229)
+        (description "kappa theta sigma lambda sigma zeta kappa epsilon")
+        (payload "sigma theta sigma beta gamma beta gamma gamma epsilon beta beta lambda sigma theta gamma epsilon")
+        (tags tag-epsilon tag-epsilon tag-theta tag-alpha)
+        (values 94989 56525 50854 28025 95528 72494))
+    ;; record 230, exported from table beta
+    (record-beta
+        (id 230)
+        (description "omega omega epsilon kappa sigma lambda beta theta")
+        (payload "zeta alpha theta epsilon theta lambda lambda epsilon zeta delta epsilon omega gamma epsilon theta zeta")
+        (tags tag-lambda tag-gamma tag-lambda tag-kappa)
+        (values 490 50139 63966 5335 82120 18329))
+    ;; record 231, exported from table beta
+    (record-kappa
+        (id 231)
+        (description "sigma kappa zeta delta zeta omega theta gamma")
+        (payload "zeta gamma kappa beta lambda epsilon gamma omega beta delta omega kappa lambda alpha gamma alpha")
+        (tags tag-sigma tag-delta tag-kappa tag-sigma)
+        (values 67441 14534 97131 89406 83339 48956))
+    ;; record 232, exported from table gamma
+    (record-beta
+        (id 232)
+        (description "beta lambda sigma theta beta kappa lambda lambda")
+        (payload "alpha gamma kappa beta gamma epsilon epsilon omega lambda zeta delta zeta delta beta gamma sigma")
+        (tags tag-kappa tag-kappa tag-theta tag-alpha)
+        (values 22888 59448 46706 37163 80102 63995))
+    ;; record 233, exported from table gamma
+    (record-alpha
+        (id 233)
+        (description "alpha gamma kappa epsilon alpha gamma zeta delta")
+        (payload "gamma sigma kappa epsilon gamma sigma zeta zeta delta kappa omega kappa sigma lambda alpha epsilon")
+        (tags tag-lambda tag-alpha tag-lambda tag-epsilon)
+        (values 39790 7048 78749 24940 7280 28119))
+    ;; record 234, exported from table delta
+    (record-epsilon
+        (id 234)
+        (description "kappa epsilon gamma sigma kappa alpha kappa lambda")
+        (payload "theta gamma omega beta delta kappa sigma alpha gamma alpha lambda kappa kappa zeta epsilon alpha")
+        (tags tag-kappa tag-sigma tag-kappa tag-kappa)
+        (values 38766 36947 54481 77154 8817 41987))
+    ;; record 235, exported from table beta
+    (record-sigma
+        (id 235)
+        (description "alpha omega epsilon omega alpha theta zeta omega")
+        (payload "sigma epsilon omega delta epsilon lambda theta zeta delta sigma kappa gamma alpha alpha lambda beta")
+        (tags tag-alpha tag-omega tag-gamma tag-lambda)
+        (values 50422 19597 16289 71092 41050 51032))
+    ;; record 236, exported from table beta
+    (record-sigma
+        (id 236)
+        (description "theta delta sigma gamma alpha theta lambda epsilon")
+        (payload "theta kappa theta kappa omega lambda epsilon sigma theta epsilon sigma delta theta omega kappa beta")
+        (tags tag-alpha tag-delta tag-lambda tag-kappa)
+        (values 78910 69641 16013 56502 83018 85825))
+    ;; record 237, exported from table gamma
+    (record-kappa
+        (id 237)
+        (description "lambda epsilon epsilon zeta kappa beta kappa sigma")
+        (payload "sigma sigma beta gamma kappa lambda theta lambda alpha alpha gamma delta gamma omega zeta alpha")
+        (tags tag-theta tag-delta tag-epsilon tag-sigma)
+        (values 18170 6439 85793 90721 72639 37451))
+    ;; record 238, exported from table zeta
+    (record-omega
+        (id 238)
+        (description "omega sigma lambda omega sigma delta lambda zeta")
+        (payload "epsilon theta lambda beta lambda alpha alpha gamma sigma theta theta zeta kappa theta sigma omega")
+        (tags tag-beta tag-theta tag-alpha tag-epsilon)
+        (values 66932 41374 16766 11296 87430 48595))
+    ;; record 239, exported from table delta
+    (record-lambda
+        (id 239)
+        (description "beta sigma epsilon omega beta epsilon beta alpha")
+        (payload "theta theta alpha kappa gamma beta sigma sigma alpha lambda gamma beta lambda epsilon zeta sigma")
+        (tags tag-sigma tag-kappa tag-alpha tag-lambda)
+        (values 57576 99876 58862 51750 24088 56379))
+    ;; record 240, exported from table theta
+    (record-delta
+        (id 240)
+        (description "alpha alpha delta sigma zeta sigma beta gamma")
+        (payload "zeta omega omega theta lambda beta lambda sigma zeta omega epsilon gamma sigma epsilon beta zeta")
+        (tags tag-kappa tag-omega tag-zeta tag-gamma)
+        (values 98409 84244 76229 76952 79130 27833))
+    ;; record 241, exported from table alpha
+    (record-kappa
+        (id 241)
+        (description "epsilon epsilon theta beta epsilon epsilon beta omega")
+        (payload "beta theta lambda epsilon kappa lambda theta lambda beta theta epsilon gamma kappa delta sigma kappa")
+        (tags tag-lambda tag-omega tag-gamma tag-lambda)
+        (values 95788 25459 69941 66801 82891 87366))
+    ;; record 242, exported from table epsilon
+    (record-alpha
+        (id 242)
+        (description "kappa theta kappa gamma kappa omega delta omega")
+        (payload "beta beta omega gamma gamma delta lambda theta delta lambda sigma gamma kappa delta omega lambda")
+        (tags tag-epsilon tag-lambda tag-zeta tag-kappa)
+        (values 67287 80044 10275 8979 85734 42338))
+    ;; record 243, exported from table lambda
+    (record-epsilon
+        (id 243)
+        (description "delta zeta delta omega delta theta kappa zeta")
+        (payload "sigma lambda alpha theta sigma gamma zeta delta lambda beta lambda lambda alpha theta epsilon gamma")
+        (tags tag-zeta tag-sigma tag-kappa tag-beta)
+        (values 81340 19611 17964 84040 29158 11414))
+    ;; record 244, exported from table lambda
+    (record-zeta
+        (id 244)
+        (description "delta beta kappa beta omega zeta zeta kappa")
+        (payload "gamma omega sigma theta omega kappa delta kappa beta theta sigma sigma zeta alpha kappa theta")
+        (tags tag-delta tag-theta tag-kappa tag-gamma)
+        (values 75448 15759 40563 17154 83169 3991))
+    ;; record 245, exported from table theta
+    (record-lambda
+        (id 245)
+        (description "kappa lambda zeta sigma theta gamma lambda delta")
+        (payload "zeta sigma kappa kappa delta sigma beta zeta lambda delta theta beta alpha kappa theta omega")
+        (tags tag-lambda tag-lambda tag-delta tag-sigma)
+        (values 98066 69229 67458 20803 4497 18061))
+    ;; record 246, exported from table delta
+    (record-zeta
+        (id 246)
+        (description "delta sigma delta alpha theta delta beta zeta")
+        (payload "epsilon lambda delta zeta delta lambda kappa gamma beta gamma epsilon gamma beta alpha zeta lambda")
+        (tags tag-delta tag-zeta tag-delta tag-epsilon)
+        (values 26174 17875 70504 97610 14070 63043))
+    ;; record 247, exported from table zeta
+    (record-theta
+        (id 247)
+        (description "lambda omega alpha theta kappa beta kappa lambda")
+        (payload "epsilon gamma kappa omega theta alpha delta kappa gamma omega zeta kappa epsilon sigma epsilon lambda")
+        (tags tag-zeta tag-alpha tag-sigma tag-gamma)
+        (values 41170 39651 17522 1217 30784 88193))
+    ;; record 248, exported from table gamma
+    (record-sigma
+        (id 248)
+        (description "omega alpha zeta kappa theta lambda omega delta")
+        (payload "delta zeta theta delta kappa beta omega alpha epsilon epsilon delta epsilon zeta delta omega zeta")
+        (tags tag-gamma tag-delta tag-theta tag-delta)
+        (values 53549 40653 22656 64302 21715 75944))
+    ;; record 249, exported from table beta
+    (record-theta
+        (id 249)
+        (description "delta sigma omega zeta kappa delta beta lambda")
+        (payload "lambda gamma zeta theta epsilon beta alpha alpha delta beta beta gamma gamma sigma gamma kappa")
+        (tags tag-beta tag-gamma tag-omega tag-lambda)
+        (values 46429 57177 98932 24239 44451 48051))
+    ;; record 250, exported from table beta
+    (record-omega
+        (id 250)
+        (description "delta alpha sigma beta theta gamma beta epsilon")
+        (payload "theta theta alpha omega theta delta zeta theta gamma gamma theta gamma gamma alpha kappa kappa")
+        (tags tag-epsilon tag-zeta tag-delta tag-delta)
+        (values 55951 80027 94746 42091 12876 20676))
+    ;; record 251, exported from table lambda
+    (record-alpha
+        (id 251)
+        (description "theta omega zeta lambda delta zeta omega sigma")
+        (payload "zeta lambda lambda epsilon omega alpha gamma omega alpha sigma kappa beta zeta alpha alpha theta")
+        (tags tag-theta tag-delta tag-sigma tag-theta)
+        (values 85892 96190 83494 92791 32268 65514))
+    ;; record 252, exported from table gamma
+    (record-delta
+        (id 252)
+        (description "sigma epsilon lambda gamma sigma lambda omega epsilon")
+        (payload "zeta omega omega theta beta beta delta kappa kappa kappa theta zeta omega omega zeta sigma")
+        (tags tag-lambda tag-omega tag-sigma tag-beta)
+        (values 95899 66779 41631 4040 31326 92393))
+    ;; record 253, exported from table lambda
+    (record-epsilon
+        (id 253)
+        (description "epsilon epsilon omega gamma alpha omega omega gamma")
+        (payload "theta kappa gamma gamma beta zeta delta sigma kappa delta alpha sigma theta kappa alpha zeta")
+        (tags tag-beta tag-gamma tag-theta tag-theta)
+        (values 81033 78972 87647 43592 74195 25008))
+    ;; record 254, exported from table omega
+    (record-alpha
+        (id 254)
+        (description "gamma epsilon sigma zeta omega sigma gamma theta")
+        (payload "sigma sigma kappa epsilon alpha beta delta alpha kappa epsilon epsilon omega omega gamma omega gamma")
+        (tags tag-alpha tag-epsilon tag-lambda tag-sigma)
+        (values 84329 51812 24823 92276 49711 90274))
+    ;; record 255, exported from table kappa
+    (record-alpha
+        (id 255)
+        (description "omega gamma lambda kappa epsilon kappa epsilon theta")
+        (payload "gamma lambda gamma theta delta beta delta kappa zeta epsilon lambda zeta zeta zeta beta omega")
+        (tags tag-lambda tag-epsilon tag-alpha tag-sigma)
+        (values 72880 22013 14428 60449 71990 770))
+    ;; record 256, exported from table sigma
+    (record-epsilon
+        (id 256)
+        (description "zeta gamma delta kappa delta gamma sigma lambda")
+        (payload "sigma lambda sigma zeta epsilon sigma epsilon kappa lambda lambda omega epsilon beta beta delta kappa")
+        (tags tag-gamma tag-alpha tag-omega tag-omega)
+        (values 73451 7894 27855 13026 37858 56853))
+    ;; record 257, exported from table lambda
+    (record-sigma
+        (id 257)
+        (description "epsilon beta beta omega zeta omega omega delta")
+        (payload "sigma beta theta lambda lambda epsilon alpha kappa omega epsilon sigma omega epsilon zeta lambda sigma")
+        (tags tag-lambda tag-sigma tag-theta tag-zeta)
+        (values 14547 94283 21101 70906 90897 32581))
+    ;; record 258, exported from table theta
+    (record-lambda
+        (id 258)
+        (description "epsilon gamma zeta lambda delta beta theta delta")
+        (payload "zeta lambda epsilon sigma lambda zeta alpha kappa omega zeta beta lambda theta beta theta omega")
+        (tags tag-lambda tag-alpha tag-delta tag-alpha)
+        (values 11548 36128 14247 81237 25275 75238))
+    ;; record 259, exported from table sigma
+    (record-alpha
+        (id 259)
+        (description "lambda lambda alpha epsilon gamma omega gamma epsilon")
+        (payload "sigma epsilon sigma delta theta kappa beta theta beta gamma omega alpha alpha theta zeta beta")
+        (tags tag-delta tag-lambda tag-omega tag-alpha)
+        (values 81562 11707 45621 86912 633 67478))
+    ;; record 260, exported from table omega
+    (record-gamma
+        (id 260)
+        (description "beta delta epsilon sigma sigma epsilon theta beta")
+        (payload "alpha omega zeta omega lambda alpha kappa alpha zeta sigma beta epsilon delta beta gamma lambda")
+        (tags tag-kappa tag-lambda tag-zeta tag-delta)
+        (values 48128 -177 78235 37939 90183 68019))
+    ;; record 261, exported from table omega
+    (record-omega
+        (id 261)
+        (description "omega epsilon alpha beta theta gamma delta epsilon")
+        (payload "zeta gamma gamma lambda beta beta epsilon kappa delta omega beta epsilon alpha alpha theta delta")
+        (tags tag-epsilon tag-zeta tag-delta tag-kappa)
+        (values 4557 44126 44138 27791 57009 9916))
+    ;; record 262, exported from table lambda
+    (record-omega
+        (id 262)
+        (description "gamma beta sigma beta delta epsilon lambda zeta")
+        (payload "kappa theta omega delta omega zeta zeta gamma kappa zeta epsilon kappa lambda delta epsilon alpha")
+        (tags tag-epsilon tag-delta tag-kappa tag-theta)
+        (values 41107 34006 3278 49448 86030 52431))
+    ;; record 263, exported from table beta
+    (record-gamma
+        (id 263)
+        (description "kappa epsilon lambda omega delta beta kappa delta")
+        (payload "zeta omega beta lambda sigma omega delta sigma epsilon sigma theta lambda alpha beta lambda beta")
+        (tags tag-delta tag-alpha tag-theta tag-alpha)
+        (values 71629 41329 89640 19499 8006 68523))
+    ;; record 264, exported from table sigma
+    (record-epsilon
+        (id 264)
+        (description "epsilon zeta sigma lambda zeta omega kappa alpha")
+        (payload "alpha alpha theta beta omega kappa sigma omega kappa alpha epsilon kappa alpha kappa gamma omega")
+        (tags tag-delta tag-lambda tag-epsilon tag-alpha)
+        (values 51135 44280 13744 49232 95942 85461))
+    ;; record 265, exported from table epsilon
+    (record-epsilon
+        (id 265)
+        (description "sigma lambda omega lambda omega kappa beta delta")
+        (payload "delta delta omega epsilon beta kappa sigma alpha alpha delta zeta gamma sigma lambda theta omega")
+        (tags tag-alpha tag-theta tag-omega tag-delta)
+        (values 12928 38521 8005 33439 14401 26286))
+    ;; record 266, exported from table epsilon
+    (record-delta
+        (id 266)
+        (description "lambda theta alpha epsilon zeta zeta lambda lambda")
+        (payload "lambda sigma delta sigma beta lambda theta delta epsilon alpha delta delta zeta gamma alpha alpha")
+        (tags tag-omega tag-lambda tag-delta tag-omega)
+        (values 43207 17117 33927 55109 50120 1528))
+    ;; record 267, exported from table omega
+    (record-sigma
+        (id 267)
+        (description "delta zeta kappa kappa zeta theta sigma kappa")
+        (payload "gamma kappa theta lambda epsilon lambda epsilon zeta omega zeta delta kappa theta omega lambda omega")
+        (tags tag-lambda tag-alpha tag-omega tag-sigma)
+        (values 54309 36668 64377 37228 92507 90970))
+    ;; record 268, exported from table lambda
+    (record-beta
+        (id 268)
+        (description "alpha kappa zeta lambda alpha delta beta delta")
+        (payload "epsilon omega sigma delta beta omega alpha theta epsilon kappa gamma sigma kappa theta sigma lambda")
+        (tags tag-alpha tag-sigma tag-lambda tag-alpha)
+        (values 63758 9585 10808 72942 82806 11783))
+    ;; record 269, exported from table beta
+    (record-lambda
+        (id 269)
+        (description "sigma zeta gamma omega alpha zeta lambda gamma")
+        (payload "sigma zeta kappa zeta beta alpha lambda theta beta lambda zeta beta alpha epsilon epsilon epsilon")
+        (tags tag-theta tag-alpha tag-delta tag-gamma)
+        (values 70344 42421 39516 54611 -383 18156))
+    ;; record 270, exported from table epsilon
+    (record-gamma
+        (id 270)
+        (description "alpha alpha lambda gamma epsilon delta beta epsilon")
+        (payload "lambda sigma delta theta delta kappa beta gamma beta zeta epsilon lambda sigma alpha omega alpha")
+        (tags tag-gamma tag-alpha tag-alpha tag-kappa)
+        (values 53504 2045 11657 94526 88002 51176))
+    ;; record 271, exported from table kappa
+    (record-alpha
+        (id 271)
+        (description "lambda zeta omega sigma epsilon epsilon zeta gamma")
+        (payload "alpha delta delta beta alpha epsilon zeta omega alpha theta alpha delta gamma alpha kappa lambda")
+        (tags tag-sigma tag-gamma tag-sigma tag-beta)
+        (values 46285 2201 53830 99973 95497 86808))
+    ;; record 272, exported from table theta
+    (record-beta
+        (id 272)
+        (description "lambda beta lambda epsilon omega lambda epsilon delta")
+        (payload "epsilon kappa gamma beta delta zeta gamma lambda epsilon alpha kappa omega gamma epsilon sigma gamma")
+        (tags tag-sigma tag-beta tag-gamma tag-beta)
+        (values 13762 71523 36541 25335 81366 112))
+    ;; record 273, exported from table alpha
+    (record-alpha
+        (id 273)
+        (description "theta lambda gamma sigma lambda alpha lambda alpha")
+        (payload "epsilon gamma theta omega zeta kappa omega kappa lambda lambda omega epsilon beta theta omega theta")
+        (tags tag-sigma tag-gamma tag-lambda tag-omega)
+        (values 84053 61260 90050 98424 80489 35545))
+    ;; record 274, exported from table sigma
+    (record-zeta
+        (id 274)
+        (description "delta gamma alpha theta theta gamma theta gamma")
+        (payload "theta epsilon gamma alpha epsilon lambda kappa beta epsilon alpha theta gamma beta zeta alpha theta")
+        (tags tag-alpha tag-gamma tag-theta tag-alpha)
+        (values 76878 96728 42365 35394 24633 57465))
+    ;; record 275, exported from table alpha
+    (record-lambda
+        (id 275)
+        (description "gamma kappa omega omega lambda epsilon lambda epsilon")
+        (payload "lambda zeta kappa gamma delta delta sigma alpha beta gamma alpha lambda theta theta theta kappa")
+        (tags tag-omega tag-sigma tag-epsilon tag-beta)
+        (values 44457 40649 94277 34444 15538 22623))
+    ;; record 276, exported from table lambda
+    (record-beta
+        (id 276)
+        (description "delta alpha lambda sigma beta delta omega alpha")
+        (payload "lambda theta zeta alpha alpha gamma sigma kappa theta delta theta omega delta omega sigma beta")
+        (tags tag-zeta tag-zeta tag-kappa tag-delta)
+        (values 17215 30125 20457 43494 93844 59089))
+    ;; record 277, exported from table alpha
+    (record-theta
+        (id 277)
+        (description "zeta lambda gamma alpha gamma sigma lambda alpha")
+        (payload "beta lambda epsilon sigma beta omega sigma beta sigma beta epsilon theta zeta alpha kappa delta")
+        (tags tag-zeta tag-delta tag-epsilon tag-omega)
+        (values 90443 43728 27125 65815 46992 12663))
+    ;; record 278, exported from table gamma
+    (record-lambda
+        (id 278)
+        (description "gamma epsilon beta delta kappa theta kappa zeta")
+        (payload "theta delta zeta gamma beta omega theta beta omega sigma epsilon sigma theta beta lambda alpha")
+        (tags tag-beta tag-delta tag-omega tag-sigma)
+        (values 61748 47074 28948 58637 97208 44385))
+    ;; record 279, exported from table beta
+    (record-sigma
+        (id 279)
+        (description "beta epsilon epsilon kappa delta beta alpha lambda")
+        (payload "sigma sigma alpha theta theta kappa alpha kappa lambda epsilon beta omega sigma epsilon omega omega")
+        (tags tag-gamma tag-delta tag-epsilon tag-delta)
+        (values 50843 34212 95031 65200 77596 41874))
+    ;; record 280, exported from table lambda
+    (record-omega
+        (id 280)
+        (description "theta kappa theta alpha epsilon lambda beta gamma")
+        (payload "beta theta sigma alpha omega epsilon lambda kappa lambda kappa alpha beta beta beta zeta sigma")
+        (tags tag-zeta tag-delta tag-delta tag-beta)
+        (values 27189 60650 8609 99021 60869 73251))
+    ;; record 281, exported from table theta
+    (record-zeta
+        (id 281)
+        (description "gamma sigma zeta epsilon epsilon theta sigma gamma")
+        (payload "alpha beta delta epsilon theta omega sigma kappa lambda sigma kappa delta delta lambda theta gamma")
+        (tags tag-delta tag-gamma tag-delta tag-alpha)
+        (values 39919 57693 56405 58416 59307 47067))
+    ;; record 282, exported from table omega
+    (record-theta
+        (id 282)
+        (description "delta omega gamma kappa sigma sigma theta alpha")
+        (payload "theta gamma kappa gamma gamma delta omega beta kappa omega omega lambda alpha zeta theta sigma")
+        (tags tag-omega tag-theta tag-gamma tag-omega)
+        (values 58686 42026 30161 50364 40542 4128))
+    ;; record 283, exported from table alpha
+    (record-epsilon
+        (id 283)
+        (description "zeta alpha zeta zeta epsilon beta kappa alpha")
+        (payload "theta beta sigma gamma alpha alpha gamma alpha delta zeta theta omega lambda gamma lambda theta")
+        (tags tag-delta tag-beta tag-beta tag-delta)
+        (values 64510 72634 78448 27003 93032 9168))
+    ;; record 284, exported from table kappa
+    (record-theta
+        (id 284)
+        (description "sigma theta zeta epsilon alpha omega beta gamma")
+        (payload "theta alpha zeta sigma epsilon gamma beta theta theta lambda kappa epsilon kappa kappa gamma gamma")
+        (tags tag-kappa tag-beta tag-lambda tag-zeta)
+        (values 648 70274 95304 49567 81088 73484))
+    ;; record 285, exported from table theta
+    (record-omega
+        (id 285)
+        (description "epsilon alpha delta kappa kappa beta sigma beta")
+        (payload "sigma delta alpha omega kappa beta gamma alpha sigma theta theta theta alpha theta alpha omega")
+        (tags tag-alpha tag-theta tag-theta tag-alpha)
+        (values 2703 96185 52956 50171 16911 79041))
+    ;; record 286, exported from table sigma
+    (record-lambda
+        (id 286)
+        (description "zeta theta sigma gamma sigma kappa lambda alpha")
+        (payload "omega zeta kappa alpha beta epsilon alpha alpha zeta lambda alpha alpha epsilon alpha epsilon theta")
+        (tags tag-alpha tag-epsilon tag-lambda tag-omega)
+        (values 61847 50066 37149 82246 20085 9823))
+    ;; record 287, exported from table lambda
+    (record-omega
+        (id 287)
+        (description "gamma epsilon lambda alpha gamma sigma zeta sigma")
+        (payload "alpha theta kappa theta sigma zeta gamma alpha kappa omega delta alpha zeta beta alpha delta")
+        (tags tag-delta tag-kappa tag-alpha tag-sigma)
+        (values 79920 67810 66539 28718 14049 63294))
+    ;; record 288, exported from table theta
+    (record-sigma
+        (id 288)
+        (description "alpha delta epsilon omega lambda alpha zeta delta")
+        (payload "delta epsilon lambda gamma beta omega beta delta sigma theta delta omega alpha alpha alpha theta")
+        (tags tag-alpha tag-theta tag-delta tag-lambda)
+        (values -617 50407 75594 84842 41786 10565))
+    ;; record 289, exported from table kappa
+    (record-epsilon
+        (id 289)
+        (description "beta kappa delta epsilon gamma kappa theta delta")
+        (payload "kappa kappa lambda sigma epsilon beta delta alpha alpha theta theta delta lambda epsilon zeta kappa")
+        (tags tag-beta tag-epsilon tag-zeta tag-delta)
+        (values 39648 3228 60171 37859 4970 67807))
+    ;; record 290, exported from table omega
+    (record-alpha
+        (id 290)
+        (description "gamma delta epsilon omega epsilon zeta gamma gamma")
+        (payload "delta omega alpha zeta alpha delta lambda theta alpha sigma sigma epsilon delta lambda gamma kappa")
+        (tags tag-sigma tag-alpha tag-lambda tag-lambda)
+        (values 87924 54845 43027 31683 88401 83959))
+    ;; record 291, exported from table epsilon
+    (record-sigma
+        (id 291)
+        (description "kappa kappa theta theta sigma epsilon epsilon alpha")
+        (payload "gamma omega beta lambda kappa beta kappa epsilon lambda omega gamma beta epsilon kappa beta kappa")
+        (tags tag-gamma tag-gamma tag-epsilon tag-alpha)
+        (values 15613 99335 9733 84873 6694 50196))
+    ;; record 292, exported from table kappa
+    (record-omega
+        (id 292)
+        (description "omega zeta delta beta zeta epsilon epsilon gamma")
+        (payload "alpha zeta alpha lambda kappa gamma beta lambda theta lambda sigma beta gamma beta gamma epsilon")
+        (tags tag-delta tag-epsilon tag-theta tag-epsilon)
+        (values 95754 10920 69672 36941 78708 66099))
+    ;; record 293, exported from table gamma
+    (record-delta
+        (id 293)
+        (description "beta omega theta beta lambda theta lambda lambda")
+        (payload "lambda epsilon sigma zeta epsilon alpha beta gamma theta zeta kappa lambda zeta theta kappa epsilon")
+        (tags tag-gamma tag-gamma tag-delta tag-epsilon)
+        (values 83935 23801 2940 65844 92038 48661))
+    ;; record 294, exported from table gamma
+    (record-gamma
+        (id 294)
+        (description "zeta sigma gamma gamma lambda theta alpha gamma")
+        (payload "alpha gamma zeta sigma theta sigma kappa omega epsilon sigma lambda gamma alpha kappa epsilon epsilon")
+        (tags tag-delta tag-beta tag-alpha tag-lambda)
+        (values 72327 32655 33626 41140 18671 78000))
+    ;; record 295, exported from table sigma
+    (record-theta
+        (id 295)
+        (description "beta beta theta theta beta lambda sigma kappa")
+        (payload "theta kappa lambda kappa theta gamma theta gamma delta zeta zeta epsilon kappa theta alpha kappa")
+        (tags tag-delta tag-beta tag-beta tag-sigma)
+        (values 28307 65275 242 17956 46338 58882))
+    ;; record 296, exported from table lambda
+    (record-sigma
+        (id 296)
+        (description "epsilon delta omega sigma zeta delta omega gamma")
+        (payload "kappa epsilon zeta kappa kappa zeta epsilon delta zeta omega beta epsilon theta kappa theta lambda")
+        (tags tag-omega tag-delta tag-omega tag-kappa)
+        (values 89155 62468 82297 14976 24986 79144))
+    ;; record 297, exported from table delta
+    (record-delta
+        (id 297)
+        (description "kappa alpha kappa epsilon delta zeta beta gamma")
+        (payload "theta beta beta zeta sigma omega delta kappa epsilon beta epsilon kappa alpha sigma gamma theta")
+        (tags tag-beta tag-zeta tag-alpha tag-omega)
+        (values 7705 20755 31404 1925 87878 63729))
+    ;; record 298, exported from table gamma
+    (record-omega
+        (id 298)
+        (description "gamma beta zeta delta epsilon delta gamma delta")
+        (payload "theta gamma omega gamma gamma zeta delta omega kappa theta omega theta gamma beta lambda theta")
+        (tags tag-lambda tag-gamma tag-kappa tag-beta)
+        (values 49731 6023 6297 31003 61068 67595))
+    ;; record 299, exported from table delta
+    (record-omega
+        (id 299)
+        (description "sigma kappa theta alpha delta delta beta lambda")
+        (payload "epsilon delta zeta kappa omega delta zeta epsilon gamma beta gamma sigma omega beta delta gamma")
+        (tags tag-gamma tag-kappa tag-lambda tag-omega)
+        (values 85795 87899 67619 37447 17841 50733))
+    ;; record 300, exported from table alpha
+    (record-sigma
+        (id 300)
+        (description "alpha zeta sigma beta delta delta epsilon kappa")
+        (payload "lambda alpha delta beta zeta theta theta kappa omega alpha kappa theta zeta kappa sigma delta")
+        (tags tag-beta tag-sigma tag-omega tag-omega)
+        (values 20901 13468 97532 30435 77615 59198))
+    ;; record 301, exported from table zeta
+    (record-alpha
+        (id 301)
+        (description "kappa omega beta kappa delta theta alpha kappa")
+        (payload "zeta lambda sigma alpha zeta gamma gamma alpha sigma omega omega delta sigma omega delta delta")
+        (tags tag-beta tag-lambda tag-sigma tag-beta)
+        (values 1961 86709 83809 75643 54913 81310))
+    ;; record 302, exported from table delta
+    (record-zeta
+        (id 302)
+        (description "theta delta alpha zeta delta epsilon theta zeta")
+        (payload "omega delta omega lambda epsilon sigma beta gamma kappa epsilon theta delta omega gamma gamma omega")
+        (tags tag-epsilon tag-sigma tag-delta tag-alpha)
+        (values 3952 29137 41776 24107 54430 37897))
+    ;; record 303, exported from table beta
+    (record-theta
+        (id 303)
+        (description "alpha alpha lambda theta beta delta beta beta")
+        (payload "delta omega gamma epsilon zeta theta theta alpha delta delta sigma omega gamma gamma alpha zeta")
+        (tags tag-theta tag-alpha tag-alpha tag-zeta)
+        (values 49708 23911 81580 13704 5324 97362))
+    ;; record 304, exported from table theta
+    (record-kappa
+        (id 304)
+        (description "kappa delta omega delta omega epsilon kappa gamma")
+        (payload "beta lambda beta zeta gamma zeta omega sigma beta alpha beta zeta omega zeta gamma sigma")
+        (tags tag-zeta tag-beta tag-gamma tag-alpha)
+        (values 43609 21877 -480 17474 49533 62575))
+    ;; record 305, exported from table gamma
+    (record-lambda
+        (id 305)
+        (description "gamma delta beta omega gamma omega omega delta")
+        (payload "omega gamma zeta zeta epsilon theta kappa delta alpha theta beta beta gamma lambda beta delta")
+        (tags tag-theta tag-delta tag-gamma tag-sigma)
+        (values 47328 17258 44569 69657 72683 56445))
+    ;; record 306, exported from table sigma
+    (record-omega
+        (id 306)
+        (description "gamma lambda theta delta alpha epsilon delta kappa")
+        (payload "alpha epsilon omega theta kappa omega omega delta kappa gamma zeta alpha omega theta sigma delta")
+        (tags tag-lambda tag-zeta tag-delta tag-sigma)
+        (values 60734 92321 99518 29235 82593 8616))
+    ;; record 307, exported from table delta
+    (record-theta
+        (id 307)
+        (description "beta delta theta delta delta beta delta sigma")
+        (payload "delta sigma lambda kappa zeta sigma lambda sigma alpha theta beta kappa zeta kappa epsilon beta")
+        (tags tag-delta tag-sigma tag-alpha tag-omega)
+        (values 42607 30274 73758 71189 15131 66171))
+    ;; record 308, exported from table lambda
+    (record-delta
+        (id 308)
+        (description "sigma zeta omega omega lambda gamma kappa omega")
+        (payload "zeta gamma gamma gamma alpha beta epsilon gamma alpha zeta alpha zeta sigma gamma zeta epsilon")
+        (tags tag-delta tag-lambda tag-lambda tag-zeta)
+        (values 20592 75374 42950 95642 -742 98794))
+    ;; record 309, exported from table gamma
+    (record-alpha
+        (id 309)
+        (description "alpha epsilon delta epsilon delta zeta beta lambda")
+        (payload "theta beta omega beta gamma sigma beta gamma zeta delta gamma delta beta beta sigma delta")
+        (tags tag-zeta tag-beta tag-sigma tag-delta)
+        (values 86661 80402 1929 80387 11852 19938))
+    ;; record 310, exported from table omega
+    (record-lambda
+        (id 310)
+        (description "theta lambda kappa zeta gamma gamma delta zeta")
+        (payload "gamma kappa epsilon beta lambda delta kappa omega delta zeta delta sigma gamma alpha omega epsilon")
+        (tags tag-gamma tag-kappa tag-sigma tag-lambda)
+        (values 71516 13777 9517 46556 21176 28391))
+    ;; record 311, exported from table epsilon
+    (record-epsilon
+        (id 311)
+        (description "gamma beta kappa alpha delta theta epsilon sigma")
+        (payload "epsilon theta gamma delta epsilon beta delta delta alpha delta delta theta omega sigma omega kappa")
+        (tags tag-theta tag-omega tag-gamma tag-omega)
+        (values 30192 23385 46132 64668 63168 98770))
+    ;; record 312, exported from table zeta
+    (record-lambda
+        (id 312)
+        (description "zeta theta sigma delta delta kappa gamma omega")
+        (payload "lambda alpha zeta sigma zeta delta sigma theta alpha sigma epsilon omega theta alpha omega kappa")
+        (tags tag-zeta tag-kappa tag-omega tag-alpha)
+        (values 27416 57796 45628 60729 69208 2979))
+    ;; record 313, exported from table delta
+    (record-epsilon
+        (id 313)
+        (description "zeta epsilon zeta epsilon delta beta gamma zeta")
+        (payload "omega alpha lambda sigma gamma omega omega gamma beta epsilon omega omega kappa sigma zeta sigma")
+        (tags tag-epsilon tag-delta tag-delta tag-beta)
+        (values 89635 77387 30644 85306 99864 16694))
+    ;; record 314, exported from table lambda
+    (record-zeta
+        (id 314)
+        (description "delta zeta gamma gamma omega lambda theta kappa")
+        (payload "zeta gamma beta sigma sigma epsilon beta kappa delta zeta sigma beta epsilon lambda theta beta")
+        (tags tag-zeta tag-theta tag-epsilon tag-lambda)
+        (values 5204 89823 76324 57360 80551 88614))
+    ;; record 315, exported from table zeta
+    (record-alpha
+        (id 315)
+        (description "gamma alpha lambda theta gamma zeta kappa alpha")
+        (payload "alpha sigma delta zeta epsilon sigma theta omega sigma delta kappa epsilon gamma sigma epsilon zeta")
+        (tags tag-epsilon tag-theta tag-omega tag-alpha)
+        (values 59934 55796 78690 41912 9760 3156))
+    ;; record 316, exported from table kappa
+    (record-beta
+        (id 316)
+        (description "epsilon epsilon sigma epsilon zeta lambda epsilon beta")
+        (payload "kappa omega gamma sigma sigma zeta kappa epsilon sigma alpha theta beta gamma kappa sigma epsilon")
+        (tags tag-epsilon tag-alpha tag-alpha tag-omega)
+        (values 66256 14563 18827 72627 48625 20434))
+    ;; record 317, exported from table sigma
+    (record-zeta
+        (id 317)
+        (description "gamma zeta epsilon sigma delta sigma sigma theta")
+        (payload "beta epsilon sigma zeta kappa sigma alpha beta delta alpha sigma beta alpha delta sigma sigma")
+        (tags tag-alpha tag-delta tag-kappa tag-epsilon)
+        (values 64669 65673 71027 67032 43525 81816))
+    ;; record 318, exported from table sigma
+    (record-kappa
+        (id 318)
+        (description "beta zeta gamma beta kappa kappa lambda theta")
+        (payload "theta gamma beta beta lambda kappa lambda epsilon lambda gamma lambda kappa kappa omega lambda zeta")
+        (tags tag-beta tag-zeta tag-lambda tag-alpha)
+        (values 2814 3340 35090 30547 27978 10089))
+    ;; record 319, exported from table kappa
+    (record-alpha
+        (id 319)
+        (description "alpha lambda zeta beta gamma epsilon alpha zeta")
+        (payload "theta beta delta delta gamma zeta delta epsilon alpha alpha delta beta kappa alpha epsilon lambda")
+        (tags tag-lambda tag-alpha tag-omega tag-epsilon)
+        (values 98798 73670 87829 64079 82110 21077))
+    ;; record 320, exported from table kappa
+    (record-theta
+        (id 320)
+        (description "delta epsilon beta alpha epsilon epsilon theta kappa")
+        (payload "kappa delta beta sigma omega delta lambda kappa lambda gamma zeta lambda beta beta zeta alpha")
+        (tags tag-omega tag-zeta tag-zeta tag-omega)
+        (values 71180 29245 15174 1233 23379 31164))
+    ;; record 321, exported from table alpha
+    (record-omega
+        (id 321)
+        (description "theta delta sigma zeta sigma gamma alpha zeta")
+        (payload "lambda beta zeta alpha gamma beta sigma gamma alpha sigma lambda sigma zeta theta delta beta")
+        (tags tag-kappa tag-beta tag-sigma tag-alpha)
+        (values 57519 93086 75910 22395 -312 6365))
+    ;; record 322, exported from table delta
+    (record-lambda
+        (id 322)
+        (description "alpha delta epsilon alpha epsilon gamma kappa lambda")
+        (payload "delta gamma omega omega lambda sigma theta gamma gamma alpha theta zeta alpha gamma gamma delta")
+        (tags tag-epsilon tag-alpha tag-sigma tag-delta)
+        (values 1986 86084 27276 82300 58051 14625))
+    ;; record 323, exported from table theta
+    (record-beta
+        (id 323)
+        (description "zeta lambda sigma gamma kappa gamma theta omega")
+        (payload "theta lambda gamma delta beta alpha delta beta sigma kappa theta zeta alpha sigma sigma alpha")
+        (tags tag-lambda tag-omega tag-alpha tag-alpha)
+        (values 14673 40790 96907 77759 48510 8031))
+    ;; record 324, exported from table gamma
+    (record-alpha
+        (id 324)
+        (description "omega kappa epsilon theta sigma kappa epsilon theta")
+        (payload "gamma theta alpha epsilon theta gamma delta sigma omega omega theta theta alpha alpha sigma kappa")
+        (tags tag-sigma tag-delta tag-sigma tag-zeta)
+        (values 31677 18136 63816 93004 8498 93175))
+    ;; record 325, exported from table beta
+    (record-lambda
+        (id 325)
+        (description "gamma sigma zeta alpha kappa delta lambda alpha")
+        (payload "sigma beta zeta beta delta beta lambda sigma alpha kappa zeta gamma lambda beta beta lambda")
+        (tags tag-epsilon tag-alpha tag-delta tag-delta)
+        (values 13198 66350 85021 30275 37110 2899))
+    ;; record 326, exported from table kappa
+    (record-sigma
+        (id 326)
+        (description "sigma epsilon beta sigma alpha alpha kappa alpha")
+        (payload "theta lambda sigma alpha sigma omega lambda theta omega delta beta omega alpha delta omega beta")
+        (tags tag-sigma tag-alpha tag-omega tag-zeta)
+        (values 70914 3528 23050 72613 15515 39532))
+    ;; record 327, exported from table beta
+    (record-lambda
+        (id 327)
+        (description "delta lambda beta sigma beta sigma kappa delta")
+        (payload "kappa alpha beta epsilon kappa epsilon epsilon gamma kappa gamma sigma delta sigma omega gamma epsilon")
+        (tags tag-epsilon tag-epsilon tag-alpha tag-sigma)
+        (values 81552 71625 77284 62564 80714 49924))
+    ;; record 328, exported from table beta
+    (record-zeta
+        (id 328)
+        (description "zeta omega theta theta beta gamma beta omega")
+        (payload "gamma epsilon delta alpha delta delta delta beta beta beta omega zeta alpha gamma beta omega")
+        (tags tag-delta tag-beta tag-lambda tag-kappa)
+        (values 3122 49088 48405 25885 26721 72370))
+    ;; record 329, exported from table epsilon
+    (record-zeta
+        (id 329)
+        (description "kappa delta beta kappa zeta gamma delta lambda")
+        (payload "zeta beta delta omega kappa zeta lambda beta lambda epsilon omega theta gamma kappa delta beta")
+        (tags tag-omega tag-theta tag-beta tag-omega)
+        (values 88818 14904 10833 27064 70334 20811))
+    ;; record 330, exported from table gamma
+    (record-omega
+        (id 330)
+        (description "delta theta lambda zeta theta epsilon epsilon sigma")
+        (payload "gamma alpha lambda kappa theta delta alpha omega lambda theta delta zeta delta zeta theta alpha")
+        (tags tag-kappa tag-zeta tag-theta tag-beta)
+        (values 55219 63426 12274 21457 72085 51504))
+    ;; record 331, exported from table beta
+    (record-alpha
+        (id 331)
+        (description "beta beta omega sigma omega sigma gamma omega")
+        (payload "kappa lambda kappa kappa theta epsilon lambda zeta delta theta sigma kappa delta beta beta sigma")
+        (tags tag-theta tag-alpha tag-sigma tag-theta)
+        (values 37590 88389 30959 43714 11529 45230))
+    ;; record 332, exported from table epsilon
+    (record-zeta
+        (id 332)
+        (description "kappa zeta delta kappa alpha lambda lambda omega")
+        (payload "delta lambda lambda kappa epsilon theta theta epsilon gamma gamma beta beta alpha lambda delta sigma")
+        (tags tag-zeta tag-lambda tag-beta tag-sigma)
+        (values 76044 8613 39058 28355 4395 15388))
+    ;; record 333, exported from table zeta
+    (record-alpha
+        (id 333)
+        (description "alpha gamma gamma beta epsilon epsilon sigma omega")
+        (payload "omega delta delta epsilon epsilon delta kappa epsilon omega lambda zeta omega sigma gamma beta epsilon")
+        (tags tag-beta tag-beta tag-sigma tag-alpha)
+        (values 90376 76059 42077 41956 58277 95684))
+    ;; record 334, exported from table sigma
+    (record-omega
+        (id 334)
+        (description "epsilon theta kappa kappa kappa kappa kappa epsilon")
+        (payload "alpha sigma beta omega sigma lambda kappa beta delta kappa lambda beta gamma alpha lambda beta")
+        (tags tag-gamma tag-epsilon tag-kappa tag-omega)
+        (values 6093 22129 34300 89432 2754 89864))
+    ;; record 335, exported from table lambda
+    (record-zeta
+        (id 335)
+        (description "omega kappa gamma zeta gamma omega omega sigma")
+        (payload "theta sigma theta lambda theta theta epsilon lambda alpha delta theta sigma theta beta omega lambda")
+        (tags tag-lambda tag-theta tag-zeta tag-lambda)
+        (values 30196 84522 67970 69545 28457 10740))
+    ;; record 336, exported from table epsilon
+    (record-delta
+        (id 336)
+        (description "alpha kappa alpha alpha gamma delta omega delta")
+        (payload "zeta alpha zeta alpha lambda sigma alpha zeta gamma alpha epsilon sigma alpha gamma epsilon omega")
+        (tags tag-beta tag-epsilon tag-delta tag-epsilon)
+        (values 25087 82233 3199 74063 24055 45051))
+    ;; record 337, exported from table lambda
+    (record-zeta
+        (id 337)
+        (description "omega delta beta gamma zeta kappa kappa omega")
+        (payload "beta epsilon zeta alpha gamma beta alpha delta beta beta delta epsilon sigma epsilon alpha gamma")
+        (tags tag-epsilon tag-gamma tag-kappa tag-kappa)
+        (values 79652 -603 48048 66311 52658 27577))
+    ;; record 338, exported from table omega
+    (record-lambda
+        (id 338)
+        (description "alpha epsilon sigma alpha zeta beta alpha gamma")
+        (payload "beta alpha sigma omega omega sigma beta omega lambda sigma epsilon delta omega kappa alpha lambda")
+        (tags tag-gamma tag-delta tag-epsilon tag-zeta)
+        (values 37698 24398 75699 96531 64285 80911))
+    ;; record 339, exported from table epsilon
+    (record-lambda
+        (id 339)
+        (description "sigma omega lambda omega lambda beta gamma omega")
+        (payload "delta lambda alpha alpha sigma zeta lambda lambda kappa gamma epsilon omega sigma theta lambda zeta")
+        (tags tag-epsilon tag-epsilon tag-theta tag-sigma)
+        (values 15085 70971 83354 47867 55367 28361))
+    ;; record 340, exported from table zeta
+    (record-alpha
+        (id 340)
+        (description "delta zeta beta epsilon theta alpha kappa zeta")
+        (payload "delta alpha lambda omega gamma kappa delta zeta zeta theta alpha zeta gamma delta sigma gamma")
+        (tags tag-omega tag-alpha tag-zeta tag-zeta)
+        (values 53237 -688 15326 32846 25441 17611))
+    ;; record 341, exported from table kappa
+    (record-kappa
+        (id 341)
+        (description "lambda beta epsilon sigma kappa epsilon kappa delta")
+        (payload "lambda zeta omega gamma kappa beta omega sigma omega theta beta gamma theta omega omega lambda")
+        (tags tag-zeta tag-omega tag-delta tag-gamma)
+        (values 49576 90479 17767 54810 91242 38040))
+    ;; record 342, exported from table theta
+    (record-kappa
+        (id 342)
+        (description "omega sigma omega alpha epsilon alpha alpha theta")
+        (payload "beta sigma alpha sigma theta theta sigma zeta zeta epsilon beta delta theta omega zeta zeta")
+        (tags tag-theta tag-kappa tag-lambda tag-gamma)
+        (values 8550 38055 23997 70151 47806 31104))
+    ;; record 343, exported from table kappa
+    (record-lambda
+        (id 343)
+        (description "lambda epsilon alpha sigma gamma epsilon sigma omega")
+        (payload "theta zeta delta lambda alpha omega beta omega kappa epsilon delta delta epsilon theta sigma delta")
+        (tags tag-kappa tag-alpha tag-omega tag-kappa)
+        (values 87709 24629 68160 23262 51933 81008))
+    ;; record 344, exported from table omega
+    (record-zeta
+        (id 344)
+        (description "omega kappa delta sigma lambda epsilon sigma epsilon")
+        (payload "delta epsilon sigma zeta sigma omega beta kappa delta kappa kappa lambda epsilon gamma theta sigma")
+        (tags tag-epsilon tag-epsilon tag-zeta tag-alpha)
+        (values 54910 79409 50390 60694 96356 66716))
+    ;; record 345, exported from table delta
+    (record-kappa
+        (id 345)
+        (description "alpha zeta alpha alpha omega beta alpha epsilon")
+        (payload "beta lambda lambda beta delta delta kappa epsilon zeta delta zeta zeta theta beta gamma omega")
+        (tags tag-omega tag-theta tag-lambda tag-theta)
+        (values 2487 39017 16561 34359 65943 67322))
+    ;; record 346, exported from table theta
+    (record-sigma
+        (id 346)
+        (description "sigma sigma gamma sigma omega beta omega delta")
+        (payload "omega delta kappa sigma sigma theta epsilon epsilon epsilon kappa gamma delta omega kappa zeta theta")
+        (tags tag-epsilon tag-beta tag-lambda tag-gamma)
+        (values 63014 3888 84358 25617 86657 14522))
+    ;; record 347, exported from table beta
+    (record-sigma
+        (id 347)
+        (description "delta gamma kappa sigma alpha epsilon gamma gamma")
+        (payload "delta theta kappa zeta zeta gamma epsilon lambda alpha beta theta alpha alpha zeta kappa beta")
+        (tags tag-gamma tag-kappa tag-zeta tag-kappa)
+        (values 74329 2947 34785 97397 7280 99389))
+    ;; record 348, exported from table kappa
+    (record-sigma
+        (id 348)
+        (description "lambda lambda sigma lambda zeta kappa zeta sigma")
+        (payload "sigma lambda omega beta omega epsilon beta zeta kappa epsilon omega lambda sigma kappa omega delta")
+        (tags tag-gamma tag-zeta tag-delta tag-zeta)
+        (values 14828 77005 1420 87166 1173 99506))
+    ;; record 349, exported from table lambda
+    (record-zeta
+        (id 349)
+        (description "omega alpha kappa theta alpha epsilon lambda alpha")
+        (payload "omega theta gamma gamma kappa zeta beta epsilon kappa gamma omega gamma theta sigma alpha omega")
+        (tags tag-lambda tag-lambda tag-kappa tag-zeta)
+        (values 85735 62237 11024 13461 28504 48698))
+    ;; record 350, exported from table zeta
+    (record-epsilon
+        (id 350)
+        (description "alpha lambda gamma epsilon gamma lambda theta omega")
+        (payload "theta sigma lambda beta epsilon kappa sigma sigma lambda omega omega epsilon omega delta gamma zeta")
+        (tags tag-zeta tag-alpha tag-sigma tag-gamma)
+        (values 57741 31933 72152 28577 401 43994))
+    ;; record 351, exported from table alpha
+    (record-omega
+        (id 351)
+        (description "delta sigma sigma beta gamma alpha delta theta")
+        (payload "theta omega alpha zeta omega zeta lambda gamma theta sigma sigma omega sigma sigma lambda omega")
+        (tags tag-epsilon tag-alpha tag-lambda tag-sigma)
+        (values 14157 10971 83700 75327 572 57049))
+    ;; record 352, exported from table delta
+    (record-theta
+        (id 352)
+        (description "theta omega omega omega lambda kappa delta lambda")
+        (payload "theta kappa sigma alpha beta alpha kappa alpha theta gamma epsilon sigma sigma theta theta omega")
+        (tags tag-omega tag-sigma tag-kappa tag-epsilon)
+        (values 48407 30593 42090 42293 62030 71301))
+    ;; record 353, exported from table lambda
+    (record-beta
+        (id 353)
+        (description "gamma omega sigma delta lambda zeta beta lambda")
+        (payload "epsilon lambda gamma gamma sigma kappa beta kappa epsilon gamma omega delta theta zeta sigma alpha")
+        (tags tag-zeta tag-delta tag-delta tag-theta)
+        (values 30933 19850 68000 58559 40955 88643))
+    ;; record 354, exported from table delta
+    (record-lambda
+        (id 354)
+        (description "gamma theta delta alpha beta theta epsilon lambda")
+        (payload "zeta theta gamma omega gamma kappa sigma delta omega omega gamma alpha beta kappa sigma beta")
+        (tags tag-alpha tag-omega tag-kappa tag-omega)
+        (values 46900 98863 75096 62615 53051 -463))
+    ;; record 355, exported from table theta
+    (record-theta
+        (id 355)
+        (description "omega lambda theta sigma lambda theta delta epsilon")
+        (payload "sigma lambda beta delta beta alpha zeta epsilon epsilon delta epsilon epsilon epsilon beta beta delta")
+        (tags tag-alpha tag-beta tag-theta tag-epsilon)
+        (values 98071 56687 90753 78001 48994 98959))
+    ;; record 356, exported from table lambda
+    (record-sigma
+        (id 356)
+        (description "lambda sigma delta kappa delta delta beta beta")
+        (payload "omega zeta lambda zeta delta theta delta epsilon omega sigma epsilon alpha zeta zeta delta alpha")
+        (tags tag-beta tag-epsilon tag-epsilon tag-alpha)
+        (values 83833 11334 99580 76687 2748 59602))
+    ;; record 357, exported from table delta
+    (record-delta
+        (id 357)
+        (description "omega epsilon lambda alpha lambda gamma epsilon epsilon")
+        (payload "omega zeta alpha gamma epsilon lambda alpha beta beta delta theta zeta sigma beta lambda theta")
+        (tags tag-gamma tag-theta tag-zeta tag-delta)
+        (values 17363 19794 95734 91155 4720 31120))
+    ;; record 358, exported from table delta
+    (record-epsilon
+        (id 358)
+        (description "zeta zeta kappa delta theta delta delta delta")
+        (payload "gamma alpha epsilon theta epsilon beta sigma delta alpha lambda beta omega kappa alpha delta sigma")
+        (tags tag-sigma tag-kappa tag-zeta tag-theta)
+        (values 84418 61724 28831 39851 83293 18377))
+    ;; record 359, exported from table kappa
+    (record-alpha
+        (id 359)
+        (description "zeta gamma lambda sigma delta sigma theta kappa")
+        (payload "gamma omega zeta sigma omega beta lambda omega zeta epsilon delta kappa epsilon omega gamma lambda")
+        (tags tag-sigma tag-delta tag-epsilon tag-zeta)
+        (values 24517 21331 91245 45436 47621 4598))
+    ;; record 360, exported from table epsilon
+    (record-sigma
+        (id 360)
+        (description "lambda alpha zeta theta zeta omega delta kappa")
+        (payload "kappa theta gamma lambda delta sigma sigma omega beta beta kappa beta alpha delta zeta epsilon")
+        (tags tag-theta tag-delta tag-omega tag-delta)
+        (values 886 70479 35459 92071 4640 89014))
+    ;; record 361, exported from table omega
+    (record-delta
+        (id 361)
+        (description "lambda alpha gamma lambda gamma theta lambda zeta")
+        (payload "alpha kappa lambda theta alpha omega delta zeta lambda kappa theta theta theta kappa omega beta")
+        (tags tag-gamma tag-sigma tag-theta tag-zeta)
+        (values 70785 35401 9560 26430 98142 49455))
+    ;; record 362, exported from table zeta
+    (record-kappa
+        (id 362)
+        (description "epsilon lambda gamma lambda sigma sigma epsilon zeta")
+        (payload "beta lambda omega sigma alpha kappa sigma kappa epsilon theta zeta epsilon lambda theta alpha omega")
+        (tags tag-lambda tag-kappa tag-delta tag-zeta)
+        (values 51899 55634 50534 84157 19598 67198))
+    ;; record 363, exported from table sigma
+    (record-sigma
+        (id 363)
+        (description "zeta epsilon beta epsilon zeta alpha gamma epsilon")
+        (payload "delta epsilon epsilon alpha beta lambda gamma sigma kappa lambda zeta delta omega sigma omega sigma")
+        (tags tag-theta tag-gamma tag-delta tag-epsilon)
+        (values 86975 45132 33032 13887 68385 35342))
+    ;; record 364, exported from table theta
+    (record-alpha
+        (id 364)
+        (description "theta epsilon epsilon alpha gamma epsilon alpha zeta")
+        (payload "delta delta omega zeta sigma delta zeta sigma zeta delta beta epsilon epsilon alpha theta epsilon")
+        (tags tag-lambda tag-epsilon tag-gamma tag-epsilon)
+        (values 30424 58708 60328 9365 24779 57066))
+    ;; record 365, exported from table delta
+    (record-epsilon
+        (id 365)
+        (description "beta epsilon alpha delta zeta lambda kappa omega")
+        (payload "sigma kappa lambda sigma zeta gamma delta sigma omega lambda omega beta omega theta lambda sigma")
+        (tags tag-zeta tag-epsilon tag-sigma tag-gamma)
+        (values 54271 34268 54946 5946 79325 52481))
+    ;; record 366, exported from table lambda
+    (record-kappa
+        (id 366)
+        (description "gamma zeta sigma sigma sigma gamma lambda alpha")
+        (payload "sigma beta epsilon sigma zeta theta kappa alpha lambda sigma delta theta epsilon delta beta alpha")
+        (tags tag-lambda tag-epsilon tag-sigma tag-sigma)
+        (values -403 23828 45487 5117 81353 44987))
+    ;; record 367, exported from table sigma
+    (record-alpha
+        (id 367)
+        (description "gamma gamma lambda beta theta epsilon gamma epsilon")
+        (payload "kappa epsilon omega delta theta kappa alpha alpha theta beta kappa zeta delta gamma theta delta")
+        (tags tag-omega tag-sigma tag-kappa tag-sigma)
+        (values 33905 27974 30180 22593 76036 21464))
+    ;; record 368, exported from table beta
+    (record-delta
+        (id 368)
+        (description "lambda theta sigma epsilon epsilon lambda epsilon lambda")
+        (payload "gamma kappa theta omega delta alpha alpha delta omega lambda gamma theta beta zeta lambda epsilon")
+        (tags tag-omega tag-zeta tag-epsilon tag-zeta)
+        (values 31186 67540 78733 13799 19767 2994))
+    ;; record 369, exported from table kappa
+    (record-gamma
+        (id 369)
+        (description "theta gamma delta beta alpha omega gamma sigma")
+        (payload "zeta alpha delta delta sigma sigma gamma zeta omega alpha omega zeta kappa theta sigma theta")
+        (tags tag-epsilon tag-kappa tag-lambda tag-beta)
+        (values 69086 15816 88329 60533 12370 14020))
+    ;; record 370, exported from table alpha
+    (record-theta
+        (id 370)
+        (description "omega omega gamma omega epsilon zeta theta kappa")
+        (payload "alpha sigma zeta alpha epsilon omega kappa omega theta beta zeta alpha kappa theta theta alpha")
+        (tags tag-kappa tag-epsilon tag-gamma tag-gamma)
+        (values 44171 44603 78199 62523 65887 15323))
+    ;; record 371, exported from table epsilon
+    (record-sigma
+        (id 371)
+        (description "zeta kappa alpha lambda lambda kappa omega sigma")
+        (payload "lambda epsilon sigma theta zeta epsilon theta gamma lambda theta lambda omega epsilon beta beta gamma")
+        (tags tag-alpha tag-zeta tag-beta tag-gamma)
+        (values 38517 62466 39125 66248 45493 20893))
+    ;; record 372, exported from table lambda
+    (record-delta
+        (id 372)
+        (description "gamma alpha kappa omega lambda beta delta gamma")
+        (payload "epsilon lambda sigma theta delta kappa gamma lambda delta zeta epsilon epsilon epsilon omega gamma lambda")
+        (tags tag-lambda tag-gamma tag-delta tag-beta)
+        (values 10710 66084 31750 3809 1300 28964))
+    ;; record 373, exported from table zeta
+    (record-gamma
+        (id 373)
+        (description "zeta kappa lambda theta sigma delta sigma zeta")
+        (payload "omega beta sigma sigma epsilon lambda epsilon theta gamma omega sigma alpha omega alpha epsilon epsilon")
+        (tags tag-kappa tag-beta tag-delta tag-omega)
+        (values 58683 13620 89544 11334 13015 4602))
+    ;; record 374, exported from table theta
+    (record-zeta
+        (id 374)
+        (description "kappa lambda zeta beta sigma beta epsilon delta")
+        (payload "gamma alpha omega lambda alpha theta omega sigma omega beta delta lambda gamma beta beta gamma")
+        (tags tag-lambda tag-gamma tag-delta tag-theta)
+        (values 58607 43980 69909 46048 54395 57245))
+    ;; record 375, exported from table lambda
+    (record-zeta
+        (id 375)
+        (description "delta sigma zeta lambda gamma theta alpha gamma")
+        (payload "sigma theta delta kappa omega beta zeta zeta delta kappa epsilon sigma omega zeta zeta sigma")
+        (tags tag-delta tag-theta tag-lambda tag-alpha)
+        (values 13401 50635 29375 87879 49587 72155))
+    ;; record 376, exported from table lambda
+    (record-epsilon
+        (id 376)
+        (description "alpha delta alpha alpha omega delta delta kappa")
+        (payload "theta gamma epsilon epsilon alpha kappa lambda epsilon gamma alpha omega epsilon epsilon zeta sigma theta")
+        (tags tag-delta tag-theta tag-epsilon tag-sigma)
+        (values 72184 70413 18020 77799 3648 11716))
+    ;; record 377, exported from table omega
+    (record-kappa
+        (id 377)
+        (description "kappa delta delta lambda beta zeta epsilon gamma")
+        (payload "delta alpha alpha lambda delta epsilon beta beta sigma sigma zeta omega zeta omega beta delta")
+        (tags tag-sigma tag-kappa tag-kappa tag-gamma)
+        (values 5399 46679 29254 17298 64199 47029))
+    ;; record 378, exported from table delta
+    (record-theta
+        (id 378)
+        (description "alpha omega zeta delta sigma delta gamma zeta")
+        (payload "sigma beta omega lambda delta delta beta epsilon beta delta beta delta lambda omega alpha lambda")
+        (tags tag-zeta tag-lambda tag-epsilon tag-sigma)
+        (values 83329 33659 48922 59383 42968 92994))
+    ;; record 379, exported from table alpha
+    (record-omega
+        (id 379)
+        (description "omega alpha lambda kappa alpha omega epsilon beta")
+        (payload "sigma zeta epsilon delta alpha lambda zeta gamma alpha gamma alpha alpha theta epsilon lambda zeta")
+        (tags tag-delta tag-omega tag-lambda tag-alpha)
+        (values 61673 87315 37510 61670 32845 52713))
+    ;; record 380, exported from table lambda
+    (record-omega
+        (id 380)
+        (description "gamma beta theta sigma zeta lambda omega theta")
+        (payload "delta lambda beta theta alpha gamma theta theta beta omega gamma kappa kappa beta alpha lambda")
+        (tags tag-lambda tag-lambda tag-alpha tag-theta)
+        (values 33085 72774 31693 69507 64318 88255))
+    ;; record 381, exported from table epsilon
+    (record-theta
+        (id 381)
+        (description "theta epsilon alpha delta kappa omega lambda zeta")
+        (payload "theta delta epsilon sigma zeta epsilon sigma beta lambda delta omega kappa sigma omega epsilon sigma")
+        (tags tag-beta tag-epsilon tag-beta tag-zeta)
+        (values 22525 36187 85046 46850 78736 44963))
+    ;; record 382, exported from table alpha
+    (record-epsilon
+        (id 382)
+        (description "gamma zeta alpha lambda omega gamma delta beta")
+        (payload "kappa beta omega kappa omega omega omega lambda sigma delta lambda zeta beta sigma sigma sigma")
+        (tags tag-gamma tag-epsilon tag-kappa tag-theta)
+        (values 73731 2183 20051 84417 49387 29161))
+    ;; record 383, exported from table gamma
+    (record-gamma
+        (id 383)
+        (description "epsilon lambda sigma delta theta zeta beta beta")
+        (payload "kappa sigma omega omega theta epsilon omega delta lambda gamma lambda theta kappa beta epsilon epsilon")
+        (tags tag-delta tag-omega tag-lambda tag-lambda)
+        (values 87830 81586 42729 54667 99096 38606))
+    ;; record 384, exported from table beta
+    (record-omega
+        (id 384)
+        (description "delta zeta kappa zeta epsilon zeta alpha beta")
+        (payload "zeta delta theta delta epsilon omega zeta zeta alpha lambda epsilon alpha beta lambda kappa lambda")
+        (tags tag-zeta tag-kappa tag-delta tag-gamma)
+        (values 98991 33522 91561 31859 41219 44852))
+    ;; record 385, exported from table omega
+    (record-theta
+        (id 385)
+        (description "alpha zeta zeta omega sigma theta sigma delta")
+        (payload "kappa alpha alpha delta alpha lambda sigma kappa gamma delta beta lambda epsilon theta theta lambda")
+        (tags tag-zeta tag-beta tag-epsilon tag-zeta)
+        (values 89912 80780 79712 70977 10943 74900))
+    ;; record 386, exported from table beta
+    (record-zeta
+        (id 386)
+        (description "theta gamma lambda sigma alpha kappa theta delta")
+        (payload "epsilon delta kappa alpha sigma gamma epsilon gamma delta theta theta sigma alpha zeta epsilon lambda")
+        (tags tag-epsilon tag-theta tag-zeta tag-theta)
+        (values 44188 87421 19024 15221 46872 45952))
+    ;; record 387, exported from table omega
+    (record-alpha
+        (id 387)
+        (description "omega kappa kappa lambda sigma gamma zeta gamma")
+        (payload "delta lambda lambda beta gamma beta gamma beta lambda lambda omega delta kappa alpha kappa delta")
+        (tags tag-kappa tag-omega tag-zeta tag-beta)
+        (values 33192 38198 3289 86166 54071 41347))
+    ;; record 388, exported from table alpha
+    (record-gamma
+        (id 388)
+        (description "beta zeta theta lambda omega alpha epsilon sigma")
+        (payload "lambda beta kappa lambda sigma gamma zeta lambda lambda epsilon kappa omega beta theta zeta zeta")
+        (tags tag-alpha tag-kappa tag-zeta tag-lambda)
+        (values 11444 98584 22353 52 82805 78698))
+    ;; record 389, exported from table theta
+    (record-beta
+        (id 389)
+        (description "gamma delta beta zeta kappa beta omega sigma")
+        (payload "sigma alpha alpha alpha alpha gamma beta gamma sigma delta zeta alpha delta zeta lambda alpha")
+        (tags tag-omega tag-beta tag-delta tag-kappa)
+        (values 90857 65938 83821 22022 88567 39140))
+    ;; record 390, exported from table omega
+    (record-theta
+        (id 390)
+        (description "omega omega zeta omega alpha lambda gamma beta")
+        (payload "epsilon beta delta beta omega sigma alpha sigma alpha lambda omega sigma omega zeta omega kappa")
+        (tags tag-sigma tag-sigma tag-omega tag-beta)
+        (values 24704 15481 63694 12512 33867 47955))
+    ;; record 391, exported from table lambda
+    (record-lambda
+        (id 391)
+        (description "delta beta kappa theta zeta zeta zeta gamma")
+        (payload "epsilon zeta kappa theta gamma gamma omega theta beta alpha sigma beta lambda lambda omega gamma")
+        (tags tag-kappa tag-beta tag-gamma tag-beta)
+        (values 57615 87103 16775 76258 54246 5356))
+    ;; record 392, exported from table gamma
+    (record-delta
+        (id 392)
+        (description "kappa theta kappa beta epsilon kappa alpha delta")
+        (payload "gamma lambda omega sigma theta gamma lambda lambda gamma omega kappa zeta kappa epsilon theta zeta")
+        (tags tag-kappa tag-lambda tag-delta tag-beta)
+        (values 31057 22307 30934 52166 38051 16049))
+    ;; record 393, exported from table beta
+    (record-beta
+        (id 393)
+        (description "zeta lambda omega gamma epsilon epsilon kappa gamma")
+        (payload "zeta lambda kappa alpha alpha lambda alpha sigma kappa kappa kappa beta sigma alpha beta theta")
+        (tags tag-sigma tag-beta tag-kappa tag-zeta)
+        (values 31577 60392 12534 12677 12448 20437))
+    ;; record 394, exported from table delta
+    (record-sigma
+        (id 394)
+        (description "omega alpha alpha delta kappa zeta beta sigma")
+        (payload "kappa omega delta delta beta theta gamma delta kappa gamma sigma omega sigma sigma beta zeta")
+        (tags tag-lambda tag-theta tag-omega tag-zeta)
+        (values 92297 63814 49222 62766 51258 86667))
+    ;; record 395, exported from table omega
+    (record-zeta
+        (id 395)
+        (description "sigma alpha beta lambda alpha gamma zeta lambda")
+        (payload "sigma delta gamma theta omega beta zeta kappa lambda alpha beta sigma beta alpha beta alpha")
+        (tags tag-alpha tag-gamma tag-kappa tag-lambda)
+        (values 87352 56014 43605 5644 4483 87264))
+    ;; record 396, exported from table delta
+    (record-kappa
+        (id 396)
+        (description "alpha theta omega beta beta alpha delta alpha")
+        (payload "omega epsilon omega beta beta lambda lambda delta gamma zeta delta theta omega beta alpha zeta")
+        (tags tag-alpha tag-epsilon tag-gamma tag-beta)
+        (values 94035 36500 93636 80518 84371 75198))
+    ;; record 397, exported from table beta
+    (record-lambda
+        (id 397)
+        (description "delta theta delta zeta sigma alpha omega lambda")
+        (payload "epsilon omega omega sigma sigma sigma theta epsilon kappa sigma sigma kappa epsilon kappa beta gamma")
+        (tags tag-epsilon tag-sigma tag-theta tag-delta)
+        (values 74299 62900 68124 14601 69462 35719))
+    ;; record 398, exported from table epsilon
+    (record-beta
+        (id 398)
+        (description "beta epsilon epsilon zeta delta omega alpha lambda")
+        (payload "delta epsilon lambda epsilon sigma delta epsilon lambda kappa sigma beta omega alpha epsilon zeta kappa")
+        (tags tag-omega tag-zeta tag-alpha tag-sigma)
+        (values 34889 26322 81227 52184 4890 46775))
+    ;; record 399, exported from table theta
+    (record-kappa
+        (id 399)
+        (description "sigma alpha sigma theta gamma alpha gamma sigma")
+        (payload "omega delta beta delta epsilon delta gamma delta kappa omega alpha kappa gamma zeta theta delta")
+        (tags tag-zeta tag-beta tag-delta tag-kappa)
+        (values 22046 86625 11556 85579 57535 66284))
+    ;; record 400, exported from table zeta
+    (record-beta
+        (id 400)
+        (description "kappa theta epsilon theta zeta alpha delta epsilon")
+        (payload "omega delta beta epsilon gamma sigma zeta sigma kappa zeta omega delta beta zeta delta zeta")
+        (tags tag-omega tag-theta tag-delta tag-theta)
+        (values 73009 13526 25180 94773 91788 49722))
+    ;; record 401, exported from table delta
+    (record-delta
+        (id 401)
+        (description "omega delta lambda beta beta gamma sigma lambda")
+        (payload "theta zeta gamma epsilon gamma omega zeta omega gamma epsilon alpha omega alpha gamma delta theta")
+        (tags tag-zeta tag-omega tag-alpha tag-beta)
+        (values 88047 69854 55998 67955 79109 16413))
+    ;; record 402, exported from table zeta
+    (record-zeta
+        (id 402)
+        (description "omega alpha sigma epsilon omega sigma beta gamma")
+        (payload "gamma theta lambda epsilon theta epsilon beta epsilon kappa sigma sigma theta zeta theta theta zeta")
+        (tags tag-delta tag-omega tag-theta tag-zeta)
+        (values 4594 99622 42869 7211 41346 14059))
+    ;; record 403, exported from table omega
+    (record-kappa
+        (id 403)
+        (description "beta lambda epsilon lambda delta lambda zeta gamma")
+        (payload "kappa lambda gamma sigma delta zeta alpha theta gamma lambda gamma gamma gamma gamma theta sigma")
+        (tags tag-alpha tag-gamma tag-gamma tag-theta)
+        (values 13708 1311 36886 79081 48743 54609))
+    ;; record 404, exported from table gamma
+    (record-delta
+        (id 404)
+        (description "beta alpha sigma gamma beta zeta delta epsilon")
+        (payload "lambda delta epsilon kappa alpha alpha epsilon omega omega zeta lambda beta delta kappa gamma beta")
+        (tags tag-kappa tag-omega tag-omega tag-alpha)
+        (values 43452 27364 64148 79158 44033 94762))
+    ;; record 405, exported from table epsilon
+    (record-alpha
+        (id 405)
+        (description "epsilon alpha lambda gamma delta lambda gamma theta")
+        (payload "kappa sigma gamma alpha gamma sigma omega sigma zeta theta kappa sigma lambda omega gamma delta")
+        (tags tag-epsilon tag-gamma tag-alpha tag-zeta)
+        (values 29921 27238 77645 12824 85253 93713))
+    ;; record 406, exported from table beta
+    (record-theta
+        (id 406)
+        (description "omega kappa delta gamma delta sigma gamma gamma")
+        (payload "beta omega beta theta beta delta alpha lambda sigma alpha theta lambda epsilon epsilon beta alpha")
+        (tags tag-theta tag-omega tag-epsilon tag-omega)
+        (values 55949 82802 32417 6381 53121 45910))
+    ;; record 407, exported from table beta
+    (record-theta
+        (id 407)
+        (description "beta lambda beta gamma sigma alpha sigma alpha")
+        (payload "lambda zeta epsilon beta theta delta gamma omega sigma epsilon lambda alpha omega zeta gamma gamma")
+        (tags tag-zeta tag-zeta tag-kappa tag-zeta)
+        (values 77727 30370 99380 91251 55272 41621))
+    ;; record 408, exported from table omega
+    (record-epsilon
+        (id 408)
+        (description "alpha lambda delta delta beta alpha gamma epsilon")
+        (payload "theta lambda kappa zeta zeta alpha sigma beta lambda zeta epsilon zeta epsilon omega theta beta")
+        (tags tag-beta tag-lambda tag-beta tag-omega)
+        (values 79625 99326 75864 94828 48586 45683))
+    ;; record 409, exported from table theta
+    (record-beta
+        (id 409)
+        (description "kappa lambda sigma kappa omega delta gamma epsilon")
+        (payload "epsilon lambda delta kappa theta alpha epsilon lambda beta lambda beta zeta kappa epsilon zeta theta")
+        (tags tag-lambda tag-theta tag-alpha tag-epsilon)
+        (values 7510 9744 64763 92615 64620 12421))
+    ;; record 410, exported from table lambda
+    (record-epsilon
+        (id 410)
+        (description "lambda epsilon zeta zeta theta delta alpha zeta")
+        (payload "kappa delta lambda alpha delta zeta beta lambda zeta omega lambda alpha gamma gamma epsilon zeta")
+        (tags tag-sigma tag-beta tag-theta tag-alpha)
+        (values 30102 19460 10143 63336 2997 61933))
+    ;; record 411, exported from table epsilon
+    (record-sigma
+        (id 411)
+        (description "delta zeta zeta beta delta delta sigma zeta")
+        (payload "omega kappa alpha gamma theta omega lambda gamma lambda sigma kappa delta sigma gamma epsilon zeta")
+        (tags tag-alpha tag-beta tag-lambda tag-gamma)
+        (values 66508 16440 41259 75777 16057 20513))
+    ;; record 412, exported from table theta
+    (record-kappa
+        (id 412)
+        (description "omega sigma zeta beta omega lambda kappa beta")
+        (payload "delta zeta sigma epsilon epsilon beta theta kappa kappa beta alpha omega delta omega delta beta")
+        (tags tag-alpha tag-sigma tag-beta tag-beta)
+        (values 66605 8792 78252 10075 12030 8958))
+    ;; record 413, exported from table theta
+    (record-zeta
+        (id 413)
+        (description "sigma lambda delta beta alpha sigma lambda beta")
+        (payload "gamma delta gamma omega omega theta epsilon theta gamma gamma zeta lambda zeta lambda epsilon gamma")
+        (tags tag-kappa tag-omega tag-delta tag-epsilon)
+        (values 57354 51822 58954 4051 60322 9774))
+    ;; record 414, exported from table kappa
+    (record-alpha
+        (id 414)
+        (description "alpha lambda epsilon theta epsilon theta kappa beta")
+        (payload "delta beta delta alpha theta zeta lambda gamma omega omega beta alpha sigma delta lambda omega")
+        (tags tag-theta tag-gamma tag-lambda tag-lambda)
+        (values 64046 31433 21930 4877 93767 44789))
+    ;; record 415, exported from table epsilon
+    (record-kappa
+        (id 415)
+        (description "epsilon sigma theta alpha theta alpha kappa beta")
+        (payload "gamma alpha kappa kappa gamma delta zeta gamma alpha sigma kappa epsilon kappa alpha gamma delta")
+        (tags tag-alpha tag-epsilon tag-kappa tag-omega)
+        (values 94707 45619 82383 76003 96315 28860))
+    ;; record 416, exported from table beta
+    (record-delta
+        (id 416)
+        (description "theta delta gamma theta lambda kappa sigma sigma")
+        (payload "theta gamma epsilon beta theta lambda zeta beta theta theta alpha gamma delta gamma kappa alpha")
+        (tags tag-omega tag-alpha tag-alpha tag-kappa)
+        (values 51482 88113 83565 52970 72183 71893))
+    ;; record 417, exported from table lambda
+    (record-zeta
+        (id 417)
+        (description "omega delta kappa kappa theta epsilon lambda theta")
+        (payload "zeta beta alpha epsilon gamma beta theta epsilon sigma epsilon kappa omega gamma epsilon gamma kappa")
+        (tags tag-gamma tag-lambda tag-sigma tag-sigma)
+        (values 8637 62801 28629 60297 73751 67370))
+    ;; record 418, exported from table beta
+    (record-beta
+        (id 418)
+        (description "gamma beta lambda sigma theta zeta theta alpha")
+        (payload "sigma sigma delta alpha beta zeta kappa omega epsilon theta sigma lambda beta delta lambda lambda")
+        (tags tag-epsilon tag-lambda tag-theta tag-zeta)
+        (values 38613 18930 94837 59888 50818 46496))
+    ;; record 419, exported from table kappa
+    (record-zeta
+        (id 419)
+        (description "delta theta omega zeta beta lambda beta omega")
+        (payload "omega epsilon beta zeta delta sigma delta beta lambda epsilon epsilon gamma delta alpha epsilon theta")
+        (tags tag-sigma tag-omega tag-beta tag-delta)
+        (values 8007 61668 26712 54087 87136 18042))
+    ;; record 420, exported from table omega
+    (record-alpha
+        (id 420)
+        (description "theta omega sigma omega kappa zeta gamma delta")
+        (payload "gamma kappa zeta zeta beta sigma theta beta beta epsilon omega alpha delta zeta delta beta")
+        (tags tag-omega tag-sigma tag-theta tag-zeta)
+        (values 32204 31034 70519 93138 15679 62686))
+    ;; record 421, exported from table sigma
+    (record-gamma
+        (id 421)
+        (description "epsilon kappa beta delta theta gamma alpha omega")
+        (payload "kappa gamma omega epsilon omega sigma lambda beta epsilon gamma kappa kappa lambda zeta omega beta")
+        (tags tag-alpha tag-kappa tag-epsilon tag-epsilon)
+        (values 23515 33249 9738 5408 34034 98316))
+    ;; record 422, exported from table alpha
+    (record-delta
+        (id 422)
+        (description "delta gamma lambda alpha beta epsilon alpha omega")
+        (payload "alpha zeta delta theta beta kappa kappa delta epsilon sigma theta lambda beta beta alpha epsilon")
+        (tags tag-omega tag-kappa tag-lambda tag-sigma)
+        (values 40140 80488 4609 65356 81745 21571))
+    ;; record 423, exported from table alpha
+    (record-omega
+        (id 423)
+        (description "sigma theta alpha kappa epsilon alpha beta alpha")
+        (payload "omega omega epsilon epsilon gamma lambda lambda epsilon alpha alpha delta omega theta delta gamma epsilon")
+        (tags tag-zeta tag-theta tag-epsilon tag-delta)
+        (values 52843 83751 28090 95885 8653 80997))
+    ;; record 424, exported from table sigma
+    (record-sigma
+        (id 424)
+        (description "omega delta beta kappa epsilon lambda zeta epsilon")
+        (payload "zeta kappa theta lambda theta zeta sigma alpha omega alpha lambda delta sigma epsilon beta theta")
+        (tags tag-gamma tag-lambda tag-omega tag-lambda)
+        (values 71384 89277 37662 61805 18913 46649))
+    ;; record 425, exported from table theta
+    (record-kappa
+        (id 425)
+        (description "delta sigma gamma epsilon gamma theta beta omega")
+        (payload "gamma lambda delta kappa kappa theta lambda zeta alpha zeta sigma kappa lambda alpha delta beta")
+        (tags tag-kappa tag-sigma tag-beta tag-omega)
+        (values 4565 68606 358 25498 87155 47025))
+    ;; record 426, exported from table alpha
+    (record-lambda
+        (id 426)
+        (description "gamma sigma alpha gamma omega delta kappa gamma")
+        (payload "zeta zeta kappa epsilon delta alpha kappa lambda epsilon alpha theta kappa lambda delta epsilon theta")
+        (tags tag-sigma tag-omega tag-sigma tag-omega)
+        (values 5782 81372 74376 86624 32236 74125))
+    ;; record 427, exported from table kappa
+    (record-alpha
+        (id 427)
+        (description "lambda gamma epsilon epsilon delta gamma beta beta")
+        (payload "sigma gamma sigma delta sigma alpha delta theta theta alpha epsilon omega omega theta sigma gamma")
+        (tags tag-sigma tag-gamma tag-alpha tag-kappa)
+        (values 12741 29639 25085 53409 26583 7500))
+    ;; record 428, exported from table kappa
+    (record-alpha
+        (id 428)
+        (description "zeta theta beta lambda epsilon lambda sigma lambda")
+        (payload "lambda beta omega theta kappa gamma lambda alpha epsilon omega theta omega kappa zeta delta theta")
+        (tags tag-kappa tag-delta tag-gamma tag-sigma)
+        (values 62961 31186 92538 24168 19392 5719))
+    ;; record 429, exported from table beta
+    (record-kappa
+        (id 429)
+        (description "alpha zeta epsilon kappa lambda epsilon alpha omega")
+        (payload "theta kappa kappa gamma kappa lambda omega kappa alpha omega omega epsilon epsilon zeta lambda kappa")
+        (tags tag-theta tag-lambda tag-gamma tag-alpha)
+        (values 8234 83240 91312 47317 38887 47640))
+    ;; record 430, exported from table theta
+    (record-delta
+        (id 430)
+        (description "beta zeta theta theta lambda lambda theta theta")
+        (payload "alpha delta alpha epsilon zeta sigma sigma beta alpha gamma kappa lambda sigma kappa gamma lambda")
+        (tags tag-theta tag-beta tag-alpha tag-gamma)
+        (values 34662 8434 3553 50111 70293 83354))
+    ;; record 431, exported from table alpha
+    (record-omega
+        (id 431)
+        (description "alpha kappa beta zeta sigma delta omega alpha")
+        (payload "delta lambda lambda lambda theta gamma theta omega zeta zeta epsilon kappa kappa zeta beta gamma")
+        (tags tag-omega tag-alpha tag-omega tag-gamma)
+        (values 69417 5572 93967 79483 97756 28754))
+    ;; record 432, exported from table lambda
+    (record-omega
+        (id 432)
+        (description "beta gamma beta alpha epsilon omega epsilon sigma")
+        (payload "zeta omega gamma alpha sigma theta kappa kappa alpha alpha alpha sigma theta kappa gamma alpha")
+        (tags tag-delta tag-zeta tag-lambda tag-sigma)
+        (values 45084 43323 44268 -589 88675 25764))
+    ;; record 433, exported from table epsilon
+    (record-lambda
+        (id 433)
+        (description "sigma beta alpha alpha kappa delta epsilon alpha")
+        (payload "beta gamma gamma omega beta sigma epsilon sigma alpha theta beta lambda theta omega epsilon alpha")
+        (tags tag-epsilon tag-zeta tag-beta tag-gamma)
+        (values 57177 77346 26984 54401 22241 97352))
+    ;; record 434, exported from table sigma
+    (record-theta
+        (id 434)
+        (description "kappa lambda kappa alpha alpha theta gamma beta")
+        (payload "sigma epsilon delta gamma omega delta zeta lambda gamma beta alpha epsilon zeta beta beta theta")
+        (tags tag-beta tag-epsilon tag-delta tag-zeta)
+        (values 61494 73256 78168 49045 13119 90487))
+    ;; record 435, exported from table epsilon
+    (record-beta
+        (id 435)
+        (description "omega epsilon lambda theta beta beta omega gamma")
+        (payload "delta delta lambda epsilon omega epsilon beta theta kappa theta kappa beta delta theta beta gamma")
+        (tags tag-gamma tag-lambda tag-alpha tag-delta)
+        (values 87416 18181 64988 24896 14403 87681))
+    ;; record 436, exported from table alpha
+    (record-omega
+        (id 436)
+        (description "sigma alpha omega gamma epsilon alpha zeta kappa")
+        (payload "theta epsilon beta kappa kappa beta lambda epsilon sigma zeta alpha delta gamma sigma epsilon lambda")
+        (tags tag-epsilon tag-epsilon tag-theta tag-alpha)
+        (values 31566 94690 91690 22972 60183 18116))
+    ;; record 437, exported from table delta
+    (record-lambda
+        (id 437)
+        (description "kappa omega sigma omega kappa kappa zeta zeta")
+        (payload "zeta alpha alpha sigma gamma epsilon theta omega kappa delta kappa kappa alpha beta sigma gamma")
+        (tags tag-epsilon tag-lambda tag-omega tag-zeta)
+        (values 28704 37072 40578 26713 65799 34840))
+    ;; record 438, exported from table alpha
+    (record-alpha
+        (id 438)
+        (description "gamma beta theta omega sigma omega epsilon lambda")
+        (payload "beta lambda gamma omega alpha omega gamma epsilon delta zeta epsilon omega theta theta lambda epsilon")
+        (tags tag-alpha tag-omega tag-sigma tag-kappa)
+        (values 23095 19962 18050 50763 37352 6143))
+    ;; record 439, exported from table beta
+    (record-gamma
+        (id 439)
+        (description "delta omega gamma delta omega omega sigma omega")
+        (payload "sigma epsilon lambda beta theta delta theta theta lambda theta zeta delta omega lambda alpha gamma")
+        (tags tag-sigma tag-lambda tag-omega tag-delta)
+        (values 78112 69595 70879 88063 38237 93323))
+    ;; record 440, exported from table epsilon
+    (record-sigma
+        (id 440)
+        (description "sigma sigma kappa alpha epsilon epsilon epsilon lambda")
+        (payload "delta sigma lambda delta epsilon alpha gamma lambda sigma omega sigma gamma epsilon alpha lambda kappa")
+        (tags tag-delta tag-gamma tag-epsilon tag-zeta)
+        (values 70511 61111 4323 83189 78127 80419))
+    ;; record 441, exported from table zeta
+    (record-lambda
+        (id 441)
+        (description "sigma theta kappa zeta kappa theta kappa sigma")
+        (payload "gamma gamma beta gamma alpha epsilon kappa alpha lambda sigma lambda alpha omega sigma kappa gamma")
+        (tags tag-epsilon tag-alpha tag-kappa tag-omega)
+        (values 90846 16794 99989 83127 97002 37506))
+    ;; record 442, exported from table alpha
+    (record-gamma
+        (id 442)
+        (description "alpha gamma delta gamma alpha lambda epsilon alpha")
+        (payload "theta epsilon zeta delta delta alpha kappa beta delta sigma alpha gamma sigma gamma kappa lambda")
+        (tags tag-zeta tag-gamma tag-epsilon tag-lambda)
+        (values 25358 73010 75259 6362 79506 10794))
+    ;; record 443, exported from table kappa
+    (record-delta
+        (id 443)
+        (description "alpha gamma gamma gamma beta gamma sigma gamma")
+        (payload "delta zeta omega kappa gamma omega alpha delta lambda alpha zeta gamma epsilon sigma kappa sigma")
+        (tags tag-kappa tag-zeta tag-kappa tag-zeta)
+        (values 97286 99043 84874 24267 88795 11590))
+    ;; record 444, exported from table sigma
+    (record-delta
+        (id 444)
+        (description "delta beta gamma lambda alpha gamma lambda lambda")
+        (payload "kappa alpha epsilon theta beta zeta kappa epsilon theta kappa gamma sigma theta theta lambda beta")
+        (tags tag-delta tag-alpha tag-alpha tag-theta)
+        (values 38661 26722 94790 29154 67641 40556))
+    ;; record 445, exported from table gamma
+    (record-lambda
+        (id 445)
+        (description "delta kappa zeta zeta lambda alpha gamma zeta")
+        (payload "lambda lambda zeta delta theta omega zeta zeta alpha gamma delta zeta sigma theta epsilon kappa")
+        (tags tag-theta tag-sigma tag-beta tag-lambda)
+        (values 98995 55115 20372 62123 2137 74550))
+    ;; record 446, exported from table sigma
+    (record-omega
+        (id 446)
+        (description "theta beta kappa delta omega delta gamma theta")
+        (payload "theta omega theta sigma sigma delta theta lambda sigma epsilon delta gamma gamma delta zeta alpha")
+        (tags tag-theta tag-omega tag-delta tag-epsilon)
+        (values -435 4343 9866 20396 92863 41511))
+    ;; record 447, exported from table zeta
+    (record-zeta
+        (id 447)
+        (description "gamma alpha beta omega theta gamma sigma sigma")
+        (payload "sigma theta omega epsilon alpha beta kappa theta sigma omega beta zeta omega epsilon delta epsilon")
+        (tags tag-kappa tag-omega tag-alpha tag-delta)
+        (values 94893 12464 8081 61328 11293 56652))
+    ;; record 448, exported from table sigma
+    (record-alpha
+        (id 448)
+        (description "lambda delta zeta omega lambda zeta theta zeta")
+        (payload "epsilon delta epsilon lambda alpha beta beta lambda kappa epsilon lambda beta beta lambda theta sigma")
+        (tags tag-kappa tag-lambda tag-sigma tag-theta)
+        (values 29342 53102 49984 23551 18581 -870))
+    ;; record 449, exported from table kappa
+    (record-delta
+        (id 449)
+        (description "delta beta alpha omega epsilon lambda theta zeta")
+        (payload "gamma zeta alpha theta lambda lambda kappa beta theta sigma sigma zeta epsilon kappa gamma sigma")
+        (tags tag-omega tag-sigma tag-sigma tag-beta)
+        (values 54274 30627 66063 41629 88522 54284))
+    ;; record 450, exported from table gamma
+    (record-theta
+        (id 450)
+        (description "theta kappa epsilon kappa sigma zeta theta alpha")
+        (payload "gamma beta theta lambda beta lambda gamma theta gamma epsilon delta epsilon sigma beta theta omega")
+        (tags tag-epsilon tag-epsilon tag-epsilon tag-gamma)
+        (values 85882 39179 93255 46119 93217 19680))
+    ;; record 451, exported from table kappa
+    (record-epsilon
+        (id 451)
+        (description "sigma kappa beta gamma omega alpha kappa gamma")
+        (payload "gamma epsilon zeta zeta zeta beta omega delta gamma zeta omega alpha alpha alpha kappa zeta")
+        (tags tag-theta tag-zeta tag-epsilon tag-gamma)
+        (values 4471 14453 66779 8852 80839 41886))
+    ;; record 452, exported from table beta
+    (record-omega
+        (id 452)
+        (description "theta gamma kappa delta beta epsilon sigma beta")
+        (payload "theta delta gamma omega theta lambda sigma alpha lambda alpha delta kappa alpha omega zeta zeta")
+        (tags tag-alpha tag-kappa tag-zeta tag-lambda)
+        (values 84903 92688 1584 -670 66326 48026))
+    ;; record 453, exported from table beta
+    (record-lambda
+        (id 453)
+        (description "gamma beta alpha delta alpha delta delta lambda")
+        (payload "epsilon lambda beta kappa theta delta epsilon zeta delta zeta gamma delta sigma omega zeta omega")
+        (tags tag-kappa tag-beta tag-omega tag-alpha)
+        (values 15206 2881 82307 93869 62642 29971))
+    ;; record 454, exported from table zeta
+    (record-epsilon
+        (id 454)
+        (description "gamma theta epsilon gamma theta alpha theta delta")
+        (payload "omega sigma epsilon sigma alpha delta omega beta alpha gamma kappa delta beta kappa gamma theta")
+        (tags tag-delta tag-omega tag-sigma tag-zeta)
+        (values 5514 937 71636 89896 70246 30600))
+    ;; record 455, exported from table gamma
+    (record-epsilon
+        (id 455)
+        (description "lambda alpha sigma zeta zeta alpha delta beta")
+        (payload "kappa lambda theta alpha epsilon zeta zeta gamma alpha beta epsilon zeta delta zeta omega alpha")
+        (tags tag-gamma tag-theta tag-omega tag-zeta)
+        (values 76097 80940 11277 30950 -456 33819))
+    ;; record 456, exported from table omega
+    (record-gamma
+        (id 456)
+        (description "gamma theta beta gamma zeta alpha kappa theta")
+        (payload "alpha zeta alpha omega beta theta epsilon sigma lambda alpha theta beta delta sigma theta theta")
+        (tags tag-lambda tag-sigma tag-gamma tag-kappa)
+        (values 23773 29810 90441 85036 2537 62120))
+    ;; record 457, exported from table omega
+    (record-omega
+        (id 457)
+        (description "alpha lambda zeta kappa gamma epsilon alpha gamma")
+        (payload "alpha beta beta kappa delta beta beta epsilon lambda sigma alpha theta gamma delta theta alpha")
+        (tags tag-epsilon tag-kappa tag-sigma tag-sigma)
+        (values 33233 11863 2657 83399 61371 11010))
+    ;; record 458, exported from table delta
+    (record-theta
+        (id 458)
+        (description "lambda omega omega beta kappa theta kappa zeta")
+        (payload "delta kappa delta delta omega sigma alpha zeta kappa alpha sigma theta alpha delta sigma beta")
+        (tags tag-alpha tag-beta tag-sigma tag-beta)
+        (values 24087 36206 34672 28607 30986 98527))
+    ;; record 459, exported from table gamma
+    (record-kappa
+        (id 459)
+        (description "zeta gamma delta sigma theta sigma alpha omega")
+        (payload "beta sigma delta omega gamma theta epsilon beta beta sigma omega sigma lambda beta beta sigma")
+        (tags tag-alpha tag-kappa tag-beta tag-zeta)
+        (values 4308 39674 41306 61817 12858 18914))
+    ;; record 460, exported from table beta
+    (record-omega
+        (id 460)
+        (description "gamma kappa zeta omega alpha delta alpha zeta")
+        (payload "theta omega sigma beta theta alpha kappa omega beta delta zeta epsilon epsilon omega zeta gamma")
+        (tags tag-beta tag-epsilon tag-epsilon tag-theta)
+        (values 73740 20704 68304 5984 69884 87727))
+    ;; record 461, exported from table sigma
+    (record-alpha
+        (id 461)
+        (description "delta gamma theta sigma beta epsilon delta lambda")
+        (payload "kappa epsilon gamma theta kappa zeta kappa omega alpha lambda omega beta delta kappa epsilon epsilon")
+        (tags tag-alpha tag-sigma tag-kappa tag-kappa)
+        (values 88923 10734 81852 74296 4145 54409))
+    ;; record 462, exported from table epsilon
+    (record-delta
+        (id 462)
+        (description "gamma gamma beta gamma kappa omega delta zeta")
+        (payload "beta theta omega theta beta sigma alpha omega delta beta omega lambda kappa zeta zeta delta")
+        (tags tag-sigma tag-epsilon tag-epsilon tag-sigma)
+        (values 575 79519 91576 31252 46019 81034))
+    ;; record 463, exported from table delta
+    (record-gamma
+        (id 463)
+        (description "beta omega omega kappa alpha zeta theta gamma")
+        (payload "omega epsilon theta sigma sigma omega kappa alpha epsilon theta gamma lambda epsilon alpha gamma kappa")
+        (tags tag-theta tag-beta tag-theta tag-delta)
+        (values 81158 20368 34376 81944 85364 33429))
+    ;; record 464, exported from table sigma
+    (record-delta
+        (id 464)
+        (description "delta theta lambda epsilon gamma theta kappa theta")
+        (payload "lambda beta alpha alpha omega beta sigma theta theta zeta delta beta beta beta zeta gamma")
+        (tags tag-gamma tag-gamma tag-beta tag-delta)
+        (values 43923 19275 16767 51923 37087 31073))
+    ;; record 465, exported from table alpha
+    (record-lambda
+        (id 465)
+        (description "epsilon alpha delta zeta lambda lambda alpha lambda")
+        (payload "beta beta delta lambda sigma zeta epsilon theta zeta kappa epsilon alpha kappa sigma zeta theta")
+        (tags tag-delta tag-zeta tag-gamma tag-zeta)
+        (values 83126 73781 58364 7763 68793 76085))
+    ;; record 466, exported from table zeta
+    (record-beta
+        (id 466)
+        (description "omega theta alpha beta kappa alpha theta theta")
+        (payload "alpha delta kappa delta epsilon delta epsilon delta epsilon epsilon epsilon lambda beta omega kappa lambda")
+        (tags tag-beta tag-gamma tag-zeta tag-epsilon)
+        (values 1795 61915 41809 34212 93821 60280))
+    ;; record 467, exported from table gamma
+    (record-theta
+        (id 467)
+        (description "lambda lambda theta sigma zeta beta epsilon zeta")
+        (payload "gamma omega theta beta omega delta gamma beta gamma omega theta gamma gamma sigma epsilon gamma")
+        (tags tag-gamma tag-sigma tag-lambda tag-kappa)
+        (values 11625 85655 80009 56046 22862 85291))
+    ;; record 468, exported from table lambda
+    (record-epsilon
+        (id 468)
+        (description "omega sigma theta beta lambda sigma beta zeta")
+        (payload "epsilon gamma epsilon sigma kappa lambda kappa theta sigma theta sigma omega kappa beta gamma epsilon")
+        (tags tag-zeta tag-alpha tag-alpha tag-gamma)
+        (values 50075 -308 40945 6081 38901 72999))
+    ;; record 469, exported from table alpha
+    (record-epsilon
+        (id 469)
+        (description "delta delta lambda sigma epsilon epsilon beta sigma")
+        (payload "gamma omega gamma epsilon sigma alpha zeta zeta lambda gamma lambda delta sigma alpha beta kappa")
+        (tags tag-delta tag-beta tag-lambda tag-delta)
+        (values 54250 28696 60674 49465 76381 87549))
+    ;; record 470, exported from table theta
+    (record-beta
+        (id 470)
+        (description "lambda sigma lambda lambda theta lambda kappa gamma")
+        (payload "theta sigma omega lambda beta alpha beta omega alpha theta sigma theta sigma zeta epsilon sigma")
+        (tags tag-kappa tag-lambda tag-zeta tag-gamma)
+        (values 67204 95458 93084 24057 74634 47265))
+    ;; record 471, exported from table gamma
+    (record-alpha
+        (id 471)
+        (description "kappa beta delta theta epsilon beta delta epsilon")
+        (payload "epsilon sigma zeta omega omega alpha delta alpha alpha kappa sigma delta kappa gamma delta zeta")
+        (tags tag-theta tag-delta tag-delta tag-gamma)
+        (values 35302 34479 56323 65095 40459 8102))
+    ;; record 472, exported from table lambda
+    (record-theta
+        (id 472)
+        (description "gamma beta zeta beta epsilon theta delta beta")
+        (payload "alpha zeta delta sigma delta sigma epsilon kappa beta kappa epsilon kappa omega zeta epsilon epsilon")
+        (tags tag-gamma tag-epsilon tag-kappa tag-theta)
+        (values 70791 83673 4849 88008 38172 6409))
+    ;; record 473, exported from table kappa
+    (record-theta
+        (id 473)
+        (description "beta delta beta sigma delta alpha zeta delta")
+        (payload "alpha alpha theta zeta theta lambda delta delta alpha alpha delta theta alpha theta zeta epsilon")
+        (tags tag-lambda tag-theta tag-kappa tag-zeta)
+        (values 60605 95798 83668 65195 7629 46712))
+    ;; record 474, exported from table gamma
+    (record-omega
+        (id 474)
+        (description "lambda sigma sigma delta beta sigma alpha omega")
+        (payload "theta lambda beta sigma sigma kappa epsilon theta theta delta delta gamma beta lambda lambda kappa")
+        (tags tag-omega tag-delta tag-omega tag-beta)
+        (values 97933 67490 56837 72235 43285 77325))
+    ;; record 475, exported from table alpha
+    (record-kappa
+        (id 475)
+        (description "theta epsilon beta omega lambda omega gamma zeta")
+        (payload "theta delta omega kappa epsilon gamma omega epsilon lambda zeta beta theta epsilon theta alpha omega")
+        (tags tag-epsilon tag-delta tag-lambda tag-theta)
+        (values 771 38259 99140 84726 18386 77356))
+    ;; record 476, exported from table alpha
+    (record-sigma
+        (id 476)
+        (description "theta delta sigma lambda epsilon gamma sigma sigma")
+        (payload "delta zeta sigma delta zeta sigma epsilon zeta alpha omega sigma epsilon beta theta lambda zeta")
+        (tags tag-beta tag-omega tag-lambda tag-epsilon)
+        (values 76270 39528 -3 11559 86791 7074))
+    ;; record 477, exported from table zeta
+    (record-sigma
+        (id 477)
+        (description "gamma lambda gamma kappa theta omega delta omega")
+        (payload "kappa lambda zeta delta gamma gamma delta sigma gamma kappa theta delta theta beta alpha epsilon")
+        (tags tag-delta tag-delta tag-lambda tag-kappa)
+        (values 79039 27501 40864 13811 79364 34158))
+    ;; record 478, exported from table kappa
+    (record-kappa
+        (id 478)
+        (description "beta delta delta omega lambda kappa lambda alpha")
+        (payload "lambda alpha alpha omega zeta kappa omega lambda epsilon sigma beta zeta delta epsilon alpha theta")
+        (tags tag-beta tag-lambda tag-gamma tag-gamma)
+        (values 30845 41908 56755 47931 15051 94497))
+    ;; record 479, exported from table lambda
+    (record-omega
+        (id 479)
+        (description "gamma beta theta alpha gamma theta omega sigma")
+        (payload "lambda omega omega zeta alpha beta kappa gamma omega epsilon theta gamma epsilon theta omega epsilon")
+        (tags tag-alpha tag-sigma tag-sigma tag-kappa)
+        (values 27528 59477 18984 5068 72367 2215))
+    ;; record 480, exported from table gamma
+    (record-alpha
+        (id 480)
+        (description "alpha lambda theta zeta sigma lambda alpha epsilon")
+        (payload "gamma delta lambda epsilon delta gamma lambda omega theta sigma beta omega theta omega zeta alpha")
+        (tags tag-epsilon tag-epsilon tag-omega tag-theta)
+        (values 52351 15281 19075 82151 81348 40285))
+    ;; record 481, exported from table delta
+    (record-delta
+        (id 481)
+        (description "epsilon sigma theta omega kappa omega alpha gamma")
+        (payload "beta delta omega sigma omega kappa lambda alpha omega delta theta theta alpha lambda alpha beta")
+        (tags tag-lambda tag-omega tag-delta tag-epsilon)
+        (values 34174 5717 66926 1839 92281 49862))
+    ;; record 482, exported from table zeta
+    (record-sigma
+        (id 482)
+        (description "delta omega epsilon kappa gamma epsilon omega omega")
+        (payload "lambda gamma delta delta beta zeta omega theta alpha epsilon alpha omega beta delta kappa alpha")
+        (tags tag-beta tag-epsilon tag-kappa tag-omega)
+        (values 27961 18874 81632 41860 96288 97529))
+    ;; record 483, exported from table epsilon
+    (record-delta
+        (id 483)
+        (description "theta omega beta kappa alpha alpha lambda omega")
+        (payload "gamma theta sigma lambda gamma kappa theta sigma beta kappa omega omega sigma theta lambda alpha")
+        (tags tag-epsilon tag-alpha tag-zeta tag-alpha)
+        (values 52801 5918 18965 61702 25093 12572))
+    ;; record 484, exported from table theta
+    (record-beta
+        (id 484)
+        (description "lambda delta epsilon omega alpha gamma zeta alpha")
+        (payload "zeta delta alpha alpha zeta lambda sigma sigma beta gamma alpha delta theta alpha epsilon lambda")
+        (tags tag-gamma tag-beta tag-beta tag-epsilon)
+        (values 95035 91479 43606 54773 5833 33082))
+    ;; record 485, exported from table delta
+    (record-kappa
+        (id 485)
+        (description "gamma omega lambda theta theta theta sigma kappa")
+        (payload "delta epsilon zeta zeta theta theta alpha sigma zeta lambda omega beta beta delta omega lambda")
+        (tags tag-alpha tag-delta tag-theta tag-theta)
+        (values 54906 99 6413 37865 65664 94409))
+    ;; record 486, exported from table beta
+    (record-omega
+        (id 486)
+        (description "theta beta gamma delta delta delta gamma alpha")
+        (payload "theta zeta sigma omega zeta alpha epsilon sigma epsilon zeta delta omega delta lambda omega sigma")
+        (tags tag-omega tag-alpha tag-zeta tag-zeta)
+        (values 19502 20115 34945 61125 39295 -482))
+    ;; record 487, exported from table omega
+    (record-epsilon
+        (id 487)
+        (description "lambda theta epsilon sigma zeta gamma alpha alpha")
+        (payload "sigma kappa alpha omega theta lambda gamma omega sigma beta theta alpha delta delta omega beta")
+        (tags tag-omega tag-beta tag-alpha tag-sigma)
+        (values 99311 66771 22595 34366 49178 81082))
+    ;; record 488, exported from table lambda
+    (record-omega
+        (id 488)
+        (description "gamma kappa sigma omega sigma lambda gamma theta")
+        (payload "gamma gamma alpha sigma kappa alpha beta beta alpha delta alpha delta zeta omega gamma delta")
+        (tags tag-beta tag-kappa tag-omega tag-alpha)
+        (values 64152 68701 82224 54814 76562 67383))
+    ;; record 489, exported from table theta
+    (record-omega
+        (id 489)
+        (description "lambda epsilon delta omega sigma kappa lambda beta")
+        (payload "kappa kappa lambda gamma theta beta kappa delta gamma omega zeta theta zeta zeta theta sigma")
+        (tags tag-omega tag-delta tag-alpha tag-epsilon)
+        (values 13886 73521 52861 82173 68567 72210))
+    ;; record 490, exported from table theta
+    (record-epsilon
+        (id 490)
+        (description "lambda lambda alpha lambda gamma theta lambda alpha")
+        (payload "omega theta zeta theta epsilon beta alpha alpha epsilon alpha theta gamma theta kappa lambda gamma")
+        (tags tag-lambda tag-theta tag-epsilon tag-alpha)
+        (values 98877 24892 24417 97280 13997 96937))
+    ;; record 491, exported from table sigma
+    (record-theta
+        (id 491)
+        (description "sigma theta epsilon gamma sigma sigma sigma lambda")
+        (payload "beta lambda kappa lambda alpha zeta alpha delta zeta beta delta kappa beta kappa lambda kappa")
+        (tags tag-epsilon tag-epsilon tag-zeta tag-epsilon)
+        (values 67643 70117 10299 71316 72749 82992))
+    ;; record 492, exported from table beta
+    (record-zeta
+        (id 492)
+        (description "alpha gamma lambda zeta omega alpha omega kappa")
+        (payload "gamma zeta beta omega epsilon omega beta gamma theta kappa theta alpha kappa epsilon kappa epsilon")
+        (tags tag-sigma tag-zeta tag-delta tag-lambda)
+        (values 29641 80797 84699 33001 73392 96258))
+    ;; record 493, exported from table delta
+    (record-kappa
+        (id 493)
+        (description "beta beta lambda alpha alpha alpha gamma alpha")
+        (payload "gamma zeta alpha kappa zeta zeta omega kappa gamma lambda gamma theta beta lambda alpha lambda")
+        (tags tag-beta tag-gamma tag-sigma tag-sigma)
+        (values 10524 92718 21219 23917 20942 23498))
+    ;; record 494, exported from table lambda
+    (record-alpha
+        (id 494)
+        (description "lambda kappa sigma gamma delta beta omega lambda")
+        (payload "omega epsilon epsilon omega theta alpha gamma omega lambda sigma omega kappa gamma epsilon omega beta")
+        (tags tag-alpha tag-theta tag-gamma tag-epsilon)
+        (values 14362 72683 16210 445 6848 55419))
+    ;; record 495, exported from table epsilon
+    (record-alpha
+        (id 495)
+        (description "omega beta gamma theta alpha beta zeta lambda")
+        (payload "zeta sigma omega sigma zeta theta beta zeta omega zeta delta lambda omega lambda gamma sigma")
+        (tags tag-gamma tag-sigma tag-lambda tag-epsilon)
+        (values 70534 44611 9157 83165 46155 40763))
+    ;; record 496, exported from table omega
+    (record-kappa
+        (id 496)
+        (description "omega kappa delta zeta gamma theta zeta theta")
+        (payload "lambda lambda zeta gamma zeta zeta gamma beta gamma zeta lambda sigma zeta sigma theta epsilon")
+        (tags tag-gamma tag-zeta tag-beta tag-omega)
+        (values 66717 75196 29138 30758 62824 43935))
+    ;; record 497, exported from table sigma
+    (record-epsilon
+        (id 497)
+        (description "alpha lambda alpha omega delta kappa sigma sigma")
+        (payload "zeta delta zeta omega epsilon sigma theta zeta gamma zeta lambda kappa delta kappa kappa theta")
+        (tags tag-theta tag-beta tag-lambda tag-omega)
+        (values 92843 40670 33229 82749 47199 2047))
+    ;; record 498, exported from table beta
+    (record-kappa
+        (id 498)
+        (description "theta omega delta sigma beta epsilon omega alpha")
+        (payload "beta epsilon beta omega gamma gamma zeta beta lambda beta beta alpha zeta epsilon gamma delta")
+        (tags tag-theta tag-theta tag-omega tag-alpha)
+        (values 10577 10875 51270 56805 45711 75276))
+    ;; record 499, exported from table alpha
+    (record-zeta
+        (id 499)
+        (description "alpha gamma kappa sigma epsilon sigma theta delta")
+        (payload "lambda epsilon sigma beta beta omega gamma omega lambda lambda sigma theta kappa theta delta lambda")
+        (tags tag-omega tag-kappa tag-delta tag-alpha)
+        (values 10608 36853 90984 56642 51154 42579))
+    ;; record 500, exported from table alpha
+    (record-zeta
+        (id 500)
+        (description "gamma sigma kappa alpha alpha epsilon zeta kappa")
+        (payload "delta gamma lambda kappa zeta zeta delta theta omega beta lambda gamma zeta omega gamma epsilon")
+        (tags tag-sigma tag-lambda tag-alpha tag-lambda)
+        (values 58728 35305 50044 54047 37565 62218))
+    ;; record 501, exported from table sigma
+    (record-gamma
+        (id 501)
+        (description "gamma epsilon kappa sigma kappa gamma epsilon kappa")
+        (payload "omega beta omega kappa lambda kappa gamma theta gamma omega sigma zeta gamma alpha lambda kappa")
+        (tags tag-theta tag-lambda tag-omega tag-sigma)
+        (values 58 70139 76397 50948 65793 96577))
+    ;; record 502, exported from table lambda
+    (record-kappa
+        (id 502)
+        (description "alpha alpha gamma beta epsilon delta delta epsilon")
+        (payload "omega gamma alpha omega delta gamma zeta delta delta delta lambda epsilon beta beta alpha kappa")
+        (tags tag-delta tag-kappa tag-sigma tag-beta)
+        (values 68276 11636 21634 23568 96579 34879))
+    ;; record 503, exported from table kappa
+    (record-beta
+        (id 503)
+        (description "epsilon beta lambda lambda beta sigma epsilon theta")
+        (payload "alpha epsilon omega sigma theta beta omega gamma alpha omega alpha zeta gamma gamma kappa epsilon")
+        (tags tag-zeta tag-alpha tag-lambda tag-kappa)
+        (values 47310 68679 23520 59064 67296 26602))
+    ;; record 504, exported from table kappa
+    (record-epsilon
+        (id 504)
+        (description "omega theta zeta delta theta sigma alpha omega")
+        (payload "alpha lambda alpha delta delta zeta gamma omega theta gamma gamma zeta omega kappa gamma omega")
+        (tags tag-epsilon tag-gamma tag-zeta tag-delta)
+        (values 45152 81075 78183 53215 26757 25618))
+    ;; record 505, exported from table gamma
+    (record-kappa
+        (id 505)
+        (description "lambda zeta lambda omega sigma lambda delta gamma")
+        (payload "lambda delta omega gamma alpha gamma theta beta kappa beta sigma kappa theta gamma sigma zeta")
+        (tags tag-gamma tag-alpha tag-alpha tag-epsilon)
+        (values 43602 56041 47636 22115 6637 66560))
+    ;; record 506, exported from table epsilon
+    (record-sigma
+        (id 506)
+        (description "omega beta theta omega omega alpha omega gamma")
+        (payload "gamma epsilon sigma gamma alpha epsilon gamma delta gamma beta lambda alpha beta kappa gamma sigma")
+        (tags tag-zeta tag-kappa tag-beta tag-omega)
+        (values 60922 11343 23225 10562 50236 3661))
+    ;; record 507, exported from table kappa
+    (record-theta
+        (id 507)
+        (description "sigma omega omega epsilon kappa kappa beta omega")
+        (payload "lambda gamma kappa sigma kappa zeta omega beta gamma theta kappa sigma omega sigma epsilon delta")
+        (tags tag-alpha tag-epsilon tag-gamma tag-gamma)
+        (values 63829 43631 15898 91950 69328 54558))
+    ;; record 508, exported from table zeta
+    (record-lambda
+        (id 508)
+        (description "delta delta lambda zeta alpha zeta gamma alpha")
+        (payload "delta zeta kappa alpha lambda sigma beta theta zeta kappa alpha gamma omega theta alpha sigma")
+        (tags tag-zeta tag-epsilon tag-theta tag-lambda)
+        (values 25861 68583 39556 35706 63404 46272))
+    ;; record 509, exported from table alpha
+    (record-sigma
+        (id 509)
+        (description "gamma theta kappa omega zeta sigma epsilon beta")
+        (payload "theta epsilon zeta alpha alpha omega epsilon gamma zeta theta alpha gamma zeta beta omega lambda")
+        (tags tag-beta tag-gamma tag-omega tag-lambda)
+        (values 19804 46256 43664 66928 46458 72651))
+    ;; record 510, exported from table omega
+    (record-kappa
+        (id 510)
+        (description "beta sigma theta epsilon beta epsilon lambda omega")
+        (payload "theta alpha gamma beta sigma theta omega sigma delta sigma omega delta kappa lambda kappa lambda")
+        (tags tag-alpha tag-gamma tag-beta tag-gamma)
+        (values 9828 52969 35742 73720 65804 36094))
+    ;; record 511, exported from table alpha
+    (record-beta
+        (id 511)
+        (description "gamma zeta zeta beta alpha epsilon zeta epsilon")
+        (payload "zeta alpha delta sigma theta alpha lambda beta omega omega beta theta kappa sigma beta lambda")
+        (tags tag-kappa tag-gamma tag-sigma tag-theta)
+        (values 33854 92469 17371 54876 50335 77568))
+    ;; record 512, exported from table zeta
+    (record-omega
+        (id 512)
+        (description "gamma beta beta lambda beta kappa alpha kappa")
+        (payload "sigma sigma kappa sigma sigma sigma beta epsilon sigma zeta kappa lambda theta zeta gamma sigma")
+        (tags tag-lambda tag-delta tag-alpha tag-sigma)
+        (values 18688 36704 25440 73886 62253 71427))
+    ;; record 513, exported from table omega
+    (record-kappa
+        (id 513)
+        (description "epsilon theta delta beta theta beta delta lambda")
+        (payload "gamma theta sigma delta alpha gamma kappa zeta sigma kappa sigma beta gamma gamma gamma omega")
+        (tags tag-lambda tag-kappa tag-lambda tag-beta)
+        (values 45708 69901 66174 88547 22157 74130))
+    ;; record 514, exported from table sigma
+    (record-sigma
+        (id 514)
+        (description "sigma beta theta beta kappa zeta zeta sigma")
+        (payload "lambda alpha theta zeta gamma epsilon alpha delta epsilon gamma zeta beta epsilon epsilon sigma lambda")
+        (tags tag-sigma tag-theta tag-alpha tag-kappa)
+        (values 81244 6458 87749 81406 80851 60279))
+    ;; record 515, exported from table delta
+    (record-delta
+        (id 515)
+        (description "gamma kappa beta beta beta omega omega alpha")
+        (payload "alpha kappa gamma zeta epsilon sigma sigma sigma alpha theta gamma delta alpha alpha omega zeta")
+        (tags tag-lambda tag-beta tag-theta tag-zeta)
+        (values 39222 19775 52167 36740 2228 3792))
+    ;; record 516, exported from table gamma
+    (record-omega
+        (id 516)
+        (description "delta beta kappa theta delta alpha zeta zeta")
+        (payload "zeta zeta beta zeta omega sigma beta zeta epsilon lambda theta zeta epsilon theta kappa kappa")
+        (tags tag-lambda tag-zeta tag-omega tag-beta)
+        (values 71976 7919 64660 91983 49130 56856))
+    ;; record 517, exported from table alpha
+    (record-alpha
+        (id 517)
+        (description "theta zeta beta zeta kappa alpha beta sigma")
+        (payload "delta sigma theta sigma delta sigma lambda omega theta lambda epsilon kappa omega zeta beta lambda")
+        (tags tag-kappa tag-lambda tag-lambda tag-kappa)
+        (values 96945 66335 91116 69504 69511 55678))
+    ;; record 518, exported from table omega
+    (record-gamma
+        (id 518)
+        (description "zeta epsilon kappa epsilon gamma alpha delta kappa")
+        (payload "theta kappa alpha gamma zeta kappa omega alpha sigma beta gamma gamma epsilon epsilon epsilon beta")
+        (tags tag-zeta tag-gamma tag-gamma tag-epsilon)
+        (values 42926 49241 50059 93172 34394 82359))
+    ;; record 519, exported from table sigma
+    (record-alpha
+        (id 519)
+        (description "alpha zeta delta alpha theta omega gamma kappa")
+        (payload "delta gamma zeta zeta alpha epsilon alpha beta beta lambda delta beta sigma alpha kappa gamma")
+        (tags tag-sigma tag-alpha tag-lambda tag-zeta)
+        (values 25687 65465 92457 4466 69901 60055))
+    ;; record 520, exported from table kappa
+    (record-kappa
+        (id 520)
+        (description "sigma theta beta sigma beta beta gamma alpha")
+        (payload "sigma sigma alpha omega epsilon omega zeta sigma delta zeta alpha beta gamma theta theta gamma")
+        (tags tag-theta tag-beta tag-omega tag-gamma)
+        (values 7297 53750 89207 64585 14548 14883))
+    ;; record 521, exported from table omega
+    (record-kappa
+        (id 521)
+        (description "theta theta gamma delta beta epsilon gamma delta")
+        (payload "alpha zeta theta zeta alpha omega omega zeta kappa gamma epsilon alpha zeta gamma beta lambda")
+        (tags tag-alpha tag-alpha tag-theta tag-sigma)
+        (values 93529 77259 10546 66670 31115 93531))
+    ;; record 522, exported from table theta
+    (record-delta
+        (id 522)
+        (description "delta alpha gamma gamma lambda lambda theta theta")
+        (payload "lambda beta zeta gamma beta delta beta delta epsilon delta theta beta omega sigma theta beta")
+        (tags tag-kappa tag-theta tag-sigma tag-lambda)
+        (values 26495 48471 77688 52385 52109 22926))
+    ;; record 523, exported from table epsilon
+    (record-sigma
+        (id 523)
+        (description "alpha beta gamma theta alpha sigma lambda epsilon")
+        (payload "omega alpha beta gamma beta lambda kappa alpha epsilon zeta omega kappa lambda kappa epsilon gamma")
+        (tags tag-lambda tag-epsilon tag-gamma tag-lambda)
+        (values 69246 16081 66320 65264 95247 15797))
+    ;; record 524, exported from table epsilon
+    (record-kappa
+        (id 524)
+        (description "epsilon epsilon epsilon theta kappa epsilon delta theta")
+        (payload "beta omega theta lambda zeta lambda zeta sigma delta omega kappa alpha gamma theta delta beta")
+        (tags tag-omega tag-epsilon tag-lambda tag-theta)
+        (values 53134 64581 26079 62452 50571 18305))
+    ;; record 525, exported from table omega
+    (record-lambda
+        (id 525)
+        (description "zeta omega epsilon gamma alpha beta gamma delta")
+        (payload "theta sigma beta delta lambda theta kappa zeta kappa sigma zeta gamma zeta theta epsilon omega")
+        (tags tag-lambda tag-epsilon tag-kappa tag-kappa)
+        (values 6956 29978 82156 47148 86878 66753))
+    ;; record 526, exported from table beta
+    (record-omega
+        (id 526)
+        (description "kappa theta theta epsilon zeta lambda alpha epsilon")
+        (payload "omega beta epsilon gamma epsilon alpha kappa beta delta zeta gamma beta omega delta delta kappa")
+        (tags tag-alpha tag-gamma tag-gamma tag-lambda)
+        (values 73545 49909 93067 90442 79417 17919))
+    ;; record 527, exported from table sigma
+    (record-beta
+        (id 527)
+        (description "zeta sigma gamma delta sigma lambda alpha delta")
+        (payload "kappa alpha beta zeta alpha zeta alpha theta sigma delta delta sigma alpha gamma zeta kappa")
+        (tags tag-sigma tag-delta tag-lambda tag-gamma)
+        (values 22577 5942 77415 -245 58094 72944))
+    ;; record 528, exported from table theta
+    (record-delta
+        (id 528)
+        (description "theta gamma omega sigma omega theta zeta gamma")
+        (payload "epsilon epsilon omega beta zeta theta zeta epsilon sigma kappa delta epsilon beta lambda beta epsilon")
+        (tags tag-gamma tag-gamma tag-omega tag-gamma)
+        (values 83923 99710 69427 1183 60444 70711))
+    ;; record 529, exported from table beta
+    (record-kappa
+        (id 529)
+        (description "lambda omega sigma sigma omega kappa omega beta")
+        (payload "zeta theta lambda sigma sigma lambda zeta theta kappa epsilon omega epsilon gamma zeta gamma omega")
+        (tags tag-zeta tag-delta tag-sigma tag-theta)
+        (values -754 62255 44872 46483 38150 21780))
+    ;; record 530, exported from table lambda
+    (record-sigma
+        (id 530)
+        (description "lambda theta sigma omega omega beta epsilon omega")
+        (payload "epsilon epsilon lambda zeta zeta kappa omega beta kappa epsilon epsilon epsilon omega theta theta theta")
+        (tags tag-epsilon tag-delta tag-sigma tag-theta)
+        (values 59579 12376 44506 12009 22909 70691))
+    ;; record 531, exported from table delta
+    (record-zeta
+        (id 531)
+        (description "gamma alpha delta gamma lambda epsilon gamma beta")
+        (payload "lambda gamma beta gamma alpha gamma epsilon epsilon omega kappa epsilon delta omega gamma kappa kappa")
+        (tags tag-omega tag-theta tag-theta tag-epsilon)
+        (values 77297 13584 87712 84230 25323 36554))
+    ;; record 532, exported from table alpha
+    (record-delta
+        (id 532)
+        (description "alpha epsilon omega beta delta lambda beta sigma")
+        (payload "epsilon alpha epsilon delta theta sigma gamma gamma alpha omega kappa lambda theta theta sigma gamma")
+        (tags tag-zeta tag-alpha tag-sigma tag-zeta)
+        (values 88158 90193 5044 27449 88213 53055))
+    ;; record 533, exported from table lambda
+    (record-lambda
+        (id 533)
+        (description "zeta omega alpha zeta delta beta alpha epsilon")
+        (payload "kappa kappa alpha kappa sigma gamma gamma epsilon lambda theta lambda sigma beta theta omega delta")
+        (tags tag-sigma tag-omega tag-zeta tag-epsilon)
+        (values 86 55667 9169 45066 28316 74752))
+    ;; record 534, exported from table epsilon
+    (record-sigma
+        (id 534)
+        (description "theta gamma gamma gamma omega delta gamma lambda")
+        (payload "alpha delta gamma omega omega lambda gamma lambda delta lambda epsilon zeta lambda lambda omega delta")
+        (tags tag-zeta tag-theta tag-gamma tag-sigma)
+        (values 77501 47885 85707 68960 21841 41590))
+    ;; record 535, exported from table sigma
+    (record-gamma
+        (id 535)
+        (description "zeta kappa omega sigma kappa omega kappa gamma")
+        (payload "lambda kappa zeta lambda sigma sigma beta gamma zeta sigma beta delta lambda theta sigma zeta")
+        (tags tag-epsilon tag-delta tag-zeta tag-delta)
+        (values 48592 59984 37172 39374 64981 28973))
+    ;; record 536, exported from table sigma
+    (record-theta
+        (id 536)
+        (description "lambda gamma lambda epsilon lambda lambda alpha zeta")
+        (payload "beta kappa lambda delta sigma epsilon beta gamma zeta omega kappa delta alpha delta zeta beta")
+        (tags tag-zeta tag-theta tag-delta tag-theta)
+        (values 98261 69028 48680 11277 92512 49936))
+    ;; record 537, exported from table zeta
+    (record-zeta
+        (id 537)
+        (description "alpha beta gamma kappa kappa epsilon kappa delta")
+        (payload "beta sigma lambda beta epsilon epsilon sigma gamma lambda kappa kappa delta theta zeta kappa epsilon")
+        (tags tag-delta tag-zeta tag-lambda tag-kappa)
+        (values 13011 98821 77773 64403 8999 6617))
+    ;; record 538, exported from table gamma
+    (record-epsilon
+        (id 538)
+        (description "alpha beta alpha theta delta delta epsilon epsilon")
+        (payload "theta theta sigma kappa beta beta alpha lambda omega delta kappa beta kappa theta beta omega")
+        (tags tag-omega tag-delta tag-omega tag-sigma)
+        (values 46789 87779 77093 43771 17805 97682))
+    ;; record 539, exported from table lambda
+    (record-kappa
+        (id 539)
+        (description "alpha beta theta sigma omega zeta epsilon omega")
+        (payload "theta sigma theta gamma delta beta beta beta lambda epsilon zeta sigma sigma kappa beta beta")
+        (tags tag-theta tag-theta tag-alpha tag-theta)
+        (values 76175 70055 31571 80592 35608 41725))
+    ;; record 540, exported from table alpha
+    (record-lambda
+        (id 540)
+        (description "gamma lambda theta gamma sigma epsilon gamma epsilon")
+        (payload "epsilon theta gamma lambda alpha omega epsilon delta gamma epsilon zeta kappa beta gamma sigma theta")
+        (tags tag-zeta tag-alpha tag-omega tag-alpha)
+        (values 22509 85638 59531 79154 55150 2440))
+    ;; record 541, exported from table delta
+    (record-theta
+        (id 541)
+        (description "gamma kappa lambda epsilon sigma sigma zeta gamma")
+        (payload "gamma zeta gamma lambda theta epsilon theta kappa beta gamma alpha beta zeta sigma gamma kappa")
+        (tags tag-zeta tag-delta tag-gamma tag-beta)
+        (values 19538 55718 90617 74220 66248 71484))
+    ;; record 542, exported from table alpha
+    (record-beta
+        (id 542)
+        (description "beta alpha epsilon sigma kappa alpha omega gamma")
+        (payload "theta lambda alpha gamma lambda omega delta theta epsilon lambda zeta epsilon lambda delta beta omega")
+        (tags tag-gamma tag-delta tag-kappa tag-delta)
+        (values 91421 66064 22295 5894 51489 11869))
+    ;; record 543, exported from table sigma
+    (record-omega
+        (id 543)
+        (description "beta theta delta sigma zeta beta sigma kappa")
+        (payload "sigma alpha beta kappa alpha kappa epsilon lambda gamma theta theta delta alpha lambda alpha kappa")
+        (tags tag-gamma tag-zeta tag-alpha tag-omega)
+        (values 79872 40411 15840 32181 51735 84421))
+    ;; record 544, exported from table alpha
+    (record-gamma
+        (id 544)
+        (description "omega alpha theta delta delta delta alpha epsilon")
+        (payload "sigma theta lambda delta alpha lambda theta alpha sigma theta delta zeta lambda alpha sigma beta")
+        (tags tag-zeta tag-delta tag-omega tag-kappa)
+        (values 16204 50092 97505 94068 46343 58637))
+    ;; record 545, exported from table gamma
+    (record-omega
+        (id 545)
+        (description "beta lambda zeta delta delta omega delta lambda")
+        (payload "zeta lambda beta alpha lambda theta alpha epsilon zeta omega zeta zeta theta lambda lambda epsilon")
+        (tags tag-theta tag-alpha tag-epsilon tag-beta)
+        (values 14115 95728 13733 91512 10318 63288))
+    ;; record 546, exported from table omega
+    (record-alpha
+        (id 546)
+        (description "epsilon omega zeta alpha kappa gamma zeta omega")
+        (payload "delta beta zeta lambda lambda kappa gamma epsilon lambda zeta gamma beta alpha lambda sigma gamma")
+        (tags tag-gamma tag-delta tag-gamma tag-sigma)
+        (values 71884 17577 50349 22545 63224 78419))
+    ;; record 547, exported from table lambda
+    (record-kappa
+        (id 547)
+        (description "epsilon omega lambda delta kappa alpha theta lambda")
+        (payload "theta zeta gamma gamma lambda alpha theta gamma alpha lambda sigma sigma gamma sigma theta alpha")
+        (tags tag-omega tag-alpha tag-lambda tag-kappa)
+        (values 59180 19033 75524 99380 14984 77137))
+    ;; record 548, exported from table sigma
+    (record-epsilon
+        (id 548)
+        (description "theta sigma delta zeta zeta sigma omega epsilon")
+        (payload "theta kappa delta epsilon omega zeta theta beta beta delta beta zeta sigma omega gamma sigma")
+        (tags tag-gamma tag-kappa tag-beta tag-epsilon)
+        (values 25104 27581 22489 19555 7616 84199))
+    ;; record 549, exported from table theta
+    (record-alpha
+        (id 549)
+        (description "alpha sigma kappa alpha beta delta epsilon sigma")
+        (payload "theta theta alpha lambda alpha sigma zeta omega beta beta zeta sigma lambda zeta alpha delta")
+        (tags tag-beta tag-delta tag-theta tag-lambda)
+        (values 10802 11384 89630 94153 71592 55803))
+    ;; record 550, exported from table alpha
+    (record-gamma
+        (id 550)
+        (description "zeta epsilon theta gamma kappa gamma delta kappa")
+        (payload "epsilon omega kappa theta lambda epsilon kappa gamma zeta zeta sigma theta epsilon omega alpha epsilon")
+        (tags tag-delta tag-lambda tag-gamma tag-beta)
+        (values 31782 22946 66913 93260 7435 48833))
+    ;; record 551, exported from table gamma
+    (record-sigma
+        (id 551)
+        (description "zeta zeta omega theta theta sigma lambda gamma")
+        (payload "kappa theta alpha beta omega kappa zeta omega zeta alpha zeta delta gamma omega gamma theta")
+        (tags tag-lambda tag-zeta tag-theta tag-delta)
+        (values 12508 14575 43055 43404 63645 5893))
+    ;; record 552, exported from table alpha
+    (record-theta
+        (id 552)
+        (description "gamma epsilon alpha alpha zeta beta gamma epsilon")
+        (payload "kappa epsilon sigma delta delta omega beta epsilon zeta theta omega kappa zeta gamma omega kappa")
+        (tags tag-theta tag-epsilon tag-epsilon tag-gamma)
+        (values -835 73635 46364 44389 15465 22406))
+    ;; record 553, exported from table alpha
+    (record-gamma
+        (id 553)
+        (description "delta beta delta lambda zeta sigma epsilon beta")
+        (payload "omega epsilon kappa lambda gamma alpha beta theta gamma lambda delta beta epsilon gamma alpha gamma")
+        (tags tag-sigma tag-zeta tag-kappa tag-beta)
+        (values 57869 82194 73846 83373 26193 86194))
+    ;; record 554, exported from table omega
+    (record-epsilon
+        (id 554)
+        (description "gamma zeta delta delta gamma lambda omega beta")
+        (payload "lambda sigma theta beta beta lambda sigma delta gamma beta theta omega epsilon epsilon sigma gamma")
+        (tags tag-sigma tag-kappa tag-theta tag-lambda)
+        (values 58003 38359 64314 39506 56297 82876))
+    ;; record 555, exported from table omega
+    (record-beta
+        (id 555)
+        (description "zeta sigma alpha delta lambda kappa delta omega")
+        (payload "kappa lambda sigma beta omega omega omega theta theta lambda omega delta kappa kappa zeta zeta")
+        (tags tag-zeta tag-kappa tag-gamma tag-alpha)
+        (values 68540 64601 39213 75681 92300 39699))
+    ;; record 556, exported from table theta
+    (record-kappa
+        (id 556)
+        (description "delta gamma zeta delta sigma beta gamma omega")
+        (payload "lambda zeta omega alpha epsilon delta epsilon lambda alpha theta sigma gamma alpha sigma beta theta")
+        (tags tag-delta tag-theta tag-omega tag-delta)
+        (values 48680 79662 92231 59441 74667 92563))
+    ;; record 557, exported from table delta
+    (record-kappa
+        (id 557)
+        (description "omega gamma sigma epsilon alpha kappa sigma sigma")
+        (payload "omega delta omega zeta gamma beta omega gamma epsilon sigma epsilon beta beta theta gamma beta")
+        (tags tag-kappa tag-beta tag-gamma tag-lambda)
+        (values 22266 99383 1443 60664 78935 44608))
+    ;; record 558, exported from table zeta
+    (record-omega
+        (id 558)
+        (description "theta beta sigma zeta beta delta delta sigma")
+        (payload "alpha gamma sigma kappa kappa omega zeta zeta alpha epsilon lambda theta delta lambda zeta kappa")
+        (tags tag-sigma tag-delta tag-beta tag-beta)
+        (values 11943 57276 15183 95461 30470 30452))
+    ;; record 559, exported from table omega
+    (record-beta
+        (id 559)
+        (description "epsilon kappa omega omega beta zeta omega lambda")
+        (payload "delta theta lambda kappa delta epsilon delta lambda gamma kappa omega gamma sigma gamma zeta kappa")
+        (tags tag-kappa tag-zeta tag-gamma tag-omega)
+        (values 68414 3264 80634 17072 33079 39499))
+    ;; record 560, exported from table kappa
+    (record-omega
+        (id 560)
+        (description "theta alpha epsilon sigma omega sigma lambda delta")
+        (payload "theta theta sigma gamma epsilon lambda zeta gamma sigma delta omega omega beta sigma sigma omega")
+        (tags tag-beta tag-theta tag-lambda tag-epsilon)
+        (values 96707 48861 96104 53248 78704 66145))
+    ;; record 561, exported from table epsilon
+    (record-beta
+        (id 561)
+        (description "delta theta delta lambda kappa beta epsilon omega")
+        (payload "alpha theta theta sigma omega omega sigma lambda alpha lambda kappa gamma delta sigma kappa zeta")
+        (tags tag-beta tag-zeta tag-theta tag-beta)
+        (values 40144 16296 48861 44033 88153 2632))
+    ;; record 562, exported from table theta
+    (record-beta
+        (id 562)
+        (description "alpha sigma gamma epsilon lambda delta kappa omega")
+        (payload "epsilon gamma beta delta zeta gamma epsilon omega beta delta kappa alpha delta zeta zeta delta")
+        (tags tag-zeta tag-alpha tag-gamma tag-gamma)
+        (values 17998 58976 77386 45390 17940 88979))
+    ;; record 563, exported from table theta
+    (record-zeta
+        (id 563)
+        (description "sigma delta theta gamma kappa delta gamma gamma")
+        (payload "lambda gamma kappa alpha kappa alpha delta beta delta omega sigma omega zeta kappa theta theta")
+        (tags tag-gamma tag-lambda tag-beta tag-kappa)
+        (values 22691 89296 15090 2583 67543 88083))
+    ;; record 564, exported from table zeta
+    (record-gamma
+        (id 564)
+        (description "zeta sigma delta epsilon theta delta gamma epsilon")
+        (payload "gamma theta delta beta delta beta epsilon theta beta omega delta sigma zeta epsilon theta sigma")
+        (tags tag-kappa tag-epsilon tag-lambda tag-epsilon)
+        (values 43119 39254 72855 78079 93921 18248))
+    ;; record 565, exported from table beta
+    (record-zeta
+        (id 565)
+        (description "theta zeta beta omega beta zeta kappa delta")
+        (payload "delta epsilon delta kappa lambda delta theta epsilon lambda lambda sigma theta alpha lambda gamma zeta")
+        (tags tag-gamma tag-zeta tag-beta tag-lambda)
+        (values 53412 49937 97612 32413 36402 33836))
+    ;; record 566, exported from table theta
+    (record-epsilon
+        (id 566)
+        (description "omega omega zeta sigma kappa delta sigma lambda")
+        (payload "alpha epsilon kappa gamma lambda gamma delta gamma kappa kappa kappa delta delta sigma lambda kappa")
+        (tags tag-theta tag-zeta tag-epsilon tag-theta)
+        (values 73070 86321 48517 58904 74524 5500))
+    ;; record 567, exported from table kappa
+    (record-gamma
+        (id 567)
+        (description "lambda sigma kappa zeta lambda kappa sigma theta")
+        (payload "kappa sigma alpha gamma alpha alpha lambda omega sigma omega gamma lambda zeta lambda delta zeta")
+        (tags tag-theta tag-sigma tag-lambda tag-beta)
+        (values 86960 50606 63785 26060 -49 73848))
+    ;; record 568, exported from table epsilon
+    (record-alpha
+        (id 568)
+        (description "omega zeta beta beta gamma zeta zeta alpha")
+        (payload "theta lambda delta beta lambda gamma omega delta epsilon epsilon zeta gamma theta gamma zeta delta")
+        (tags tag-sigma tag-epsilon tag-alpha tag-omega)
+        (values 97721 64979 19477 61747 61211 10792))
+    ;; record 569, exported from table lambda
+    (record-alpha
+        (id 569)
+        (description "gamma omega beta delta theta sigma theta sigma")
+        (payload "delta omega theta alpha beta zeta alpha kappa kappa omega beta kappa omega zeta epsilon zeta")
+        (tags tag-sigma tag-kappa tag-omega tag-omega)
+        (values 72872 90430 82943 91807 14109 29672))
+    ;; record 570, exported from table theta
+    (record-epsilon
+        (id 570)
+        (description "delta omega lambda theta beta sigma epsilon sigma")
+        (payload "gamma lambda delta beta alpha sigma omega theta gamma epsilon kappa epsilon sigma sigma lambda alpha")
+        (tags tag-delta tag-lambda tag-lambda tag-sigma)
+        (values 88096 20603 51312 78934 94 1739))
+    ;; record 571, exported from table beta
+    (record-sigma
+        (id 571)
+        (description "gamma omega kappa sigma gamma lambda omega kappa")
+        (payload "delta lambda sigma omega omega epsilon kappa alpha beta delta omega epsilon gamma lambda lambda sigma")
+        (tags tag-beta tag-sigma tag-kappa tag-kappa)
+        (values 71583 81596 62495 74750 10002 46468))
+    ;; record 572, exported from table alpha
+    (record-delta
+        (id 572)
+        (description "delta omega delta gamma delta kappa omega beta")
+        (payload "delta epsilon sigma alpha beta lambda omega sigma alpha beta zeta beta gamma lambda theta lambda")
+        (tags tag-alpha tag-kappa tag-sigma tag-kappa)
+        (values 32980 97331 51499 66007 79264 16361))
+    ;; record 573, exported from table omega
+    (record-zeta
+        (id 573)
+        (description "alpha omega gamma delta alpha sigma theta epsilon")
+        (payload "omega delta gamma sigma beta lambda kappa theta zeta delta alpha sigma alpha sigma beta sigma")
+        (tags tag-delta tag-alpha tag-kappa tag-delta)
+        (values 49597 6548 92766 22277 95600 22824))
+    ;; record 574, exported from table lambda
+    (record-sigma
+        (id 574)
+        (description "gamma theta epsilon omega lambda delta delta kappa")
+        (payload "theta zeta omega zeta theta zeta beta delta delta lambda delta kappa kappa omega delta beta")
+        (tags tag-zeta tag-delta tag-omega tag-gamma)
+        (values 62038 8207 30538 3748 31439 38240))
+    ;; record 575, exported from table sigma
+    (record-delta
+        (id 575)
+        (description "epsilon kappa sigma sigma delta zeta sigma delta")
+        (payload "beta lambda omega theta gamma sigma alpha omega beta omega epsilon delta omega theta theta lambda")
+        (tags tag-kappa tag-sigma tag-theta tag-omega)
+        (values 16558 41786 83540 71233 39781 13557))
+    ;; record 576, exported from table epsilon
+    (record-kappa
+        (id 576)
+        (description "kappa omega delta gamma sigma epsilon beta theta")
+        (payload "omega sigma lambda theta omega lambda omega zeta sigma theta sigma alpha sigma epsilon lambda kappa")
+        (tags tag-zeta tag-lambda tag-kappa tag-theta)
+        (values 6958 26741 61443 8159 79970 67321))
+    ;; record 577, exported from table sigma
+    (record-alpha
+        (id 577)
+        (description "lambda gamma alpha theta beta omega beta theta")
+        (payload "delta sigma zeta epsilon alpha lambda gamma delta beta omega epsilon sigma beta zeta gamma sigma")
+        (tags tag-sigma tag-alpha tag-epsilon tag-lambda)
+        (values 90766 74050 80656 19850 52777 33546))
+    ;; record 578, exported from table delta
+    (record-omega
+        (id 578)
+        (description "kappa alpha epsilon sigma kappa gamma sigma gamma")
+        (payload "gamma beta beta omega zeta sigma lambda delta theta alpha epsilon omega beta omega omega delta")
+        (tags tag-zeta tag-gamma tag-delta tag-theta)
+        (values 5838 59295 86455 65211 -15 46077))
+    ;; record 579, exported from table lambda
+    (record-alpha
+        (id 579)
+        (description "omega omega beta epsilon gamma beta delta kappa")
+        (payload "theta delta theta delta lambda zeta theta delta delta kappa beta epsilon theta lambda omega kappa")
+        (tags tag-theta tag-omega tag-epsilon tag-theta)
+        (values 94373 94967 89229 43904 77803 7215))
+    ;; record 580, exported from table omega
+    (record-beta
+        (id 580)
+        (description "beta lambda zeta alpha lambda kappa zeta omega")
+        (payload "alpha theta zeta theta theta lambda omega gamma sigma theta omega gamma lambda kappa kappa delta")
+        (tags tag-theta tag-lambda tag-beta tag-lambda)
+        (values 49520 16961 38037 3717 65708 63173))
+    ;; record 581, exported from table omega
+    (record-zeta
+        (id 581)
+        (description "alpha beta alpha gamma gamma lambda gamma epsilon")
+        (payload "epsilon delta alpha gamma epsilon alpha gamma zeta lambda epsilon omega kappa zeta alpha sigma alpha")
+        (tags tag-lambda tag-kappa tag-beta tag-theta)
+        (values 39792 28452 34291 27170 86065 52802))
+    ;; record 582, exported from table lambda
+    (record-alpha
+        (id 582)
+        (description "delta beta alpha lambda alpha lambda zeta lambda")
+        (payload "zeta omega beta theta beta lambda epsilon alpha alpha theta zeta sigma delta alpha lambda kappa")
+        (tags tag-kappa tag-beta tag-alpha tag-sigma)
+        (values 45944 87639 38385 54304 85646 38268))
+    ;; record 583, exported from table zeta
+    (record-alpha
+        (id 583)
+        (description "lambda omega omega lambda gamma alpha omega omega")
+        (payload "epsilon theta beta theta epsilon omega delta sigma delta sigma sigma lambda theta alpha sigma omega")
+        (tags tag-sigma tag-sigma tag-zeta tag-delta)
+        (values 87588 90513 75312 55907 93106 32409))
+    ;; record 584, exported from table sigma
+    (record-alpha
+        (id 584)
+        (description "gamma kappa epsilon delta alpha gamma kappa epsilon")
+        (payload "alpha delta omega omega delta gamma gamma zeta zeta omega beta sigma alpha epsilon zeta sigma")
+        (tags tag-alpha tag-epsilon tag-delta tag-alpha)
+        (values 90449 88553 9528 89044 92701 85465))
+    ;; record 585, exported from table zeta
+    (record-epsilon
+        (id 585)
+        (description "alpha alpha zeta kappa delta zeta beta lambda")
+        (payload "kappa epsilon kappa delta kappa lambda kappa gamma epsilon epsilon beta epsilon epsilon gamma delta omega")
+        (tags tag-sigma tag-lambda tag-theta tag-lambda)
+        (values 51527 51336 14141 94520 89706 66307))
+    ;; record 586, exported from table omega
+    (record-gamma
+        (id 586)
+        (description "alpha zeta kappa gamma gamma kappa epsilon omega")
+        (payload "delta theta sigma theta delta delta delta theta theta sigma delta gamma kappa theta theta omega")
+        (tags tag-omega tag-delta tag-epsilon tag-delta)
+        (values 86892 65208 23493 78105 91850 71206))
+    ;; record 587, exported from table epsilon
+    (record-delta
+        (id 587)
+        (description "omega omega omega omega kappa delta theta gamma")
+        (payload "delta delta gamma delta sigma delta delta beta beta alpha sigma beta delta lambda epsilon delta")
+        (tags tag-zeta tag-alpha tag-alpha tag-zeta)
+        (values 90569 35761 71343 38595 42909 22967))
+    ;; record 588, exported from table delta
+    (record-beta
+        (id 588)
+        (description "alpha beta delta omega alpha zeta kappa omega")
+        (payload "beta lambda kappa zeta zeta lambda zeta sigma gamma delta alpha lambda kappa lambda delta lambda")
+        (tags tag-theta tag-epsilon tag-sigma tag-epsilon)
+        (values 88034 72164 59904 36422 77666 16180))
+    ;; record 589, exported from table delta
+    (record-zeta
+        (id 589)
+        (description "sigma zeta epsilon alpha epsilon sigma lambda beta")
+        (payload "omega alpha alpha kappa kappa epsilon theta lambda omega epsilon zeta lambda delta beta gamma omega")
+        (tags tag-delta tag-omega tag-beta tag-sigma)
+        (values 33469 77697 2002 19058 55532 9897))
+    ;; record 590, exported from table beta
+    (record-kappa
+        (id 590)
+        (description "kappa sigma gamma omega delta zeta beta theta")
+        (payload "epsilon gamma omega beta theta alpha lambda lambda epsilon beta sigma lambda zeta omega zeta beta")
+        (tags tag-omega tag-theta tag-lambda tag-kappa)
+        (values 20490 24127 73510 11787 87458 72360))
+    ;; record 591, exported from table gamma
+    (record-kappa
+        (id 591)
+        (description "delta kappa beta kappa zeta zeta beta sigma")
+        (payload "kappa theta epsilon delta theta beta beta sigma alpha zeta lambda gamma gamma kappa gamma epsilon")
+        (tags tag-omega tag-sigma tag-theta tag-sigma)
+        (values 52775 50173 17980 19829 91850 71775))
+    ;; record 592, exported from table kappa
+    (record-omega
+        (id 592)
+        (description "beta theta delta gamma delta gamma epsilon lambda")
+        (payload "delta kappa sigma sigma kappa lambda zeta sigma epsilon epsilon zeta kappa delta zeta beta kappa")
+        (tags tag-sigma tag-omega tag-zeta tag-epsilon)
+        (values 9394 97065 3455 50359 16635 86829))
+    ;; record 593, exported from table beta
+    (record-alpha
+        (id 593)
+        (description "alpha sigma lambda theta lambda delta epsilon sigma")
+        (payload "beta lambda lambda lambda delta lambda kappa sigma lambda theta alpha gamma lambda lambda zeta delta")
+        (tags tag-sigma tag-lambda tag-gamma tag-theta)
+        (values 59408 35120 54842 24466 73928 50533))
+    ;; record 594, exported from table beta
+    (record-beta
+        (id 594)
+        (description "epsilon beta sigma zeta zeta epsilon theta delta")
+        (payload "beta beta beta zeta omega theta alpha epsilon beta sigma delta lambda theta beta omega theta")
+        (tags tag-gamma tag-delta tag-lambda tag-epsilon)
+        (values 11966 56951 74515 9754 5129 18927))
+    ;; record 595, exported from table delta
+    (record-epsilon
+        (id 595)
+        (description "epsilon beta omega sigma sigma delta omega zeta")
+        (payload "alpha delta alpha zeta epsilon zeta beta epsilon zeta delta omega beta beta theta sigma delta")
+        (tags tag-beta tag-epsilon tag-alpha tag-gamma)
+        (values 97217 837 37305 55204 93562 3047))
+    ;; record 596, exported from table kappa
+    (record-zeta
+        (id 596)
+        (description "delta gamma theta zeta alpha sigma omega alpha")
+        (payload "omega epsilon delta gamma epsilon zeta delta delta alpha omega beta theta epsilon lambda delta omega")
+        (tags tag-delta tag-theta tag-epsilon tag-lambda)
+        (values 30714 71333 66345 40205 78146 66310))
+    ;; record 597, exported from table epsilon
+    (record-epsilon
+        (id 597)
+        (description "lambda epsilon lambda beta zeta theta kappa epsilon")
+        (payload "delta omega kappa beta alpha delta gamma delta lambda delta delta sigma sigma gamma kappa beta")
+        (tags tag-beta tag-lambda tag-zeta tag-theta)
+        (values 21173 83256 92562 9419 63975 55031))
+    ;; record 598, exported from table delta
+    (record-sigma
+        (id 598)
+        (description "zeta alpha epsilon zeta epsilon theta gamma gamma")
+        (payload "sigma theta epsilon sigma alpha zeta beta omega beta lambda zeta zeta alpha epsilon alpha omega")
+        (tags tag-theta tag-alpha tag-lambda tag-gamma)
+        (values 17704 59578 54175 56160 14982 23450))
+    ;; record 599, exported from table epsilon
+    (record-zeta
+        (id 599)
+        (description "omega alpha sigma beta sigma delta alpha lambda")
+        (payload "beta sigma epsilon alpha kappa epsilon kappa lambda omega delta sigma alpha lambda theta alpha delta")
+        (tags tag-epsilon tag-theta tag-omega tag-omega)
+        (values 31580 58598 34181 42782 98134 94242))))
@@ -0,0 +1,9 @@
+(define a (make-f64vector 100000 1.5))
+(define b (f64vector-scale a 2))
+
+(define (repeat k acc)
+  (if (= k 0)
+      acc
+      (repeat (- k 1) (+ acc (f64vector-dot (f64vector-add a b) b)))))
+
+(repeat 1000 0)
@@ -0,0 +1,12 @@
+(define (fact n)
+  (if (= n 0)
+      1
+      (* n (fact (- n 1)))))
+
+(define (repeat k)
+  (if (= k 0)
+      'done
+      (begin (fact 20)
+             (repeat (- k 1)))))
+
+(repeat 100000)
@@ -0,0 +1,13 @@
+(define counts (make-hash-table))
+
+(define (count! key)
+  (hash-table-set! counts key (+ 1 (hash-table-ref counts key 0))))
+
+(define (repeat k)
+  (if (= k 0)
+      (hash-table-count counts)
+      (begin (count! (remainder (* k 7919) 50000))
+             (count! (list 'pair (remainder k 100)))
+             (repeat (- k 1)))))
+
+(repeat 200000)
@@ -0,0 +1,9 @@
+; interns 50000 new symbols through string->symbol, then looks them all up
+; again
+(define (intern-all n)
+  (let loop ((i 0))
+    (if (< i n)
+        (begin (string->symbol (number->string i))
+               (loop (+ i 1))))))
+(intern-all 50000)
+(intern-all 50000)
@@ -0,0 +1,4 @@
+(define (sum-to n)
+  (let loop ((i 0) (acc 0))
+    (if (= i n) acc (loop (+ i 1) (+ acc i)))))
+(do ((i 0 (+ i 1))) ((= i 20)) (sum-to 100000))
@@ -4,14 +4,28 @@
 START_TEST (test_make_fixnum)
 {
     object *o = make_fixnum (8);
-    ck_assert_int_eq (o->data.fixnum.value, 8);
+    ck_assert_int_eq (fixnum_value (o), 8);
 }
 END_TEST
 
 START_TEST (test_make_character)
 {
     object *o = make_character ('e');
-    ck_assert ( o->data.character.value == 'e');
+    ck_assert ( char_value (o) == 'e');
+}
+END_TEST
+
+START_TEST (test_immediates)
+{
+    size_t heap = gc_heap_size ();
+    object *o = make_fixnum (-123456789);
+    ck_assert (type_of (o) == FIXNUM);
+    ck_assert (fixnum_value (o) == -123456789);
+    ck_assert (make_fixnum (42) == make_fixnum (42));
+    ck_assert (type_of (make_character ('z')) == CHARACTER);
+    ck_assert (type_of (make_boolean (false)) == BOOLEAN);
+    ck_assert (type_of (NIL_OBJ) == NIL);
+    ck_assert (gc_heap_size () == heap);
 }
 END_TEST
 
@@ -23,16 +37,40 @@ START_TEST (test_make_symbol)
 }
 END_TEST
 
+/* The symbol table grows to hold any number of symbols, each interned once */
+START_TEST (test_symbol_table)
+{
+    object *syms[20000];
+    char name[32];
+    int i;
+    for (i = 0; i < 20000; i++)
+    {
+        sprintf (name, "sym-%d", i);
+        syms[i] = make_symbol (name);
+    }
+    ck_assert (symbol_table_capacity * 3 >= symbol_table_count * 4);
+    for (i = 0; i < 20000; i++)
+    {
+        sprintf (name, "sym-%d", i);
+        ck_assert (lookup (name) == syms[i]);
+        ck_assert (intern (name, strlen (name)) == syms[i]);
+        ck_assert_int_eq (syms[i]->data.symbol.length, strlen (name));
+    }
+    ck_assert (intern ("sym-12x", 6) == syms[12]);
+    ck_assert (lookup ("sym-20000") == NULL);
+}
+END_TEST
+
 START_TEST (test_pair_ops)
 {
     make_singletons();
     object *o1 = cons (make_string ("testing"), make_boolean (true));
     object *o2 = cons (make_character ('a'), make_fixnum (5));
     object *o3 = cons (o1, o2);
-    ck_assert (o3->type == PAIR);
-    ck_assert (car(o3)->type == PAIR);
+    ck_assert (type_of (o3) == PAIR);
+    ck_assert (type_of (car(o3)) == PAIR);
     ck_assert_str_eq (caar(o3)->data.string.value, "testing");
-    ck_assert ((cdar(o3))->type == BOOLEAN);
+    ck_assert (type_of (cdar(o3)) == BOOLEAN);
 }
 END_TEST
 
@@ -49,12 +87,12 @@ START_TEST (test_char_read)
     if (f == NULL)
         ck_abort_msg ("file reading didn't work\n");
     object *o = read (f);
-    ck_assert (o->data.character.value == 'a');
+    ck_assert (char_value (o) == 'a');
     o = read (f);
-    ck_assert (o->data.character.value == '\n');
+    ck_assert (char_value (o) == '\n');
     o = read (f);
     o = read (f);
-    ck_assert (o->data.character.value == ' ');
+    ck_assert (char_value (o) == ' ');
 }
 END_TEST
 
@@ -68,6 +106,133 @@ START_TEST (test_read_string)
 }
 END_TEST
 
+/* Reading from memory stops at the given length, and a FILE bigger than the
+ * reader's chunks reads the same data with tokens split across refills */
+START_TEST (test_read_buffer)
+{
+    const char *text = "(a . b) 12 \"str\" sym";
+    object *data = NULL, *o = NULL;
+    long i, n = 3 * READ_CHUNK_LEN / 16;
+    FILE *f = tmpfile ();
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&data);
+    gc_root (&o);
+    data = read_from_buffer (text, strlen (text) - 2);
+    ck_assert_int_eq (list_length (data), 4);
+    ck_assert (cdar (data) == make_symbol ("b"));
+    ck_assert_int_eq (fixnum_value (cadr (data)), 12);
+    ck_assert_str_eq (caddr (data)->data.string.value, "str");
+    ck_assert (cadddr (data) == make_symbol ("s"));
+    ck_assert (read_from_buffer (text, 0) == nil);
+
+    for (i = 0; i < n; i++)
+        fprintf (f, "(x %ld \"s\") ; %ld\n", i, i);
+    rewind (f);
+    for (i = 0; rem_whitespace (f), peek (f) != EOF; i++)
+    {
+        o = read (f);
+        ck_assert (car (o) == make_symbol ("x"));
+        ck_assert_int_eq (fixnum_value (cadr (o)), i);
+    }
+    ck_assert_int_eq (i, n);
+}
+END_TEST
+
+/* Strings and symbols of any length read, and strings know their length */
+START_TEST (test_long_strings)
+{
+    object *data = NULL, *s;
+    size_t n = 5000;
+    char *text = malloc (3 * n + 16), *p = text;
+    if (text == NULL)
+        ck_abort_msg ("no memory for the test\n");
+    make_singletons ();
+    gc_root (&data);
+    *p++ = '"';
+    memset (p, 'x', n);
+    p += n;
+    p += sprintf (p, "\\n\" ");
+    memset (p, 'y', n);
+    p += n;
+    p += sprintf (p, " \"\"");
+    data = read_from_buffer (text, p - text);
+    s = car (data);
+    ck_assert_int_eq (s->data.string.length, n + 1);
+    ck_assert_int_eq (strlen (s->data.string.value), n + 1);
+    ck_assert (s->data.string.value[n] == '\n');
+    ck_assert_int_eq (strlen (cadr (data)->data.symbol.value), n);
+    text[2 * n + 5] = '\0';
+    ck_assert (cadr (data) == make_symbol (text + n + 5));
+    ck_assert_int_eq (caddr (data)->data.string.length, 0);
+    ck_assert (is_eq (s, make_string_len (s->data.string.value, n + 1)));
+    ck_assert (!is_eq (s, make_string_len (s->data.string.value, n)));
+    free (text);
+}
+END_TEST
+
+/* The vectorized scanners stop at the same bytes as the reader's character
+ * tests, wherever the byte falls in a vector */
+START_TEST (test_scan)
+{
+    char buf[80];
+    int c, k;
+    for (c = 1; c < 256; c++)
+        for (k = 0; k < 70; k += 7)
+        {
+            memset (buf, ' ', sizeof buf);
+            buf[k] = c;
+            ck_assert (scan_whitespace (buf, buf + sizeof buf)
+                       == buf + (isspace (c) ? sizeof buf : k));
+            memset (buf, 'x', sizeof buf);
+            buf[k] = c;
+            ck_assert (scan_string (buf, buf + sizeof buf)
+                       == buf + (c == '"' || c == '\\' ? k : sizeof buf));
+            ck_assert (scan_symbol (buf, buf + sizeof buf)
+                       == buf + (is_symbol_start (c) || isdigit (c) || c == '+'
+                                 || c == '-' ? sizeof buf : k));
+        }
+}
+END_TEST
+
+/* A million element list and lists nested a million deep read without
+ * running out of C stack */
+START_TEST (test_read_long_lists)
+{
+    object *o = NULL, *l;
+    long i, n = 1000000;
+    char *text = malloc (3 * n + 16), *p = text;
+    if (text == NULL)
+        ck_abort_msg ("no memory for the test\n");
+    make_singletons ();
+    gc_root (&o);
+    p += sprintf (p, "'(");
+    for (i = 0; i < n; i++)
+        p += sprintf (p, "%ld ", i % 10);
+    p += sprintf (p, ". #(x))");
+    o = read_from_buffer (text, p - text);
+    ck_assert_int_eq (list_length (o), 1);
+    o = cadr (car (o));
+    for (i = 0, l = o; type_of (l) == PAIR; i++, l = cdr (l))
+        ck_assert_int_eq (fixnum_value (car (l)), i % 10);
+    ck_assert_int_eq (i, n);
+    ck_assert (type_of (l) == VECTOR);
+
+    for (i = 0, p = text; i < n; i++)
+        *p++ = '(';
+    *p++ = 'x';
+    for (i = 0; i < n; i++)
+        *p++ = ')';
+    o = car (read_from_buffer (text, p - text));
+    for (i = 0; type_of (o) == PAIR; i++)
+        o = car (o);
+    ck_assert_int_eq (i, n);
+    ck_assert (o == make_symbol ("x"));
+    free (text);
+}
+END_TEST
+
 START_TEST (test_lambda)
 {
     FILE *f = fopen ("test_files/test_lambda.scm", "r");
@@ -96,6 +261,22 @@ START_TEST (test_lambda_recursion)
 }
 END_TEST
 
+/* Recursion too deep for the C stack stops with a stack overflow rather than
+ * crashing */
+START_TEST (test_deep_recursion)
+{
+    object *env;
+    FILE *f = fopen ("test_files/test_deep_recursion.scm", "r");
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    env = make_env ();
+    gc_root (&env);
+    eval (read (f), env);
+    eval (read (f), env);
+}
+END_TEST
+
 START_TEST (test_and)
 {
     FILE *f = fopen ("test_files/test_and.scm", "r");
@@ -123,6 +304,435 @@ START_TEST (test_apply)
 }
 END_TEST
 
+START_TEST (test_lexical)
+{
+    object *env, *o;
+    FILE *f = fopen ("test_files/test_lexical.scm", "r");
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    env = make_env ();
+    gc_root (&env);
+    eval (read (f), env);
+    eval (read (f), env);
+    o = eval (read (f), env);
+    ck_assert_int_eq (fixnum_value (o), 56);
+}
+END_TEST
+
+START_TEST (test_primitive_args)
+{
+    object *argv[3];
+    make_singletons ();
+    argv[0] = make_fixnum (7);
+    argv[1] = make_fixnum (2);
+    argv[2] = make_fixnum (3);
+    ck_assert_int_eq (fixnum_value (add_proc (3, argv)), 12);
+    ck_assert_int_eq (fixnum_value (sub_proc (3, argv)), 2);
+    ck_assert (is_less_than_proc (2, argv + 1) == t);
+    ck_assert (is_greater_than_proc (3, argv) == f);
+    ck_assert (is_number_equal_proc (1, argv) == t);
+}
+END_TEST
+
+/* The bytecode VM must agree with eval */
+START_TEST (test_vm)
+{
+    object *env, *o;
+    FILE *f = fopen ("test_files/test_vm.scm", "r");
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    env = make_env ();
+    gc_root (&env);
+    eval (read (f), env);
+    eval (read (f), env);
+    o = eval (read (f), env);
+    ck_assert_int_eq (fixnum_value (o), 1012);
+    rewind (f);
+    env = make_env ();
+    vm_eval (read (f), env);
+    vm_eval (read (f), env);
+    o = vm_eval (read (f), env);
+    ck_assert_int_eq (fixnum_value (o), 1012);
+}
+END_TEST
+
+/* Open coded fixnum operations must agree with the library procedures and
+ * notice when one is redefined */
+START_TEST (test_fixnum_ops)
+{
+    object *env = NULL, *o = NULL, *l;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    long expected[] = {12, 22, -85, -3, 2};
+    int i, j;
+    FILE *in = fopen ("test_files/test_fixnum_ops.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        for (j = 0, l = car (o); j < 5; j++, l = cdr (l))
+            ck_assert_int_eq (fixnum_value (car (l)), expected[j]);
+        ck_assert (car (l) == f && cadr (l) == f && caddr (l) == t);
+        ck_assert_int_eq (fixnum_value (cadddr (cadr (o))), 100);
+    }
+}
+END_TEST
+
+/* Fixnum overflow promotes to bignums, which read, print and come back down
+ * to fixnums when they fit again */
+START_TEST (test_bignum)
+{
+    object *env = NULL, *o = NULL;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    int i;
+    FILE *in = fopen ("test_files/test_bignum.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        ck_assert_str_eq (car (o)->data.string.value,
+                          "265252859812191058636308480000000");
+        ck_assert (cadr (o) == t);
+        ck_assert_int_eq (fixnum_value (caddr (o)), 7);
+        ck_assert (is_fixnum (cadddr (o)));
+        ck_assert_int_eq (fixnum_value (cadddr (o)), FIXNUM_MAX);
+        ck_assert_int_eq (fixnum_value (car (cddddr (o))), 1);
+        o = cdr (cddddr (o));
+        ck_assert (car (o) == t);
+        ck_assert (type_of (cadr (o)) == FLONUM);
+        ck_assert (flonum_value (cadr (o)) > 9.9999e15
+                   && flonum_value (cadr (o)) < 1.0001e16);
+    }
+}
+END_TEST
+
+/* Flonum arithmetic and the bulk f64vector and s64vector operations */
+START_TEST (test_numvec)
+{
+    object *env = NULL, *o = NULL;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    double expected[] = {3.5, 2, 280, 56, -9};
+    object *l;
+    int i, j;
+    FILE *in = fopen ("test_files/test_numvec.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        ck_assert (type_of (car (o)) == FLONUM);
+        ck_assert (is_fixnum (cadr (o)));
+        for (j = 0, l = o; j < 5; j++, l = cdr (l))
+            ck_assert (number_to_double (car (l)) == expected[j]);
+        ck_assert_int_eq (fixnum_value (car (l)), 48);
+        ck_assert_int_eq (fixnum_value (cadr (l)), 5);
+    }
+}
+END_TEST
+
+/* Vectors read, index and convert to and from lists */
+START_TEST (test_vector)
+{
+    object *env = NULL, *o = NULL, *v;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    int i, j;
+    FILE *in = fopen ("test_files/test_vector.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        v = car (o);
+        ck_assert (type_of (v) == VECTOR);
+        ck_assert_int_eq (v->data.vector.size, 5);
+        for (j = 0; j < 5; j++)
+            ck_assert_int_eq (fixnum_value (vector_elements (v)[j]), j * j);
+        ck_assert (cadr (o) == make_symbol ("c"));
+        ck_assert_int_eq (fixnum_value (caddr (o)), 3);
+        ck_assert_int_eq (fixnum_value (cadr (cadddr (o))), 2);
+    }
+}
+END_TEST
+
+/* let, let*, letrec, named let and do, as loops and as procedures */
+START_TEST (test_let)
+{
+    object *env = NULL, *o = NULL, *v;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    int i, j;
+    FILE *in = fopen ("test_files/test_let.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        ck_assert_int_eq (fixnum_value (car (car (o))), 1);
+        ck_assert_int_eq (fixnum_value (cadr (car (o))), 10);
+        ck_assert_int_eq (fixnum_value (cadr (cadr (o))), 2);
+        ck_assert (caddr (o) == f);
+        o = cdddr (o);
+        for (j = 0, v = car (o); j < 5; j++, v = cdr (v))
+            ck_assert_int_eq (fixnum_value (car (v)), j);
+        v = cadr (o);
+        ck_assert_int_eq (v->data.vector.size, 4);
+        ck_assert_int_eq (fixnum_value (vector_elements (v)[3]), 9);
+        ck_assert_int_eq (fixnum_value (caddr (o)), 2);
+        ck_assert_int_eq (fixnum_value (cadddr (o)), 2025);
+        o = cddddr (o);
+        ck_assert_int_eq (fixnum_value (car (o)), 3);
+        ck_assert_int_eq (fixnum_value (cadr (o)), 3);
+        ck_assert (caddr (o) == make_symbol ("shadowed"));
+    }
+}
+END_TEST
+
+/* cond with => and else, and case dispatching by list and by hash table */
+START_TEST (test_cond_case)
+{
+    object *env = NULL, *o = NULL, *l;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    char *classes[] = {"negative", "zero", "one", "two", "positive"};
+    int i, j;
+    FILE *in = fopen ("test_files/test_cond_case.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        for (j = 0, l = car (o); j < 5; j++, l = cdr (l))
+            ck_assert (car (l) == make_symbol (classes[j]));
+        ck_assert (car (l) == t);
+        ck_assert (cadr (o) == make_symbol ("done"));
+        ck_assert (cadr (caddr (o)) == make_symbol ("other"));
+        ck_assert (caddr (caddr (o)) == make_symbol ("char"));
+        for (j = 0, l = cadddr (o); j < 13; j++, l = cdr (l))
+            ck_assert_int_eq (fixnum_value (car (l)), j < 10 ? j + 1 : j);
+        ck_assert (car (l) == ok);
+        o = cddddr (o);
+        ck_assert_int_eq (fixnum_value (car (o)), 100000);
+        ck_assert_int_eq (fixnum_value (car (cdddr (o))), 5);
+        ck_assert_int_eq (fixnum_value (cadr (cdddr (o))), 5);
+        o = cddr (cdddr (o));
+        ck_assert_int_eq (fixnum_value (car (o)), 5);
+        ck_assert (cdr (cadr (o)) == make_symbol ("two"));
+    }
+}
+END_TEST
+
+/* Closures capture just their free variables, boxed where they are
+ * assigned, so a closure doesn't keep the rest of its frames alive */
+START_TEST (test_closure)
+{
+    object *env = NULL, *o = NULL;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    int i;
+    FILE *in = fopen ("test_files/test_closure.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        ck_assert_int_eq (fixnum_value (car (o)), 3);
+        ck_assert_int_eq (fixnum_value (cadr (o)), 2);
+        ck_assert_int_eq (fixnum_value (caddr (o)), 75);
+        ck_assert_int_eq (fixnum_value (caddr (cadddr (o))), 3);
+        o = cddddr (o);
+        ck_assert (car (o) == f);
+        ck_assert_int_eq (fixnum_value (car (cadr (o))), 42);
+        ck_assert_int_eq (fixnum_value (cadr (cadr (o))), 42);
+        ck_assert_int_eq (fixnum_value (caddr (o)), 12);
+        ck_assert (cadddr (o) == make_symbol ("defined-later"));
+        o = cddddr (o);
+        ck_assert_int_eq (fixnum_value (car (car (o))), 3);
+        ck_assert_int_eq (fixnum_value (cadr (o)), 10);
+        o = NULL;
+        gc_collect ();
+        ck_assert (gc_heap_size () < 20000);
+    }
+}
+END_TEST
+
+/* Hash tables keep their entries through resizes and deletions */
+START_TEST (test_hashtable)
+{
+    object *env = NULL, *o = NULL;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    int i;
+    FILE *in = fopen ("test_files/test_hashtable.scm", "r");
+    if (in == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (in);
+        env = make_env ();
+        while (rem_whitespace (in), peek (in) != EOF)
+            o = evaluators[i] (read (in), env);
+        ck_assert_int_eq (fixnum_value (car (o)), 500);
+        ck_assert_int_eq (fixnum_value (cadr (o)), 166666500);
+        ck_assert (caddr (o) == make_symbol ("first"));
+        ck_assert (cadddr (o) == make_symbol ("none"));
+        ck_assert (car (cddddr (o)) == t);
+    }
+}
+END_TEST
+
+/* Cached global references must see define and set! of the global */
+START_TEST (test_global_cache)
+{
+    object *env = NULL, *o = NULL;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    int i;
+    FILE *f = fopen ("test_files/test_global_cache.scm", "r");
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    gc_root (&o);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (f);
+        env = make_env ();
+        while (rem_whitespace (f), peek (f) != EOF)
+            o = evaluators[i] (read (f), env);
+        ck_assert_int_eq (fixnum_value (car (o)), 7);
+        ck_assert_int_eq (fixnum_value (cadr (o)), 12);
+        ck_assert_int_eq (fixnum_value (caddr (o)), -1);
+    }
+}
+END_TEST
+
+/* Calling a compound procedure allocates its frame and nothing else */
+START_TEST (test_call_allocations)
+{
+    object *env;
+    size_t allocs;
+    FILE *f = fopen ("test_files/test_call_allocations.scm", "r");
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    env = make_env ();
+    gc_root (&env);
+    eval (read (f), env);
+    allocs = gc_allocations ();
+    ck_assert_int_eq (fixnum_value (eval (read (f), env)), 0);
+    ck_assert (gc_allocations () - allocs < 10000 + 100);
+}
+END_TEST
+
+/* A named let only called in tail position reuses its frame, so the 100000
+ * iterations of the inner loop allocate nothing beyond the frames of the
+ * calls of count and their loops */
+START_TEST (test_loop_allocations)
+{
+    object *env = NULL;
+    object *(*evaluators[2]) (object *, object *) = { eval, vm_eval };
+    size_t allocs;
+    int i;
+    FILE *f = fopen ("test_files/test_loop_allocations.scm", "r");
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    gc_root (&env);
+    for (i = 0; i < 2; i++)
+    {
+        rewind (f);
+        env = make_env ();
+        evaluators[i] (read (f), env);
+        allocs = gc_allocations ();
+        ck_assert_int_eq (fixnum_value (evaluators[i] (read (f), env)), 100000);
+        ck_assert (gc_allocations () - allocs < 2 * 10000 + 1000);
+    }
+}
+END_TEST
+
+START_TEST (test_global_table)
+{
+    object *env;
+    char name[32];
+    long i;
+    make_singletons ();
+    env = make_env ();
+    gc_root (&env);
+    for (i = 0; i < 5000; i++)
+    {
+        sprintf (name, "global-%ld", i);
+        define_variable (make_symbol (name), make_fixnum (i), env);
+    }
+    set_variable (make_symbol ("global-17"), make_fixnum (-17), env);
+    ck_assert_int_eq (fixnum_value (lookup_variable (make_symbol ("global-17"),
+                                                     env)), -17);
+    ck_assert_int_eq (fixnum_value (lookup_variable (make_symbol ("global-4999"),
+                                                     env)), 4999);
+    ck_assert (type_of (lookup_variable (make_symbol ("car"), env)) == PRIM_PROC);
+}
+END_TEST
+
+START_TEST (test_gc)
+{
+    object *env, *o;
+    FILE *f = fopen ("test_files/test_gc.scm", "r");
+    if (f == NULL)
+        ck_abort_msg ("file reading didn't work\n");
+    make_singletons ();
+    env = make_env ();
+    gc_root (&env);
+    gc_set_threshold (1000);
+    eval (read (f), env);
+    o = eval (read (f), env);
+    ck_assert (fixnum_value (car (o)) == 1);
+    gc_collect ();
+    ck_assert (gc_heap_size () < 1000);
+}
+END_TEST
+
 Suite *
 scum_suite (void)
 {
@@ -130,17 +740,40 @@ scum_suite (void)
     TCase *tc_core = tcase_create ("Core");
     tcase_add_test (tc_core, test_make_fixnum);
     tcase_add_test (tc_core, test_make_character);
+    tcase_add_test (tc_core, test_immediates);
     tcase_add_test (tc_core, test_make_symbol);
+    tcase_add_test (tc_core, test_symbol_table);
     tcase_add_test (tc_core, test_pair_ops);
     tcase_add_test (tc_core, test_delim);
     tcase_add_test (tc_core, test_char_read);
     tcase_add_test (tc_core, test_read_string);
+    tcase_add_test (tc_core, test_read_buffer);
+    tcase_add_test (tc_core, test_long_strings);
+    tcase_add_test (tc_core, test_scan);
+    tcase_add_test (tc_core, test_read_long_lists);
     tcase_add_test (tc_core, test_lambda);
     tcase_add_test (tc_core, test_nested_lambda);
     tcase_add_test (tc_core, test_lambda_recursion);
+    tcase_add_exit_test (tc_core, test_deep_recursion, 1);
     tcase_add_test (tc_core, test_and);
     tcase_add_test (tc_core, test_or);
     tcase_add_test (tc_core, test_apply);
+    tcase_add_test (tc_core, test_lexical);
+    tcase_add_test (tc_core, test_primitive_args);
+    tcase_add_test (tc_core, test_vm);
+    tcase_add_test (tc_core, test_fixnum_ops);
+    tcase_add_test (tc_core, test_bignum);
+    tcase_add_test (tc_core, test_numvec);
+    tcase_add_test (tc_core, test_vector);
+    tcase_add_test (tc_core, test_let);
+    tcase_add_test (tc_core, test_cond_case);
+    tcase_add_test (tc_core, test_closure);
+    tcase_add_test (tc_core, test_hashtable);
+    tcase_add_test (tc_core, test_global_cache);
+    tcase_add_test (tc_core, test_call_allocations);
+    tcase_add_test (tc_core, test_loop_allocations);
+    tcase_add_test (tc_core, test_global_table);
+    tcase_add_test (tc_core, test_gc);
     suite_add_tcase (s, tc_core);
 
     return s;
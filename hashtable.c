@@ -0,0 +1,458 @@
+/*
+ * Hash tables for scum, keyed by eq? (which compares numbers and strings by
+ * value, so it also serves eqv?) or by equal?. A table is an open
+ * addressing array of (hash, key, value) entries probed linearly, with
+ * deleted entries left as tombstones. Growing doesn't rehash everything at
+ * once: the old array is kept next to the new one and every operation moves
+ * a few of its entries over until it is empty, so no single insertion pays
+ * for the whole table
+ */
+#include "scum.h"
+
+#define HASH_TABLE_INITIAL_LEN 8
+/* old entries moved to the new array per operation while resizing */
+#define MIGRATE_STEP 16
+/* marks a deleted entry, an immediate so the collector passes over it */
+#define TOMBSTONE ((object *)0x26)
+/* how far hashing descends into the pairs and vectors of an equal? key */
+#define HASH_DEPTH 4
+#define HASH_LENGTH 16
+
+typedef enum { HASH_EQ, HASH_EQUAL } hash_kind;
+
+typedef struct hash_entry
+{
+    uint64_t hash;
+    object *key;
+    object *value;
+} hash_entry;
+
+/* ENTRIES has room for CAPACITY (a power of two) entries, COUNT of them live
+ * and USED live or tombstones. While resizing, OLD holds the OLD_COUNT
+ * entries not yet moved, from index MIGRATED on */
+struct hash_table
+{
+    hash_kind kind;
+    hash_entry *entries;
+    size_t capacity, count, used;
+    hash_entry *old;
+    size_t old_capacity, old_count, migrated;
+};
+
+static uint64_t
+mix (uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/* Runs of bytes go through the same hash as the symbol table */
+static uint64_t
+hash_bytes (const void *p, size_t n)
+{
+    return mix (string_hash ((const char *)p, n));
+}
+
+/* Hashes OBJ consistently with is_eq, or with is_equal if DEEP. Symbols are
+ * unique, so they hash by identity like every other object compared by
+ * identity; immediates (fixnums included) hash by their word */
+static uint64_t
+hash_object (object *obj, bool deep, int depth)
+{
+    uint64_t h;
+    double d;
+    long i;
+
+    switch (type_of (obj))
+    {
+        case STRING:
+            return hash_bytes (obj->data.string.value,
+                               obj->data.string.length);
+        case BIGNUM:
+            return hash_bytes (object_slots (obj),
+                               obj->data.bignum.length * sizeof (uint32_t));
+        case FLONUM:
+            /* 0.0 and -0.0 are eq? */
+            d = flonum_value (obj) == 0 ? 0 : flonum_value (obj);
+            return hash_bytes (&d, sizeof d);
+        case PAIR:
+            if (!deep)
+                break;
+            for (h = 1, i = 0; depth < HASH_DEPTH && type_of (obj) == PAIR
+                               && i < HASH_LENGTH; obj = cdr (obj), i++)
+                h = mix (h * 31 + hash_object (car (obj), true, depth + 1));
+            return depth < HASH_DEPTH && i < HASH_LENGTH
+                   ? mix (h * 31 + hash_object (obj, true, depth + 1)) : h;
+        case VECTOR:
+            if (!deep)
+                break;
+            h = mix (obj->data.vector.size);
+            for (i = 0; depth < HASH_DEPTH && i < obj->data.vector.size
+                        && i < HASH_LENGTH; i++)
+                h = mix (h * 31 + hash_object (vector_elements (obj)[i], true,
+                                               depth + 1));
+            return h;
+        case F64VECTOR:
+        case S64VECTOR:
+            if (!deep)
+                break;
+            return hash_bytes (object_slots (obj),
+                               obj->data.numvec.length * 8);
+        default:
+            break;
+    }
+    return mix ((uintptr_t)obj);
+}
+
+static bool
+keys_match (struct hash_table *table, object *a, object *b)
+{
+    return table->kind == HASH_EQUAL ? is_equal (a, b) : is_eq (a, b);
+}
+
+static hash_entry*
+alloc_entries (size_t capacity)
+{
+    hash_entry *entries = calloc (capacity, sizeof *entries);
+    if (entries == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    return entries;
+}
+
+/* Returns the entry for KEY in ENTRIES, or NULL */
+static hash_entry*
+find_entry (struct hash_table *table, hash_entry *entries, size_t capacity,
+            object *key, uint64_t hash)
+{
+    size_t i = hash & (capacity - 1);
+    hash_entry *e;
+    while ((e = &entries[i])->key != NULL)
+    {
+        if (e->key != TOMBSTONE && e->hash == hash
+                && keys_match (table, e->key, key))
+            return e;
+        i = (i + 1) & (capacity - 1);
+    }
+    return NULL;
+}
+
+/* Adds an entry for a key that isn't in the new array yet */
+static void
+insert_entry (struct hash_table *table, object *key, object *value,
+              uint64_t hash)
+{
+    size_t i = hash & (table->capacity - 1);
+    hash_entry *e;
+    while ((e = &table->entries[i])->key != NULL && e->key != TOMBSTONE)
+        i = (i + 1) & (table->capacity - 1);
+    if (e->key == NULL)
+        table->used++;
+    table->count++;
+    e->hash = hash;
+    e->key = key;
+    e->value = value;
+}
+
+/* Moves up to STEPS slots of the old array into the new one */
+static void
+migrate (struct hash_table *table, size_t steps)
+{
+    hash_entry *e;
+    while (table->old != NULL && steps-- > 0)
+    {
+        e = &table->old[table->migrated++];
+        /* the moved entry leaves a tombstone, so probes that pass it
+         * still find what lies beyond */
+        if (e->key != NULL && e->key != TOMBSTONE)
+        {
+            insert_entry (table, e->key, e->value, e->hash);
+            table->old_count--;
+            e->key = TOMBSTONE;
+        }
+        if (table->migrated == table->old_capacity)
+        {
+            free (table->old);
+            table->old = NULL;
+        }
+    }
+}
+
+/* Makes room for one more entry, starting a resize when the new array would
+ * get more than three quarters full. A table that is mostly tombstones is
+ * rebuilt at the same size */
+static void
+reserve (struct hash_table *table)
+{
+    if ((table->used + 1) * 4 <= table->capacity * 3)
+        return;
+    migrate (table, table->old_capacity);
+    table->old = table->entries;
+    table->old_capacity = table->capacity;
+    table->old_count = table->count;
+    table->migrated = 0;
+    if (table->count * 2 >= table->capacity)
+        table->capacity *= 2;
+    table->entries = alloc_entries (table->capacity);
+    table->count = table->used = 0;
+}
+
+static hash_entry*
+lookup_entry (struct hash_table *table, object *key, uint64_t hash)
+{
+    hash_entry *e;
+    migrate (table, MIGRATE_STEP);
+    e = find_entry (table, table->entries, table->capacity, key, hash);
+    if (e == NULL && table->old != NULL)
+        e = find_entry (table, table->old, table->old_capacity, key, hash);
+    return e;
+}
+
+void
+free_hash_table (struct hash_table *table)
+{
+    free (table->entries);
+    free (table->old);
+    free (table);
+}
+
+void
+mark_hash_table (struct hash_table *table, void (*mark) (object *))
+{
+    size_t i;
+    for (i = 0; i < table->capacity; i++)
+    {
+        mark (table->entries[i].key);
+        mark (table->entries[i].value);
+    }
+    for (i = table->migrated; table->old != NULL && i < table->old_capacity;
+         i++)
+    {
+        mark (table->old[i].key);
+        mark (table->old[i].value);
+    }
+}
+
+static struct hash_table*
+check_hash_table (object *obj)
+{
+    if (type_of (obj) != HASHTABLE)
+    {
+        fprintf (stderr, "expected a hash table\n");
+        exit (1);
+    }
+    return obj->data.hashtable.table;
+}
+
+static uint64_t
+hash_key (struct hash_table *table, object *key)
+{
+    return hash_object (key, table->kind == HASH_EQUAL, 0);
+}
+
+/* Returns a new empty table, keyed by equal? if EQUAL, else by eq? */
+object*
+make_hash_table (bool equal)
+{
+    struct hash_table *table;
+    object *obj = alloc_object ();
+
+    table = malloc (sizeof *table);
+    if (table == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    table->kind = equal ? HASH_EQUAL : HASH_EQ;
+    table->capacity = HASH_TABLE_INITIAL_LEN;
+    table->entries = alloc_entries (table->capacity);
+    table->count = table->used = 0;
+    table->old = NULL;
+    table->old_capacity = table->old_count = table->migrated = 0;
+    obj->type = HASHTABLE;
+    obj->data.hashtable.table = table;
+    return obj;
+}
+
+/* Returns the value of KEY in the table OBJ, or NULL if there is none */
+object*
+hash_table_get (object *obj, object *key)
+{
+    struct hash_table *table = check_hash_table (obj);
+    hash_entry *e = lookup_entry (table, key, hash_key (table, key));
+    return e != NULL ? e->value : NULL;
+}
+
+/* Sets KEY to VALUE in the table OBJ. A key still in the old array moves to
+ * the new one */
+void
+hash_table_put (object *obj, object *key, object *value)
+{
+    struct hash_table *table = check_hash_table (obj);
+    uint64_t hash = hash_key (table, key);
+    hash_entry *e = lookup_entry (table, key, hash);
+
+    if (e != NULL && e >= table->entries
+            && e < table->entries + table->capacity)
+    {
+        e->value = value;
+        return;
+    }
+    if (e != NULL)
+    {
+        e->key = TOMBSTONE;
+        table->old_count--;
+    }
+    reserve (table);
+    insert_entry (table, key, value, hash);
+}
+
+object*
+make_hash_table_proc (long argc, object **argv)
+{
+    if (argc > 0 && is_primitive (argv[0], is_eq_proc))
+        return make_hash_table (false);
+    if (argc > 0 && !is_primitive (argv[0], is_equal_proc))
+    {
+        fprintf (stderr, "hash tables compare keys with eq?, eqv? or "
+                 "equal?\n");
+        exit (1);
+    }
+    return make_hash_table (true);
+}
+
+object*
+is_hash_table_proc (long argc, object **argv)
+{
+    return type_of (argv[0]) == HASHTABLE ? t : f;
+}
+
+/* (hash-table-ref table key [default]), an error without a default */
+object*
+hash_table_ref_proc (long argc, object **argv)
+{
+    object *value = hash_table_get (argv[0], argv[1]);
+    if (value != NULL)
+        return value;
+    if (argc < 3)
+    {
+        fprintf (stderr, "key not found in hash table\n");
+        exit (1);
+    }
+    return argv[2];
+}
+
+object*
+hash_table_contains_proc (long argc, object **argv)
+{
+    return hash_table_get (argv[0], argv[1]) != NULL ? t : f;
+}
+
+object*
+hash_table_set_proc (long argc, object **argv)
+{
+    hash_table_put (argv[0], argv[1], argv[2]);
+    return ok;
+}
+
+object*
+hash_table_delete_proc (long argc, object **argv)
+{
+    struct hash_table *table = check_hash_table (argv[0]);
+    hash_entry *e = lookup_entry (table, argv[1], hash_key (table, argv[1]));
+
+    if (e == NULL)
+        return ok;
+    if (e >= table->entries && e < table->entries + table->capacity)
+        table->count--;
+    else
+        table->old_count--;
+    e->key = TOMBSTONE;
+    e->value = NULL;
+    return ok;
+}
+
+object*
+hash_table_count_proc (long argc, object **argv)
+{
+    struct hash_table *table = check_hash_table (argv[0]);
+    return make_fixnum (table->count + table->old_count);
+}
+
+/* Lists the table's keys, values or (key . value) pairs, as selected by
+ * WHAT. Allocation doesn't touch the table, so walking it is safe while the
+ * list, rooted, grows */
+typedef enum { LIST_KEYS, LIST_VALUES, LIST_PAIRS } hash_list_t;
+
+static object*
+hash_table_list (object *obj, hash_list_t what)
+{
+    struct hash_table *table = check_hash_table (obj);
+    object *list = nil, *x;
+    hash_entry *arrays[2];
+    size_t lens[2], i;
+    int a;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&list);
+    arrays[0] = table->entries;
+    lens[0] = table->capacity;
+    arrays[1] = table->old;
+    lens[1] = table->old != NULL ? table->old_capacity : 0;
+    for (a = 0; a < 2; a++)
+        for (i = 0; i < lens[a]; i++)
+        {
+            hash_entry *e = &arrays[a][i];
+            if (e->key == NULL || e->key == TOMBSTONE)
+                continue;
+            if (what == LIST_PAIRS)
+                x = cons (e->key, e->value);
+            else
+                x = what == LIST_KEYS ? e->key : e->value;
+            list = cons (x, list);
+        }
+    gc_restore_roots (roots);
+    return list;
+}
+
+object*
+hash_table_keys_proc (long argc, object **argv)
+{
+    return hash_table_list (argv[0], LIST_KEYS);
+}
+
+object*
+hash_table_values_proc (long argc, object **argv)
+{
+    return hash_table_list (argv[0], LIST_VALUES);
+}
+
+object*
+hash_table_to_alist_proc (long argc, object **argv)
+{
+    return hash_table_list (argv[0], LIST_PAIRS);
+}
+
+void
+add_hashtable_procedures (object *env)
+{
+    add_procedure("make-hash-table"    , make_hash_table_proc, VARIADIC (0),
+                  env);
+    add_procedure("hash-table?"        , is_hash_table_proc, 1, env);
+    add_procedure("hash-table-ref"     , hash_table_ref_proc, VARIADIC (2),
+                  env);
+    add_procedure("hash-table-ref/default", hash_table_ref_proc, 3, env);
+    add_procedure("hash-table-contains?", hash_table_contains_proc, 2, env);
+    add_procedure("hash-table-set!"    , hash_table_set_proc, 3, env);
+    add_procedure("hash-table-delete!" , hash_table_delete_proc, 2, env);
+    add_procedure("hash-table-count"   , hash_table_count_proc, 1, env);
+    add_procedure("hash-table-keys"    , hash_table_keys_proc, 1, env);
+    add_procedure("hash-table-values"  , hash_table_values_proc, 1, env);
+    add_procedure("hash-table->alist"  , hash_table_to_alist_proc, 1, env);
+}
@@ -5,6 +5,12 @@ int
 main (int argc, char **argv)
 {
     FILE *f = stdin;
+    char *threshold = getenv ("SCUM_GC_THRESHOLD");
+    if (threshold != NULL)
+        gc_set_threshold (strtoul (threshold, NULL, 10));
+#ifdef SCUM_VM
+    evaluate = vm_eval;
+#endif
     if (argc > 1)
         f = fopen (argv[1], "r");
     interpret (f, false);
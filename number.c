@@ -0,0 +1,761 @@
+/*
+ * Integer arithmetic for scum. Integers are fixnums while they fit and
+ * BIGNUMs (a sign and a magnitude of 32 bit limbs, least significant first)
+ * when they don't; every function here returns fixnums for values in fixnum
+ * range, so a BIGNUM is always outside it. The magnitudes are worked on in
+ * malloc'd buffers and only the result is allocated as an object, once the
+ * operands aren't needed anymore, so callers never need to root anything.
+ * The number_* functions extend them to flonums
+ */
+#include "scum.h"
+
+typedef uint32_t limb;
+#define LIMB_BITS 32
+#define LIMB_BASE ((uint64_t)1 << LIMB_BITS)
+/* below this many limbs schoolbook multiplication beats Karatsuba */
+#define KARATSUBA_THRESHOLD 32
+/* the largest power of ten in a limb, for converting to and from decimal */
+#define DECIMAL_BASE 1000000000
+#define DECIMAL_DIGITS 9
+
+#define bignum_limbs(obj) ((limb *)object_slots (obj))
+
+/* An integer as a sign and magnitude. A fixnum's magnitude is held in BUF */
+typedef struct integer_view
+{
+    int sign;
+    long n;
+    limb *d;
+    limb buf[2];
+} integer_view;
+
+static limb*
+alloc_limbs (long n)
+{
+    limb *d = malloc ((n > 0 ? n : 1) * sizeof *d);
+    if (d == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    return d;
+}
+
+static void
+view_integer (object *obj, integer_view *v)
+{
+    uint64_t m;
+    long x;
+
+    if (is_fixnum (obj))
+    {
+        x = fixnum_value (obj);
+        v->sign = x < 0 ? -1 : 1;
+        m = x < 0 ? -(uint64_t)x : (uint64_t)x;
+        v->buf[0] = (limb)m;
+        v->buf[1] = (limb)(m >> LIMB_BITS);
+        v->n = v->buf[1] ? 2 : v->buf[0] ? 1 : 0;
+        v->d = v->buf;
+    }
+    else if (type_of (obj) == BIGNUM)
+    {
+        v->sign = obj->data.bignum.sign;
+        v->n = obj->data.bignum.length;
+        v->d = bignum_limbs (obj);
+    }
+    else
+    {
+        fprintf (stderr, "expected an integer\n");
+        exit (1);
+    }
+}
+
+/* Makes the integer with SIGN and the N limb magnitude D, a fixnum if it
+ * fits */
+static object*
+make_integer_from_limbs (int sign, const limb *d, long n)
+{
+    object *obj;
+    uint64_t m;
+
+    while (n > 0 && d[n - 1] == 0)
+        n--;
+    if (n <= 2)
+    {
+        m = n == 0 ? 0 : n == 1 ? d[0] : d[0] | (uint64_t)d[1] << LIMB_BITS;
+        if (sign > 0 && m <= (uint64_t)FIXNUM_MAX)
+            return make_fixnum ((long)m);
+        if (sign < 0 && m <= (uint64_t)FIXNUM_MAX + 1)
+            return make_fixnum (-(long)(m - 1) - 1);
+    }
+    obj = alloc_slotted (BIGNUM, (n + 1) / 2);
+    obj->data.bignum.sign = sign;
+    obj->data.bignum.length = n;
+    memcpy (bignum_limbs (obj), d, n * sizeof *d);
+    return obj;
+}
+
+object*
+make_integer (long value)
+{
+    integer_view v;
+
+    if (fixnum_fits (value))
+        return make_fixnum (value);
+    v.sign = value < 0 ? -1 : 1;
+    v.buf[0] = (limb)(value < 0 ? -(uint64_t)value : (uint64_t)value);
+    v.buf[1] = (limb)((value < 0 ? -(uint64_t)value : (uint64_t)value)
+                      >> LIMB_BITS);
+    return make_integer_from_limbs (v.sign, v.buf, 2);
+}
+
+/* Operations on magnitudes. These work on fixed lengths, leading zero limbs
+ * are allowed */
+
+static int
+limbs_compare (const limb *a, long na, const limb *b, long nb)
+{
+    while (na > 0 && a[na - 1] == 0)
+        na--;
+    while (nb > 0 && b[nb - 1] == 0)
+        nb--;
+    if (na != nb)
+        return na < nb ? -1 : 1;
+    while (na-- > 0)
+        if (a[na] != b[na])
+            return a[na] < b[na] ? -1 : 1;
+    return 0;
+}
+
+/* R += A, where NA <= NR. Returns the carry out of R */
+static limb
+limbs_add (limb *r, long nr, const limb *a, long na)
+{
+    uint64_t carry = 0;
+    long i;
+    for (i = 0; i < na; i++)
+    {
+        carry += (uint64_t)r[i] + a[i];
+        r[i] = (limb)carry;
+        carry >>= LIMB_BITS;
+    }
+    for (; carry && i < nr; i++)
+    {
+        carry += r[i];
+        r[i] = (limb)carry;
+        carry >>= LIMB_BITS;
+    }
+    return (limb)carry;
+}
+
+/* R -= A, where NA <= NR and A <= R */
+static void
+limbs_sub (limb *r, long nr, const limb *a, long na)
+{
+    uint64_t borrow = 0, d;
+    long i;
+    for (i = 0; i < na; i++)
+    {
+        d = (uint64_t)r[i] - a[i] - borrow;
+        r[i] = (limb)d;
+        borrow = d >> 63;
+    }
+    for (; borrow && i < nr; i++)
+    {
+        d = (uint64_t)r[i] - borrow;
+        r[i] = (limb)d;
+        borrow = d >> 63;
+    }
+}
+
+/* R = A * B, where R has room for NA + NB limbs. Long operands are split
+ * in halves for Karatsuba's three multiplications instead of four */
+static void
+limbs_mul (const limb *a, long na, const limb *b, long nb, limb *r)
+{
+    const limb *tmp;
+    limb *sa, *sb, *t;
+    uint64_t p;
+    long i, j, m, nsa, nsb, nt;
+
+    if (na < nb)
+    {
+        tmp = a, a = b, b = tmp;
+        i = na, na = nb, nb = i;
+    }
+    if (nb < KARATSUBA_THRESHOLD)
+    {
+        memset (r, 0, (na + nb) * sizeof *r);
+        for (j = 0; j < nb; j++)
+        {
+            p = 0;
+            for (i = 0; i < na; i++)
+            {
+                p += (uint64_t)a[i] * b[j] + r[i + j];
+                r[i + j] = (limb)p;
+                p >>= LIMB_BITS;
+            }
+            r[na + j] = (limb)p;
+        }
+        return;
+    }
+
+    m = na / 2;
+    if (nb <= m)
+    {
+        /* B is too short to split, A = A1 B^m + A0 so the product is
+         * A0 B + A1 B B^m */
+        t = alloc_limbs (na - m + nb);
+        limbs_mul (a, m, b, nb, r);
+        memset (r + m + nb, 0, (na - m) * sizeof *r);
+        limbs_mul (a + m, na - m, b, nb, t);
+        limbs_add (r + m, na + nb - m, t, na - m + nb);
+        free (t);
+        return;
+    }
+
+    /* With A = A1 B^m + A0 and B = B1 B^m + B0 the product is
+     * Z2 B^2m + (Z1 - Z2 - Z0) B^m + Z0, Z2 = A1 B1, Z0 = A0 B0 and
+     * Z1 = (A1 + A0)(B1 + B0). Z0 and Z2 go straight into R */
+    limbs_mul (a, m, b, m, r);
+    limbs_mul (a + m, na - m, b + m, nb - m, r + 2 * m);
+    nsa = na - m + 1;
+    nsb = (nb - m > m ? nb - m : m) + 1;
+    sa = alloc_limbs (nsa);
+    sb = alloc_limbs (nsb);
+    memset (sa, 0, nsa * sizeof *sa);
+    memset (sb, 0, nsb * sizeof *sb);
+    memcpy (sa, a + m, (na - m) * sizeof *sa);
+    memcpy (sb, b + m, (nb - m) * sizeof *sb);
+    limbs_add (sa, nsa, a, m);
+    limbs_add (sb, nsb, b, m);
+    t = alloc_limbs (nsa + nsb);
+    limbs_mul (sa, nsa, sb, nsb, t);
+    limbs_sub (t, nsa + nsb, r, 2 * m);
+    limbs_sub (t, nsa + nsb, r + 2 * m, na + nb - 2 * m);
+    nt = nsa + nsb < na + nb - m ? nsa + nsb : na + nb - m;
+    limbs_add (r + m, na + nb - m, t, nt);
+    free (sa);
+    free (sb);
+    free (t);
+}
+
+/* D = D * M + A in place, returning the carry out of D */
+static limb
+limbs_mul_small (limb *d, long n, limb m, limb a)
+{
+    uint64_t carry = a;
+    long i;
+    for (i = 0; i < n; i++)
+    {
+        carry += (uint64_t)d[i] * m;
+        d[i] = (limb)carry;
+        carry >>= LIMB_BITS;
+    }
+    return (limb)carry;
+}
+
+/* Divides U by the single limb V in place, returning the remainder */
+static limb
+limbs_div_small (limb *u, long nu, limb v)
+{
+    uint64_t rem = 0;
+    long i;
+    for (i = nu - 1; i >= 0; i--)
+    {
+        rem = rem << LIMB_BITS | u[i];
+        u[i] = (limb)(rem / v);
+        rem %= v;
+    }
+    return (limb)rem;
+}
+
+/* Q = U / V and R = U % V, where the top limb of V is nonzero and NU >= NV.
+ * Q has room for NU - NV + 1 limbs and R for NV. Knuth's algorithm D
+ */
+static void
+limbs_divmod (const limb *u, long nu, const limb *v, long nv, limb *q,
+              limb *r)
+{
+    limb *un, *vn;
+    uint64_t num, qhat, rhat, p;
+    int64_t t, k;
+    int s = 0;
+    long i, j;
+
+    if (nv == 1)
+    {
+        memcpy (q, u, nu * sizeof *q);
+        r[0] = limbs_div_small (q, nu, v[0]);
+        return;
+    }
+    /* shift V left until its top bit is set, and U with it */
+    while (!(v[nv - 1] << s & 0x80000000u))
+        s++;
+    vn = alloc_limbs (nv);
+    un = alloc_limbs (nu + 1);
+    for (i = nv - 1; i > 0; i--)
+        vn[i] = (limb)((uint64_t)v[i] << s | (uint64_t)v[i - 1] >> (LIMB_BITS - s));
+    vn[0] = v[0] << s;
+    un[nu] = (limb)((uint64_t)u[nu - 1] >> (LIMB_BITS - s));
+    for (i = nu - 1; i > 0; i--)
+        un[i] = (limb)((uint64_t)u[i] << s | (uint64_t)u[i - 1] >> (LIMB_BITS - s));
+    un[0] = u[0] << s;
+
+    for (j = nu - nv; j >= 0; j--)
+    {
+        /* estimate the quotient limb from the top two limbs, it is at most
+         * two too big */
+        num = (uint64_t)un[j + nv] << LIMB_BITS | un[j + nv - 1];
+        qhat = num / vn[nv - 1];
+        rhat = num % vn[nv - 1];
+        while (qhat >= LIMB_BASE
+                || qhat * vn[nv - 2] > (rhat << LIMB_BITS | un[j + nv - 2]))
+        {
+            qhat--;
+            rhat += vn[nv - 1];
+            if (rhat >= LIMB_BASE)
+                break;
+        }
+        /* subtract qhat V, adding V back if that went negative */
+        k = 0;
+        for (i = 0; i < nv; i++)
+        {
+            p = qhat * vn[i];
+            t = (int64_t)un[i + j] - k - (int64_t)(p & 0xffffffffu);
+            un[i + j] = (limb)t;
+            k = (int64_t)(p >> LIMB_BITS) - (t >> LIMB_BITS);
+        }
+        t = (int64_t)un[j + nv] - k;
+        un[j + nv] = (limb)t;
+        q[j] = (limb)qhat;
+        if (t < 0)
+        {
+            q[j]--;
+            k = 0;
+            for (i = 0; i < nv; i++)
+            {
+                t = (int64_t)un[i + j] + vn[i] + k;
+                un[i + j] = (limb)t;
+                k = t >> LIMB_BITS;
+            }
+            un[j + nv] += (limb)k;
+        }
+    }
+    for (i = 0; i < nv - 1; i++)
+        r[i] = (limb)((uint64_t)un[i] >> s | (uint64_t)un[i + 1] << (LIMB_BITS - s));
+    r[nv - 1] = un[nv - 1] >> s;
+    free (un);
+    free (vn);
+}
+
+/* X + SIGN * Y */
+static object*
+add_views (integer_view *x, integer_view *y, int sign)
+{
+    integer_view *big = x, *small = y;
+    limb *r;
+    long n;
+    object *result;
+
+    sign *= y->sign;
+    if (x->sign == sign)
+    {
+        if (x->n < y->n)
+            big = y, small = x;
+        n = big->n + 1;
+        r = alloc_limbs (n);
+        memcpy (r, big->d, big->n * sizeof *r);
+        r[big->n] = 0;
+        limbs_add (r, n, small->d, small->n);
+        result = make_integer_from_limbs (sign, r, n);
+    }
+    else
+    {
+        if (limbs_compare (x->d, x->n, y->d, y->n) < 0)
+            big = y, small = x, sign = -x->sign;
+        else
+            sign = x->sign;
+        n = big->n;
+        r = alloc_limbs (n);
+        memcpy (r, big->d, n * sizeof *r);
+        limbs_sub (r, n, small->d, small->n);
+        result = make_integer_from_limbs (sign, r, n);
+    }
+    free (r);
+    return result;
+}
+
+object*
+integer_add (object *a, object *b)
+{
+    integer_view x, y;
+    if (is_fixnum (a) && is_fixnum (b))
+        return make_integer (fixnum_value (a) + fixnum_value (b));
+    view_integer (a, &x);
+    view_integer (b, &y);
+    return add_views (&x, &y, 1);
+}
+
+object*
+integer_sub (object *a, object *b)
+{
+    integer_view x, y;
+    if (is_fixnum (a) && is_fixnum (b))
+        return make_integer (fixnum_value (a) - fixnum_value (b));
+    view_integer (a, &x);
+    view_integer (b, &y);
+    return add_views (&x, &y, -1);
+}
+
+object*
+integer_negate (object *a)
+{
+    return integer_sub (make_fixnum (0), a);
+}
+
+object*
+integer_mul (object *a, object *b)
+{
+    integer_view x, y;
+    object *result;
+    limb *r;
+    long p;
+
+    if (is_fixnum (a) && is_fixnum (b)
+            && fixnum_mul (fixnum_value (a), fixnum_value (b), &p))
+        return make_fixnum (p);
+    view_integer (a, &x);
+    view_integer (b, &y);
+    if (x.n == 0 || y.n == 0)
+        return make_fixnum (0);
+    r = alloc_limbs (x.n + y.n);
+    limbs_mul (x.d, x.n, y.d, y.n, r);
+    result = make_integer_from_limbs (x.sign * y.sign, r, x.n + y.n);
+    free (r);
+    return result;
+}
+
+/* Truncating division like C's: the quotient rounds toward zero and the
+ * remainder has the sign of the dividend. Returns the quotient if REMAINDER
+ * is false, else the remainder
+ */
+static object*
+divide (object *a, object *b, bool remainder)
+{
+    integer_view x, y;
+    object *result;
+    limb *q, *r;
+
+    view_integer (a, &x);
+    view_integer (b, &y);
+    if (y.n == 0)
+    {
+        fprintf (stderr, "division by zero\n");
+        exit (1);
+    }
+    if (limbs_compare (x.d, x.n, y.d, y.n) < 0)
+        return remainder ? a : make_fixnum (0);
+    q = alloc_limbs (x.n - y.n + 1);
+    r = alloc_limbs (y.n);
+    limbs_divmod (x.d, x.n, y.d, y.n, q, r);
+    if (remainder)
+        result = make_integer_from_limbs (x.sign, r, y.n);
+    else
+        result = make_integer_from_limbs (x.sign * y.sign, q, x.n - y.n + 1);
+    free (q);
+    free (r);
+    return result;
+}
+
+object*
+integer_quotient (object *a, object *b)
+{
+    if (is_fixnum (a) && is_fixnum (b) && b != make_fixnum (0))
+        return make_integer (fixnum_value (a) / fixnum_value (b));
+    return divide (a, b, false);
+}
+
+object*
+integer_remainder (object *a, object *b)
+{
+    if (is_fixnum (a) && is_fixnum (b) && b != make_fixnum (0))
+        return make_fixnum (fixnum_value (a) % fixnum_value (b));
+    return divide (a, b, true);
+}
+
+/* Returns a negative number, zero or a positive number as A is less than,
+ * equal to or greater than B */
+int
+integer_compare (object *a, object *b)
+{
+    integer_view x, y;
+    int c;
+
+    if (is_fixnum (a) && is_fixnum (b))
+        return (fixnum_value (a) > fixnum_value (b))
+               - (fixnum_value (a) < fixnum_value (b));
+    view_integer (a, &x);
+    view_integer (b, &y);
+    if (x.sign != y.sign)
+        return x.sign;
+    c = limbs_compare (x.d, x.n, y.d, y.n);
+    return x.sign > 0 ? c : -c;
+}
+
+/* Returns the decimal representation of the integer A in a malloc'd string */
+char*
+integer_to_string (object *a)
+{
+    integer_view x;
+    limb *d, *chunks;
+    char *s, *p;
+    long n, nchunks = 0, i;
+
+    view_integer (a, &x);
+    n = x.n;
+    d = alloc_limbs (n);
+    memcpy (d, x.d, n * sizeof *d);
+    /* nine decimal digits per chunk, least significant first */
+    chunks = alloc_limbs (n * 2 + 1);
+    do
+    {
+        chunks[nchunks++] = limbs_div_small (d, n, DECIMAL_BASE);
+        while (n > 0 && d[n - 1] == 0)
+            n--;
+    } while (n > 0);
+    s = p = malloc (nchunks * DECIMAL_DIGITS + 2);
+    if (s == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    if (x.sign < 0)
+        *p++ = '-';
+    p += sprintf (p, "%lu", (unsigned long)chunks[nchunks - 1]);
+    for (i = nchunks - 2; i >= 0; i--)
+        p += sprintf (p, "%09lu", (unsigned long)chunks[i]);
+    free (chunks);
+    free (d);
+    return s;
+}
+
+/* Parses S as an optionally signed decimal integer, returning NULL if it
+ * isn't one */
+object*
+string_to_integer (const char *s)
+{
+    const char *digits;
+    limb *d, chunk;
+    long n = 0, len, i, first;
+    int sign = 1;
+    object *result;
+
+    if (*s == '-' || *s == '+')
+        sign = *s++ == '-' ? -1 : 1;
+    for (digits = s; isdigit ((unsigned char)*s); s++)
+        ;
+    len = s - digits;
+    if (len == 0 || *s != '\0')
+        return NULL;
+    /* each chunk of nine digits multiplies by 10^9 and adds, starting with
+     * the (possibly shorter) most significant one */
+    d = alloc_limbs (len / DECIMAL_DIGITS + 2);
+    for (i = 0; i < len; i += first)
+    {
+        first = i == 0 && len % DECIMAL_DIGITS ? len % DECIMAL_DIGITS
+                                               : DECIMAL_DIGITS;
+        for (chunk = 0, s = digits + i; s < digits + i + first; s++)
+            chunk = chunk * 10 + (*s - '0');
+        d[n] = limbs_mul_small (d, n, DECIMAL_BASE, chunk);
+        if (d[n] != 0)
+            n++;
+    }
+    result = make_integer_from_limbs (sign, d, n);
+    free (d);
+    return result;
+}
+
+/* Stores the integer A in *V, returning false if it is out of range */
+bool
+integer_to_s64 (object *a, int64_t *v)
+{
+    integer_view x;
+    uint64_t m;
+
+    if (is_fixnum (a))
+    {
+        *v = fixnum_value (a);
+        return true;
+    }
+    view_integer (a, &x);
+    if (x.n > 2)
+        return false;
+    m = x.d[0] | (uint64_t)(x.n > 1 ? x.d[1] : 0) << LIMB_BITS;
+    if (x.sign > 0 ? m > INT64_MAX : m > (uint64_t)INT64_MAX + 1)
+        return false;
+    *v = x.sign > 0 ? (int64_t)m : -(int64_t)(m - 1) - 1;
+    return true;
+}
+
+/* Flonums. An operation on integers stays exact, anything involving a
+ * flonum is done in doubles */
+
+double
+number_to_double (object *a)
+{
+    integer_view x;
+    double d = 0;
+    long i;
+
+    if (is_fixnum (a))
+        return fixnum_value (a);
+    if (type_of (a) == FLONUM)
+        return flonum_value (a);
+    view_integer (a, &x);
+    for (i = x.n - 1; i >= 0; i--)
+        d = d * LIMB_BASE + x.d[i];
+    return x.sign * d;
+}
+
+static void
+check_number (object *a)
+{
+    if (!is_number (a))
+    {
+        fprintf (stderr, "expected a number\n");
+        exit (1);
+    }
+}
+
+object*
+number_add (object *a, object *b)
+{
+    if (is_integer (a) && is_integer (b))
+        return integer_add (a, b);
+    check_number (a);
+    check_number (b);
+    return make_flonum (number_to_double (a) + number_to_double (b));
+}
+
+object*
+number_sub (object *a, object *b)
+{
+    if (is_integer (a) && is_integer (b))
+        return integer_sub (a, b);
+    check_number (a);
+    check_number (b);
+    return make_flonum (number_to_double (a) - number_to_double (b));
+}
+
+object*
+number_mul (object *a, object *b)
+{
+    if (is_integer (a) && is_integer (b))
+        return integer_mul (a, b);
+    check_number (a);
+    check_number (b);
+    return make_flonum (number_to_double (a) * number_to_double (b));
+}
+
+/* There are no exact rationals, so an integer quotient is exact only when
+ * the division is */
+object*
+number_divide (object *a, object *b)
+{
+    if (is_integer (a) && is_integer (b))
+    {
+        if (integer_remainder (a, b) == make_fixnum (0))
+            return integer_quotient (a, b);
+    }
+    check_number (a);
+    check_number (b);
+    return make_flonum (number_to_double (a) / number_to_double (b));
+}
+
+/* Truncates the nonnegative D. From 2^52 on every double is integral */
+static double
+truncate_double (double d)
+{
+    return d >= 4503599627370496.0 ? d : (double)(uint64_t)d;
+}
+
+/* The integer D stands for, or NULL if it isn't a finite integral value.
+ * Both are binary, so taking it apart 32 bits at a time is exact */
+object*
+double_to_integer (double d)
+{
+    limb buf[1024 / LIMB_BITS + 1];
+    double m = d < 0 ? -d : d, q;
+    long n = 0;
+
+    if (d != d || d - d != 0
+            || (m < 4503599627370496.0 && truncate_double (m) != m))
+        return NULL;
+    if (m < 4e18)
+        return make_integer ((long)d);
+    while (m > 0)
+    {
+        q = truncate_double (m / LIMB_BASE);
+        buf[n++] = (limb)(m - q * LIMB_BASE);
+        m = q;
+    }
+    return make_integer_from_limbs (d < 0 ? -1 : 1, buf, n);
+}
+
+/* Like integer_compare, but returns UNORDERED if either is a NaN */
+int
+number_compare (object *a, object *b)
+{
+    double x, y;
+
+    if (is_integer (a) && is_integer (b))
+        return integer_compare (a, b);
+    check_number (a);
+    check_number (b);
+    x = number_to_double (a);
+    y = number_to_double (b);
+    if (x != x || y != y)
+        return UNORDERED;
+    return (x > y) - (x < y);
+}
+
+/* Returns the representation of the double D in a malloc'd string: the
+ * fewest digits that read back the same, and always a point or an exponent
+ * to set it apart from an integer */
+char*
+flonum_to_string (double d)
+{
+    char *s = malloc (32);
+    int precision;
+
+    if (s == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    if (d != d)
+        return strcpy (s, "+nan.0");
+    if (d - d != 0)
+        return strcpy (s, d > 0 ? "+inf.0" : "-inf.0");
+    for (precision = 15; precision < 17; precision++)
+    {
+        sprintf (s, "%.*g", precision, d);
+        if (strtod (s, NULL) == d)
+            break;
+    }
+    if (precision == 17)
+        sprintf (s, "%.17g", d);
+    if (strpbrk (s, ".e") == NULL)
+        strcat (s, ".0");
+    return s;
+}
+
+/* Returns the representation of the number A in a malloc'd string */
+char*
+number_to_string (object *a)
+{
+    if (type_of (a) == FLONUM)
+        return flonum_to_string (flonum_value (a));
+    return integer_to_string (a);
+}
@@ -0,0 +1,662 @@
+/*
+ * SRFI-4 style homogeneous vectors for scum: f64vectors of doubles and
+ * s64vectors of 64 bit integers. The elements are kept unboxed in the slots
+ * of a slotted object, and the bulk operations (element-wise add and mul,
+ * scale, dot product, sum, min and max) run as C loops over them, vectorized
+ * with AVX2 or SSE2 when the compiler targets them. Build with -DNO_SIMD for
+ * the scalar loops alone. s64vector arithmetic wraps around like the
+ * unsigned C types, and the vectorized sums and dot products add in a
+ * different order than the scalar ones, so flonum results can differ in the
+ * last bits
+ */
+#include "scum.h"
+
+#if !defined(NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define F64_LANES 4
+typedef __m256d f64x;
+#define f64x_load(p)     _mm256_loadu_pd (p)
+#define f64x_store(p, v) _mm256_storeu_pd (p, v)
+#define f64x_set1(x)     _mm256_set1_pd (x)
+#define f64x_add(a, b)   _mm256_add_pd (a, b)
+#define f64x_mul(a, b)   _mm256_mul_pd (a, b)
+#define f64x_min(a, b)   _mm256_min_pd (a, b)
+#define f64x_max(a, b)   _mm256_max_pd (a, b)
+#define S64_LANES 4
+typedef __m256i s64x;
+#define s64x_load(p)     _mm256_loadu_si256 ((const __m256i *)(p))
+#define s64x_store(p, v) _mm256_storeu_si256 ((__m256i *)(p), v)
+#define s64x_zero()      _mm256_setzero_si256 ()
+#define s64x_add(a, b)   _mm256_add_epi64 (a, b)
+/* only AVX2 can compare 64 bit integers */
+#define s64x_min(a, b) \
+    _mm256_blendv_epi8 (a, b, _mm256_cmpgt_epi64 (a, b))
+#define s64x_max(a, b) \
+    _mm256_blendv_epi8 (b, a, _mm256_cmpgt_epi64 (a, b))
+#elif !defined(NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define F64_LANES 2
+typedef __m128d f64x;
+#define f64x_load(p)     _mm_loadu_pd (p)
+#define f64x_store(p, v) _mm_storeu_pd (p, v)
+#define f64x_set1(x)     _mm_set1_pd (x)
+#define f64x_add(a, b)   _mm_add_pd (a, b)
+#define f64x_mul(a, b)   _mm_mul_pd (a, b)
+#define f64x_min(a, b)   _mm_min_pd (a, b)
+#define f64x_max(a, b)   _mm_max_pd (a, b)
+#define S64_LANES 2
+typedef __m128i s64x;
+#define s64x_load(p)     _mm_loadu_si128 ((const __m128i *)(p))
+#define s64x_store(p, v) _mm_storeu_si128 ((__m128i *)(p), v)
+#define s64x_zero()      _mm_setzero_si128 ()
+#define s64x_add(a, b)   _mm_add_epi64 (a, b)
+#endif
+
+/* The kernels. Each runs its vector loop over whole groups of lanes, if
+ * there is one, and finishes the rest with the scalar loop */
+
+static void
+f64_add (double *r, const double *a, const double *b, long n)
+{
+    long i = 0;
+#ifdef F64_LANES
+    for (; i + F64_LANES <= n; i += F64_LANES)
+        f64x_store (r + i, f64x_add (f64x_load (a + i), f64x_load (b + i)));
+#endif
+    for (; i < n; i++)
+        r[i] = a[i] + b[i];
+}
+
+static void
+f64_mul (double *r, const double *a, const double *b, long n)
+{
+    long i = 0;
+#ifdef F64_LANES
+    for (; i + F64_LANES <= n; i += F64_LANES)
+        f64x_store (r + i, f64x_mul (f64x_load (a + i), f64x_load (b + i)));
+#endif
+    for (; i < n; i++)
+        r[i] = a[i] * b[i];
+}
+
+static void
+f64_scale (double *r, const double *a, double k, long n)
+{
+    long i = 0;
+#ifdef F64_LANES
+    f64x kx = f64x_set1 (k);
+    for (; i + F64_LANES <= n; i += F64_LANES)
+        f64x_store (r + i, f64x_mul (f64x_load (a + i), kx));
+#endif
+    for (; i < n; i++)
+        r[i] = a[i] * k;
+}
+
+static double
+f64_dot (const double *a, const double *b, long n)
+{
+    double sum = 0;
+    long i = 0;
+#ifdef F64_LANES
+    double lanes[F64_LANES];
+    f64x acc = f64x_set1 (0);
+    int j;
+    for (; i + F64_LANES <= n; i += F64_LANES)
+        acc = f64x_add (acc, f64x_mul (f64x_load (a + i), f64x_load (b + i)));
+    f64x_store (lanes, acc);
+    for (j = 0; j < F64_LANES; j++)
+        sum += lanes[j];
+#endif
+    for (; i < n; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+static double
+f64_sum (const double *a, long n)
+{
+    double sum = 0;
+    long i = 0;
+#ifdef F64_LANES
+    double lanes[F64_LANES];
+    f64x acc = f64x_set1 (0);
+    int j;
+    for (; i + F64_LANES <= n; i += F64_LANES)
+        acc = f64x_add (acc, f64x_load (a + i));
+    f64x_store (lanes, acc);
+    for (j = 0; j < F64_LANES; j++)
+        sum += lanes[j];
+#endif
+    for (; i < n; i++)
+        sum += a[i];
+    return sum;
+}
+
+/* The smallest (or with MAX the largest) of the N > 0 elements of A */
+static double
+f64_extreme (const double *a, long n, bool max)
+{
+    double best = a[0];
+    long i = 0;
+#ifdef F64_LANES
+    double lanes[F64_LANES];
+    f64x acc;
+    int j;
+    if (n >= F64_LANES)
+    {
+        acc = f64x_load (a);
+        for (i = F64_LANES; i + F64_LANES <= n; i += F64_LANES)
+            acc = max ? f64x_max (acc, f64x_load (a + i))
+                      : f64x_min (acc, f64x_load (a + i));
+        f64x_store (lanes, acc);
+        for (j = 0; j < F64_LANES; j++)
+            if (max ? lanes[j] > best : lanes[j] < best)
+                best = lanes[j];
+    }
+#endif
+    for (; i < n; i++)
+        if (max ? a[i] > best : a[i] < best)
+            best = a[i];
+    return best;
+}
+
+static void
+s64_add (int64_t *r, const int64_t *a, const int64_t *b, long n)
+{
+    long i = 0;
+#ifdef S64_LANES
+    for (; i + S64_LANES <= n; i += S64_LANES)
+        s64x_store (r + i, s64x_add (s64x_load (a + i), s64x_load (b + i)));
+#endif
+    for (; i < n; i++)
+        r[i] = (int64_t)((uint64_t)a[i] + (uint64_t)b[i]);
+}
+
+/* neither SSE2 nor AVX2 multiplies 64 bit lanes, these are left to the
+ * compiler */
+static void
+s64_mul (int64_t *r, const int64_t *a, const int64_t *b, long n)
+{
+    long i;
+    for (i = 0; i < n; i++)
+        r[i] = (int64_t)((uint64_t)a[i] * (uint64_t)b[i]);
+}
+
+static void
+s64_scale (int64_t *r, const int64_t *a, int64_t k, long n)
+{
+    long i;
+    for (i = 0; i < n; i++)
+        r[i] = (int64_t)((uint64_t)a[i] * (uint64_t)k);
+}
+
+static int64_t
+s64_dot (const int64_t *a, const int64_t *b, long n)
+{
+    uint64_t sum = 0;
+    long i;
+    for (i = 0; i < n; i++)
+        sum += (uint64_t)a[i] * (uint64_t)b[i];
+    return (int64_t)sum;
+}
+
+static int64_t
+s64_sum (const int64_t *a, long n)
+{
+    uint64_t sum = 0;
+    long i = 0;
+#ifdef S64_LANES
+    int64_t lanes[S64_LANES];
+    s64x acc = s64x_zero ();
+    int j;
+    for (; i + S64_LANES <= n; i += S64_LANES)
+        acc = s64x_add (acc, s64x_load (a + i));
+    s64x_store (lanes, acc);
+    for (j = 0; j < S64_LANES; j++)
+        sum += (uint64_t)lanes[j];
+#endif
+    for (; i < n; i++)
+        sum += (uint64_t)a[i];
+    return (int64_t)sum;
+}
+
+static int64_t
+s64_extreme (const int64_t *a, long n, bool max)
+{
+    int64_t best = a[0];
+    long i = 0;
+#ifdef s64x_min
+    int64_t lanes[S64_LANES];
+    s64x acc;
+    int j;
+    if (n >= S64_LANES)
+    {
+        acc = s64x_load (a);
+        for (i = S64_LANES; i + S64_LANES <= n; i += S64_LANES)
+            acc = max ? s64x_max (acc, s64x_load (a + i))
+                      : s64x_min (acc, s64x_load (a + i));
+        s64x_store (lanes, acc);
+        for (j = 0; j < S64_LANES; j++)
+            if (max ? lanes[j] > best : lanes[j] < best)
+                best = lanes[j];
+    }
+#endif
+    for (; i < n; i++)
+        if (max ? a[i] > best : a[i] < best)
+            best = a[i];
+    return best;
+}
+
+/* Makes a vector of TYPE with room for LENGTH elements, which are left
+ * uninitialized */
+static object*
+make_numvec (object_t type, long length)
+{
+    long bytes = length * (long)sizeof (double);
+    object *obj = alloc_slotted (type, (bytes + sizeof (object *) - 1)
+                                       / sizeof (object *));
+    obj->data.numvec.length = length;
+    return obj;
+}
+
+static object*
+check_numvec (object *obj, object_t type)
+{
+    if (type_of (obj) != type)
+    {
+        fprintf (stderr, "expected an %s\n",
+                 type == F64VECTOR ? "f64vector" : "s64vector");
+        exit (1);
+    }
+    return obj;
+}
+
+static long
+check_index (object *vec, object *k)
+{
+    if (!is_fixnum (k) || fixnum_value (k) < 0
+            || fixnum_value (k) >= vec->data.numvec.length)
+    {
+        fprintf (stderr, "vector index out of range\n");
+        exit (1);
+    }
+    return fixnum_value (k);
+}
+
+static long
+check_length (object *obj)
+{
+    if (!is_fixnum (obj) || fixnum_value (obj) < 0)
+    {
+        fprintf (stderr, "expected a vector length\n");
+        exit (1);
+    }
+    return fixnum_value (obj);
+}
+
+/* The length A and B share, for the element-wise operations */
+static long
+same_length (object *a, object *b)
+{
+    if (a->data.numvec.length != b->data.numvec.length)
+    {
+        fprintf (stderr, "vectors differ in length\n");
+        exit (1);
+    }
+    return a->data.numvec.length;
+}
+
+static long
+check_nonempty (object *vec)
+{
+    if (vec->data.numvec.length == 0)
+    {
+        fprintf (stderr, "empty vector\n");
+        exit (1);
+    }
+    return vec->data.numvec.length;
+}
+
+static double
+f64_element (object *obj)
+{
+    if (!is_number (obj))
+    {
+        fprintf (stderr, "expected a number\n");
+        exit (1);
+    }
+    return number_to_double (obj);
+}
+
+static int64_t
+s64_element (object *obj)
+{
+    int64_t v;
+    if (!is_integer (obj) || !integer_to_s64 (obj, &v))
+    {
+        fprintf (stderr, "expected a 64 bit integer\n");
+        exit (1);
+    }
+    return v;
+}
+
+/* f64vector procedures */
+
+object*
+is_f64vector_proc (long argc, object **argv)
+{
+    return type_of (argv[0]) == F64VECTOR ? t : f;
+}
+
+object*
+make_f64vector_proc (long argc, object **argv)
+{
+    long i, n = check_length (argv[0]);
+    double fill = argc > 1 ? f64_element (argv[1]) : 0;
+    object *vec = make_numvec (F64VECTOR, n);
+    for (i = 0; i < n; i++)
+        f64vector_elements (vec)[i] = fill;
+    return vec;
+}
+
+object*
+f64vector_proc (long argc, object **argv)
+{
+    long i;
+    object *vec = make_numvec (F64VECTOR, argc);
+    for (i = 0; i < argc; i++)
+        f64vector_elements (vec)[i] = f64_element (argv[i]);
+    return vec;
+}
+
+object*
+f64vector_length_proc (long argc, object **argv)
+{
+    return make_fixnum (check_numvec (argv[0], F64VECTOR)->data.numvec.length);
+}
+
+object*
+f64vector_ref_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], F64VECTOR);
+    return make_flonum (f64vector_elements (vec)[check_index (vec, argv[1])]);
+}
+
+object*
+f64vector_set_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], F64VECTOR);
+    f64vector_elements (vec)[check_index (vec, argv[1])] =
+        f64_element (argv[2]);
+    return ok;
+}
+
+/* the list is built from the back, rooted while the flonums are made */
+object*
+f64vector_to_list_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], F64VECTOR), *list = nil, *x;
+    long i = vec->data.numvec.length;
+    size_t roots = gc_save_roots ();
+    gc_root (&list);
+    while (i-- > 0)
+    {
+        x = make_flonum (f64vector_elements (vec)[i]);
+        list = cons (x, list);
+    }
+    gc_restore_roots (roots);
+    return list;
+}
+
+object*
+list_to_f64vector_proc (long argc, object **argv)
+{
+    object *vec = make_numvec (F64VECTOR, list_length (argv[0])), *l;
+    long i;
+    for (i = 0, l = argv[0]; l != nil; i++, l = cdr (l))
+        f64vector_elements (vec)[i] = f64_element (car (l));
+    return vec;
+}
+
+object*
+f64vector_add_proc (long argc, object **argv)
+{
+    long n = same_length (check_numvec (argv[0], F64VECTOR),
+                          check_numvec (argv[1], F64VECTOR));
+    object *vec = make_numvec (F64VECTOR, n);
+    f64_add (f64vector_elements (vec), f64vector_elements (argv[0]),
+             f64vector_elements (argv[1]), n);
+    return vec;
+}
+
+object*
+f64vector_mul_proc (long argc, object **argv)
+{
+    long n = same_length (check_numvec (argv[0], F64VECTOR),
+                          check_numvec (argv[1], F64VECTOR));
+    object *vec = make_numvec (F64VECTOR, n);
+    f64_mul (f64vector_elements (vec), f64vector_elements (argv[0]),
+             f64vector_elements (argv[1]), n);
+    return vec;
+}
+
+object*
+f64vector_scale_proc (long argc, object **argv)
+{
+    long n = check_numvec (argv[0], F64VECTOR)->data.numvec.length;
+    double k = f64_element (argv[1]);
+    object *vec = make_numvec (F64VECTOR, n);
+    f64_scale (f64vector_elements (vec), f64vector_elements (argv[0]), k, n);
+    return vec;
+}
+
+object*
+f64vector_dot_proc (long argc, object **argv)
+{
+    long n = same_length (check_numvec (argv[0], F64VECTOR),
+                          check_numvec (argv[1], F64VECTOR));
+    return make_flonum (f64_dot (f64vector_elements (argv[0]),
+                                 f64vector_elements (argv[1]), n));
+}
+
+object*
+f64vector_sum_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], F64VECTOR);
+    return make_flonum (f64_sum (f64vector_elements (vec),
+                                 vec->data.numvec.length));
+}
+
+object*
+f64vector_min_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], F64VECTOR);
+    return make_flonum (f64_extreme (f64vector_elements (vec),
+                                     check_nonempty (vec), false));
+}
+
+object*
+f64vector_max_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], F64VECTOR);
+    return make_flonum (f64_extreme (f64vector_elements (vec),
+                                     check_nonempty (vec), true));
+}
+
+/* s64vector procedures */
+
+object*
+is_s64vector_proc (long argc, object **argv)
+{
+    return type_of (argv[0]) == S64VECTOR ? t : f;
+}
+
+object*
+make_s64vector_proc (long argc, object **argv)
+{
+    long i, n = check_length (argv[0]);
+    int64_t fill = argc > 1 ? s64_element (argv[1]) : 0;
+    object *vec = make_numvec (S64VECTOR, n);
+    for (i = 0; i < n; i++)
+        s64vector_elements (vec)[i] = fill;
+    return vec;
+}
+
+object*
+s64vector_proc (long argc, object **argv)
+{
+    long i;
+    object *vec = make_numvec (S64VECTOR, argc);
+    for (i = 0; i < argc; i++)
+        s64vector_elements (vec)[i] = s64_element (argv[i]);
+    return vec;
+}
+
+object*
+s64vector_length_proc (long argc, object **argv)
+{
+    return make_fixnum (check_numvec (argv[0], S64VECTOR)->data.numvec.length);
+}
+
+object*
+s64vector_ref_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], S64VECTOR);
+    return make_integer (s64vector_elements (vec)[check_index (vec, argv[1])]);
+}
+
+object*
+s64vector_set_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], S64VECTOR);
+    s64vector_elements (vec)[check_index (vec, argv[1])] =
+        s64_element (argv[2]);
+    return ok;
+}
+
+object*
+s64vector_to_list_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], S64VECTOR), *list = nil, *x;
+    long i = vec->data.numvec.length;
+    size_t roots = gc_save_roots ();
+    gc_root (&list);
+    while (i-- > 0)
+    {
+        x = make_integer (s64vector_elements (vec)[i]);
+        list = cons (x, list);
+    }
+    gc_restore_roots (roots);
+    return list;
+}
+
+object*
+list_to_s64vector_proc (long argc, object **argv)
+{
+    object *vec = make_numvec (S64VECTOR, list_length (argv[0])), *l;
+    long i;
+    for (i = 0, l = argv[0]; l != nil; i++, l = cdr (l))
+        s64vector_elements (vec)[i] = s64_element (car (l));
+    return vec;
+}
+
+object*
+s64vector_add_proc (long argc, object **argv)
+{
+    long n = same_length (check_numvec (argv[0], S64VECTOR),
+                          check_numvec (argv[1], S64VECTOR));
+    object *vec = make_numvec (S64VECTOR, n);
+    s64_add (s64vector_elements (vec), s64vector_elements (argv[0]),
+             s64vector_elements (argv[1]), n);
+    return vec;
+}
+
+object*
+s64vector_mul_proc (long argc, object **argv)
+{
+    long n = same_length (check_numvec (argv[0], S64VECTOR),
+                          check_numvec (argv[1], S64VECTOR));
+    object *vec = make_numvec (S64VECTOR, n);
+    s64_mul (s64vector_elements (vec), s64vector_elements (argv[0]),
+             s64vector_elements (argv[1]), n);
+    return vec;
+}
+
+object*
+s64vector_scale_proc (long argc, object **argv)
+{
+    long n = check_numvec (argv[0], S64VECTOR)->data.numvec.length;
+    int64_t k = s64_element (argv[1]);
+    object *vec = make_numvec (S64VECTOR, n);
+    s64_scale (s64vector_elements (vec), s64vector_elements (argv[0]), k, n);
+    return vec;
+}
+
+object*
+s64vector_dot_proc (long argc, object **argv)
+{
+    long n = same_length (check_numvec (argv[0], S64VECTOR),
+                          check_numvec (argv[1], S64VECTOR));
+    return make_integer (s64_dot (s64vector_elements (argv[0]),
+                                  s64vector_elements (argv[1]), n));
+}
+
+object*
+s64vector_sum_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], S64VECTOR);
+    return make_integer (s64_sum (s64vector_elements (vec),
+                                  vec->data.numvec.length));
+}
+
+object*
+s64vector_min_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], S64VECTOR);
+    return make_integer (s64_extreme (s64vector_elements (vec),
+                                      check_nonempty (vec), false));
+}
+
+object*
+s64vector_max_proc (long argc, object **argv)
+{
+    object *vec = check_numvec (argv[0], S64VECTOR);
+    return make_integer (s64_extreme (s64vector_elements (vec),
+                                      check_nonempty (vec), true));
+}
+
+void
+add_numvec_procedures (object *env)
+{
+    add_procedure("f64vector?"      , is_f64vector_proc, 1, env);
+    add_procedure("make-f64vector"  , make_f64vector_proc, VARIADIC (1), env);
+    add_procedure("f64vector"       , f64vector_proc, VARIADIC (0), env);
+    add_procedure("f64vector-length", f64vector_length_proc, 1, env);
+    add_procedure("f64vector-ref"   , f64vector_ref_proc, 2, env);
+    add_procedure("f64vector-set!"  , f64vector_set_proc, 3, env);
+    add_procedure("f64vector->list" , f64vector_to_list_proc, 1, env);
+    add_procedure("list->f64vector" , list_to_f64vector_proc, 1, env);
+    add_procedure("f64vector-add"   , f64vector_add_proc, 2, env);
+    add_procedure("f64vector-mul"   , f64vector_mul_proc, 2, env);
+    add_procedure("f64vector-scale" , f64vector_scale_proc, 2, env);
+    add_procedure("f64vector-dot"   , f64vector_dot_proc, 2, env);
+    add_procedure("f64vector-sum"   , f64vector_sum_proc, 1, env);
+    add_procedure("f64vector-min"   , f64vector_min_proc, 1, env);
+    add_procedure("f64vector-max"   , f64vector_max_proc, 1, env);
+
+    add_procedure("s64vector?"      , is_s64vector_proc, 1, env);
+    add_procedure("make-s64vector"  , make_s64vector_proc, VARIADIC (1), env);
+    add_procedure("s64vector"       , s64vector_proc, VARIADIC (0), env);
+    add_procedure("s64vector-length", s64vector_length_proc, 1, env);
+    add_procedure("s64vector-ref"   , s64vector_ref_proc, 2, env);
+    add_procedure("s64vector-set!"  , s64vector_set_proc, 3, env);
+    add_procedure("s64vector->list" , s64vector_to_list_proc, 1, env);
+    add_procedure("list->s64vector" , list_to_s64vector_proc, 1, env);
+    add_procedure("s64vector-add"   , s64vector_add_proc, 2, env);
+    add_procedure("s64vector-mul"   , s64vector_mul_proc, 2, env);
+    add_procedure("s64vector-scale" , s64vector_scale_proc, 2, env);
+    add_procedure("s64vector-dot"   , s64vector_dot_proc, 2, env);
+    add_procedure("s64vector-sum"   , s64vector_sum_proc, 1, env);
+    add_procedure("s64vector-min"   , s64vector_min_proc, 1, env);
+    add_procedure("s64vector-max"   , s64vector_max_proc, 1, env);
+}
@@ -0,0 +1,119 @@
+/*
+ * Bulk scanning for the reader. Each scanner returns the first byte from P up
+ * to END that ends a run of whitespace, string body or symbol, testing a
+ * whole vector of bytes at a time with AVX2 or SSE2 when the compiler targets
+ * them. Build with -DNO_SIMD for the scalar loops alone. The scalar loops use
+ * the same tests as the rest of the reader, the vector ones the same classes
+ * for the C locale
+ */
+#include "scum.h"
+
+#if !defined(NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define SCAN_LANES 32
+#define SCAN_ALL 0xffffffffu
+typedef __m256i u8x;
+#define u8x_load(p)   _mm256_loadu_si256 ((const __m256i *)(p))
+#define u8x_set1(c)   _mm256_set1_epi8 (c)
+#define u8x_eq(a, b)  _mm256_cmpeq_epi8 (a, b)
+#define u8x_gt(a, b)  _mm256_cmpgt_epi8 (a, b)
+#define u8x_or(a, b)  _mm256_or_si256 (a, b)
+#define u8x_and(a, b) _mm256_and_si256 (a, b)
+#define u8x_mask(v)   ((unsigned)_mm256_movemask_epi8 (v))
+#elif !defined(NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define SCAN_LANES 16
+#define SCAN_ALL 0xffffu
+typedef __m128i u8x;
+#define u8x_load(p)   _mm_loadu_si128 ((const __m128i *)(p))
+#define u8x_set1(c)   _mm_set1_epi8 (c)
+#define u8x_eq(a, b)  _mm_cmpeq_epi8 (a, b)
+#define u8x_gt(a, b)  _mm_cmpgt_epi8 (a, b)
+#define u8x_or(a, b)  _mm_or_si128 (a, b)
+#define u8x_and(a, b) _mm_and_si128 (a, b)
+#define u8x_mask(v)   ((unsigned)_mm_movemask_epi8 (v))
+#endif
+
+#ifdef SCAN_LANES
+/* The lanes of V holding a byte from LO to HI. The compares are signed, which
+ * is fine as long as both bounds are ASCII: bytes past it are negative */
+#define u8x_range(v, lo, hi) \
+    u8x_and (u8x_gt (v, u8x_set1 ((lo) - 1)), u8x_gt (u8x_set1 ((hi) + 1), v))
+
+/* The lanes holding whitespace, that is space, tab, newline, vertical tab,
+ * form feed or carriage return */
+static inline u8x
+space_lanes (u8x v)
+{
+    return u8x_or (u8x_eq (v, u8x_set1 (' ')), u8x_range (v, '\t', '\r'));
+}
+
+/* The lanes holding a quote or a backslash */
+static inline u8x
+string_stop_lanes (u8x v)
+{
+    return u8x_or (u8x_eq (v, u8x_set1 ('"')), u8x_eq (v, u8x_set1 ('\\')));
+}
+
+/* The lanes holding a letter, a digit or one of * / < = > ? ! + - */
+static inline u8x
+symbol_lanes (u8x v)
+{
+    u8x letters = u8x_range (u8x_or (v, u8x_set1 (0x20)), 'a', 'z');
+    u8x ranges = u8x_or (u8x_range (v, '0', '9'), u8x_range (v, '<', '?'));
+    u8x ops = u8x_or (u8x_or (u8x_eq (v, u8x_set1 ('*')),
+                              u8x_eq (v, u8x_set1 ('/'))),
+                      u8x_or (u8x_eq (v, u8x_set1 ('!')),
+                              u8x_or (u8x_eq (v, u8x_set1 ('+')),
+                                      u8x_eq (v, u8x_set1 ('-')))));
+    return u8x_or (u8x_or (letters, ranges), ops);
+}
+#endif
+
+/* Returns the first byte from P up to END that isn't whitespace, or END */
+const char*
+scan_whitespace (const char *p, const char *end)
+{
+#ifdef SCAN_LANES
+    unsigned mask;
+    for (; end - p >= SCAN_LANES; p += SCAN_LANES)
+        if ((mask = u8x_mask (space_lanes (u8x_load (p))) ^ SCAN_ALL) != 0)
+            return p + __builtin_ctz (mask);
+#endif
+    while (p < end && isspace ((unsigned char)*p))
+        p++;
+    return p;
+}
+
+/* Returns the first quote or backslash from P up to END, or END */
+const char*
+scan_string (const char *p, const char *end)
+{
+#ifdef SCAN_LANES
+    unsigned mask;
+    for (; end - p >= SCAN_LANES; p += SCAN_LANES)
+        if ((mask = u8x_mask (string_stop_lanes (u8x_load (p)))) != 0)
+            return p + __builtin_ctz (mask);
+#endif
+    while (p < end && *p != '"' && *p != '\\')
+        p++;
+    return p;
+}
+
+/* Returns the first byte from P up to END that can't go on a symbol, or END
+ */
+const char*
+scan_symbol (const char *p, const char *end)
+{
+#ifdef SCAN_LANES
+    unsigned mask;
+    for (; end - p >= SCAN_LANES; p += SCAN_LANES)
+        if ((mask = u8x_mask (symbol_lanes (u8x_load (p))) ^ SCAN_ALL) != 0)
+            return p + __builtin_ctz (mask);
+#endif
+    while (p < end && (is_symbol_start ((unsigned char)*p)
+                       || isdigit ((unsigned char)*p) || *p == '+'
+                       || *p == '-'))
+        p++;
+    return p;
+}
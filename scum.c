@@ -2,87 +2,512 @@
  * scum - a simple, bare bones, readable scheme interpreter (not garaunteed to
  * be rsr5 compliant, but it does the job)
  */
+#define _POSIX_C_SOURCE 200112L
 #include "scum.h"
+#include <sys/resource.h>
+
+/* The singletons, keywords and global environment made by make_singletons,
+ * and the symbol table. These are shared with the VM in vm.c */
+symbol_table_entry *symbol_table;
+size_t symbol_table_count, symbol_table_capacity;
+object *t, *f, *nil, *quote, *define, *set, *ok, *ifs, *plus, *lambda,
+       *global_env, *begin, *cond, *and, *or, *let;
+
+/* The argument stack. Applications push the evaluated operands here, so
+ * primitives see their arguments as ARGC objects at ARGV without any consing,
+ * and the VM keeps all its values here. Everything below ARG_TOP is a root */
+object *arg_stack[ARG_STACK_LEN];
+object **arg_top = arg_stack;
+
+/* Bumped whenever a global is defined or set! (and when a toplevel is made),
+ * so a cached global value is valid as long as the version it was looked up
+ * at is still current */
+unsigned long global_version;
+
+/* What interpret evaluates each expression read with, scum-vm points this at
+ * vm_eval */
+object *(*evaluate) (object *, object *) = eval;
+
+/* Objects are carved out of page aligned slabs. New cells come off the free
+ * list the collector rebuilds, or else off the bump pointer of the newest
+ * slab. Building with MALLOC_CELLS gives every cell its own malloc'd slab,
+ * which is the old one-malloc-per-object allocator (used by make bench)
+ */
+typedef struct slab
+{
+    struct slab *next;
+    size_t used;
+    object cells[];
+} slab;
+
+#ifdef MALLOC_CELLS
+#define SLAB_CELLS 1
+#else
+#define SLAB_CELLS ((SLAB_SIZE - sizeof (slab)) / sizeof (object))
+#endif
+
+static slab *slabs;
+static object *free_cells;
+
+static object *slotted;
+static object *slotted_cache[SLOTTED_CACHE_LEN];
+
+/* State of the garbage collector. ROOTS holds the addresses of C variables
+ * that point into the heap, and MARK_STACK is the explicit work list used while
+ * marking so long lists can't blow the C stack
+ */
+static size_t heap_size;
+static size_t allocs_since_gc;
+/* Slotted objects also count their slots toward the next collection, as
+ * this many cells, so big ones (numeric vectors, bignums) can't pile up
+ * unnoticed. LIVE_SLOT_CELLS is the same for the survivors */
+#define slot_cells(size) ((size_t)(size) * sizeof (object *) / sizeof (object))
+static size_t slot_cells_since_gc, live_slot_cells;
+/* allocations made before the last collection, see gc_allocations */
+static size_t allocs_total;
+static size_t gc_threshold = GC_DEFAULT_THRESHOLD;
+static size_t gc_trigger = GC_DEFAULT_THRESHOLD;
+
+static object ***roots;
+static size_t roots_len, roots_cap;
+
+static object **mark_stack;
+static size_t mark_len, mark_cap;
+
+/* Pushes a fresh slab on the slab list, its cells are handed out by bumping
+ * USED */
+static void
+new_slab (void)
+{
+    slab *s;
+#ifdef MALLOC_CELLS
+    s = malloc (sizeof *s + sizeof (object));
+#else
+    if (posix_memalign ((void **)&s, SLAB_SIZE, SLAB_SIZE) != 0)
+        s = NULL;
+#endif
+    if (s == NULL)
+    {
+        fprintf (stderr, "We've run out of memory!\n");
+        exit (1);
+    }
+    s->used = 0;
+    s->next = slabs;
+    slabs = s;
+}
 
 /* Malloc wrapper for turning tokens into actual objects. Only creates the
- * memory, does not set any values
+ * memory, does not set any values. Runs a collection first if enough objects
+ * have been allocated since the last one (or on every allocation when built
+ * with GC_STRESS, which shakes out missing roots)
  * exits if no more memory can be found
  */
 object*
 alloc_object (void)
 {
     object *obj;
-    obj = (object *)malloc (sizeof *obj);
-    if (obj == NULL)
+#ifdef GC_STRESS
+    gc_collect ();
+#else
+    if (allocs_since_gc + slot_cells_since_gc >= gc_trigger)
+        gc_collect ();
+#endif
+    if (free_cells != NULL)
     {
-        fprintf (stderr, "We've run out of memory!\n");
-        exit (1);
+        obj = free_cells;
+        free_cells = obj->data.pair.cdr;
+    }
+    else
+    {
+        if (slabs == NULL || slabs->used == SLAB_CELLS)
+            new_slab ();
+        obj = &slabs->cells[slabs->used++];
+    }
+    obj->marked = false;
+    heap_size++;
+    allocs_since_gc++;
+    return obj;
+}
+
+/* Frames and code nodes are variable sized, so they are malloc'd as one block
+ * (the object header followed by SIZE slots) and linked on their own list
+ * (SLOTTED) for the sweep. Dead ones of small sizes are kept in SLOTTED_CACHE
+ * for reuse until the next collection. The slots start out unassigned
+ */
+object*
+alloc_slotted (object_t type, long size)
+{
+    object *obj;
+    long i;
+#ifdef GC_STRESS
+    gc_collect ();
+#else
+    if (allocs_since_gc + slot_cells_since_gc >= gc_trigger)
+        gc_collect ();
+#endif
+    if (size < SLOTTED_CACHE_LEN && slotted_cache[size] != NULL)
+    {
+        obj = slotted_cache[size];
+        slotted_cache[size] = obj->data.frame.next;
+    }
+    else
+    {
+        obj = malloc (sizeof *obj + size * sizeof (object *));
+        if (obj == NULL)
+        {
+            fprintf (stderr, "We've run out of memory!\n");
+            exit (1);
+        }
     }
+    obj->type = type;
+    obj->marked = false;
+    obj->data.frame.size = size;
+    obj->data.frame.next = slotted;
+    slotted = obj;
+    for (i = 0; i < size; i++)
+        object_slots (obj)[i] = UNASSIGNED_OBJ;
+    heap_size++;
+    allocs_since_gc++;
+    slot_cells_since_gc += slot_cells (size);
+    return obj;
+}
+
+object*
+make_frame (long size, object *parent)
+{
+    object *obj;
+    size_t roots = gc_save_roots ();
+    gc_root (&parent);
+    obj = alloc_slotted (FRAME, size);
+    gc_restore_roots (roots);
+    obj->data.frame.parent = parent;
     return obj;
 }
 
+/* Registers the address of a C variable as a root, so whatever it points to
+ * at collection time survives. Roots are popped with gc_restore_roots
+ */
+void
+gc_root (object **var)
+{
+    if (roots_len == roots_cap)
+    {
+        roots_cap = roots_cap ? roots_cap * 2 : 256;
+        roots = realloc (roots, roots_cap * sizeof *roots);
+        if (roots == NULL)
+        {
+            fprintf (stderr, "We've run out of memory!\n");
+            exit (1);
+        }
+    }
+    roots[roots_len++] = var;
+}
+
+size_t
+gc_save_roots (void)
+{
+    return roots_len;
+}
+
+void
+gc_restore_roots (size_t saved)
+{
+    roots_len = saved;
+}
+
+void
+gc_set_threshold (size_t threshold)
+{
+    gc_threshold = threshold > 0 ? threshold : 1;
+    gc_trigger = gc_threshold;
+}
+
+size_t
+gc_heap_size (void)
+{
+    return heap_size;
+}
+
+/* The number of objects allocated so far, live or not */
+size_t
+gc_allocations (void)
+{
+    return allocs_total + allocs_since_gc;
+}
+
+static void
+gc_push_mark (object *obj)
+{
+    if (obj == NULL || is_immediate (obj) || obj->marked)
+        return;
+    if (mark_len == mark_cap)
+    {
+        mark_cap = mark_cap ? mark_cap * 2 : 1024;
+        mark_stack = realloc (mark_stack, mark_cap * sizeof *mark_stack);
+        if (mark_stack == NULL)
+        {
+            fprintf (stderr, "We've run out of memory!\n");
+            exit (1);
+        }
+    }
+    mark_stack[mark_len++] = obj;
+}
+
+/* Marks everything reachable from OBJ */
+static void
+gc_mark (object *obj)
+{
+    size_t i;
+    gc_push_mark (obj);
+    while (mark_len > 0)
+    {
+        obj = mark_stack[--mark_len];
+        if (obj->marked)
+            continue;
+        obj->marked = true;
+        switch (obj->type)
+        {
+            case PAIR:
+                gc_push_mark (obj->data.pair.car);
+                gc_push_mark (obj->data.pair.cdr);
+                break;
+            case FRAME:
+                gc_push_mark (obj->data.frame.parent);
+                /* fall through */
+            case NODE:
+            case VECTOR:
+                for (i = 0; i < (size_t)obj->data.frame.size; i++)
+                    gc_push_mark (object_slots (obj)[i]);
+                break;
+            /* only the constants, the bytecode after them isn't objects */
+            case CODE:
+                for (i = 0; i < (size_t)obj->data.code.nconsts; i++)
+                    gc_push_mark (object_slots (obj)[i]);
+                break;
+            case TOPLEVEL:
+                for (i = 0; i < obj->data.toplevel.capacity; i++)
+                    gc_push_mark (obj->data.toplevel.cells[i]);
+                break;
+            case HASHTABLE:
+                mark_hash_table (obj->data.hashtable.table, gc_push_mark);
+                break;
+            case COMPOUND_PROC:
+                gc_push_mark (obj->data.compound_proc.lambda);
+                gc_push_mark (obj->data.compound_proc.env);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/* Releases whatever an unreachable object owns outside its cell */
+static void
+free_object (object *obj)
+{
+    if (obj->type == STRING)
+        free (obj->data.string.value);
+    else if (obj->type == SYMBOL)
+        free (obj->data.symbol.value);
+    else if (obj->type == TOPLEVEL)
+        free (obj->data.toplevel.cells);
+    else if (obj->type == HASHTABLE)
+        free_hash_table (obj->data.hashtable.table);
+    obj->type = FREE_CELL;
+}
+
+/* Marks from the singletons, the symbol table, the global environment, the
+ * argument stack and every registered root, then frees whatever wasn't
+ * reached. The threshold grows with the live heap so collections stay
+ * proportional to the garbage
+ */
+void
+gc_collect (void)
+{
+    slab **link, *s;
+    object **flink, *obj;
+    size_t i;
+
+    gc_mark (t);
+    gc_mark (f);
+    gc_mark (nil);
+    gc_mark (ok);
+    gc_mark (global_env);
+    for (i = 0; i < symbol_table_capacity; i++)
+        if (symbol_table[i].object != NULL)
+            gc_mark (symbol_table[i].object);
+    for (i = 0; i < roots_len; i++)
+        gc_mark (*roots[i]);
+    for (i = 0; arg_stack + i < arg_top; i++)
+        gc_mark (arg_stack[i]);
+
+    /* Sweep slab by slab. Dead cells are threaded onto the free list in
+     * address order, and a slab with nothing live in it (other than the one
+     * being bumped) goes back to the system */
+    heap_size = 0;
+    free_cells = NULL;
+    link = &slabs;
+    while ((s = *link) != NULL)
+    {
+        object *chain = free_cells;
+        size_t live = 0;
+        for (i = s->used; i-- > 0; )
+        {
+            obj = &s->cells[i];
+            if (obj->marked)
+            {
+                obj->marked = false;
+                live++;
+                continue;
+            }
+            if (obj->type != FREE_CELL)
+                free_object (obj);
+            obj->data.pair.cdr = free_cells;
+            free_cells = obj;
+        }
+        if (live == 0 && s != slabs)
+        {
+            free_cells = chain;
+            *link = s->next;
+            free (s);
+            continue;
+        }
+        heap_size += live;
+        link = &s->next;
+    }
+
+    /* Frames and nodes nobody reused since the last collection go back to the
+     * system, this collection's dead ones replace them in the cache */
+    for (i = 0; i < SLOTTED_CACHE_LEN; i++)
+        while ((obj = slotted_cache[i]) != NULL)
+        {
+            slotted_cache[i] = obj->data.frame.next;
+            free (obj);
+        }
+    flink = &slotted;
+    live_slot_cells = 0;
+    while ((obj = *flink) != NULL)
+    {
+        if (obj->marked)
+        {
+            obj->marked = false;
+            heap_size++;
+            live_slot_cells += slot_cells (obj->data.frame.size);
+            flink = &obj->data.frame.next;
+            continue;
+        }
+        *flink = obj->data.frame.next;
+        if (obj->data.frame.size < SLOTTED_CACHE_LEN)
+        {
+            obj->type = FREE_CELL;
+            obj->data.frame.next = slotted_cache[obj->data.frame.size];
+            slotted_cache[obj->data.frame.size] = obj;
+        }
+        else
+            free (obj);
+    }
+    allocs_total += allocs_since_gc;
+    allocs_since_gc = 0;
+    slot_cells_since_gc = 0;
+    gc_trigger = heap_size + live_slot_cells > gc_threshold
+                 ? heap_size + live_slot_cells : gc_threshold;
+}
+
 /* The following functions wrap alloc_object and set the corresponding variables
- * (TYPE and VALUE) to the correct balues
+ * (TYPE and VALUE) to the correct balues. Fixnums, characters and booleans are
+ * immediates, so those just tag the value
  */
 object*
 make_fixnum (long value)
 {
-    object *obj = alloc_object ();
-    obj->type = FIXNUM;
-    obj->data.fixnum.value = value;
-    return obj;
+    return (object *)(((uintptr_t)value << 1) | FIXNUM_TAG);
 }
 
 object*
 make_boolean (bool value)
 {
     if (value)
-        return t;
-    return f;
+        return TRUE_OBJ;
+    return FALSE_OBJ;
 } 
 
 object*
 make_character (char value)
+{
+    return (object *)(((uintptr_t)(unsigned char)value << 3) | CHAR_TAG);
+}
+
+object*
+make_flonum (double value)
 {
     object *obj = alloc_object ();
-    obj->type = CHARACTER;
-    obj->data.character.value = value;
+    obj->type = FLONUM;
+    obj->data.flonum.value = value;
     return obj;
 }
 
 object*
 make_string (char* value)
 {
-    object *obj = alloc_object ();
-    obj->type = STRING;
-    obj->data.string.value = (char*) malloc(strlen(value)+1);
-    if (obj->data.string.value == NULL)
+    return make_string_len (value, strlen (value));
+}
+
+/* Makes a string of the LENGTH characters at VALUE */
+object*
+make_string_len (const char *value, size_t length)
+{
+    char *chars = malloc (length + 1);
+    if (chars == NULL)
     {
         fprintf (stderr, "no more memory");
         exit (1);
     }
-    strcpy (obj->data.string.value, value);
+    memcpy (chars, value, length);
+    chars[length] = '\0';
+    return adopt_string (chars, length, length + 1);
+}
+
+/* Makes a string that takes over CHARS, a malloc'd block of CAPACITY bytes
+ * holding LENGTH characters and a null */
+object*
+adopt_string (char *chars, size_t length, size_t capacity)
+{
+    object *obj = alloc_object ();
+    obj->type = STRING;
+    obj->data.string.value = chars;
+    obj->data.string.length = length;
+    obj->data.string.capacity = capacity;
     return obj;
 }
 
+/* ARITY is the number of arguments FUN takes, or VARIADIC (N) for N or
+ * more, see apply_primitive */
 object*
-make_primitive_proc (object *(*fun)(struct object *arguments))
+make_primitive_proc (object *(*fun)(long argc, struct object **argv),
+                     long arity)
 {
     object *obj;
 
     obj = alloc_object();
     obj->type = PRIM_PROC;
     obj->data.prim_proc.fun = fun;
+    obj->data.prim_proc.arity = arity;
     return obj;
 }
 
+/* LAMBDA is the analyzed lambda node, which knows the frame size and holds
+ * the body */
 object*
-make_compound_proc (object *params, object *body, object *env)
+make_compound_proc (object *lambda, object *env)
 {
-    object *obj = alloc_object ();
+    object *obj;
+    size_t roots = gc_save_roots ();
+    gc_root (&lambda);
+    gc_root (&env);
+    obj = alloc_object ();
+    gc_restore_roots (roots);
     obj->type = COMPOUND_PROC;
-    obj->data.compound_proc.parameters = params;
-    obj->data.compound_proc.body = body;
+    obj->data.compound_proc.lambda = lambda;
     obj->data.compound_proc.env = env;
     return obj;
 }
@@ -94,140 +519,206 @@ make_compound_proc (object *params, object *body, object *env)
  */
 
 object*
-is_null_proc (object *arguments)
+is_null_proc (long argc, object **argv)
+{
+    return type_of (argv[0]) == NIL ? t : f;
+}
+
+object* 
+is_boolean_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == NIL ? t : f;
+    return type_of (argv[0]) == BOOLEAN ? t : f;
 }
 
 object* 
-is_boolean_proc (object *arguments)
+is_symbol_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == BOOLEAN ? t : f;
+    return type_of (argv[0]) == SYMBOL ? t : f;
 }
 
 object* 
-is_symbol_proc (object *arguments)
+is_integer_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == SYMBOL ? t : f;
+    return is_integer (argv[0]) ? t : f;
 }
 
 object* 
-is_integer_proc (object *arguments)
+is_number_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == FIXNUM ? t : f;
+    return is_number (argv[0]) ? t : f;
 }
 
 object*
-is_char_proc (object *arguments)
+is_char_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == CHARACTER ? t : f;
+    return type_of (argv[0]) == CHARACTER ? t : f;
 }
 
 object*
-is_string_proc (object *arguments)
+is_string_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == STRING ? t : f;
+    return type_of (argv[0]) == STRING ? t : f;
 }
 
 object*
-is_pair_proc (object *arguments)
+is_pair_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == PAIR ? t : f;
+    return type_of (argv[0]) == PAIR ? t : f;
 }
 
 object*
-is_procedure_proc (object *arguments)
+is_procedure_proc (long argc, object **argv)
 {
-    return (car(arguments))->type == PRIM_PROC ? t : f;
+    return type_of (argv[0]) == PRIM_PROC ? t : f;
 }
 
 object*
-char_to_integer_proc (object *arguments)
+char_to_integer_proc (long argc, object **argv)
 {
-    return make_fixnum((car(arguments))->data.character.value);
+    return make_fixnum(char_value (argv[0]));
 }
 
 object*
-integer_to_char_proc (object *arguments)
+integer_to_char_proc (long argc, object **argv)
 {
-    return make_character((car(arguments))->data.fixnum.value);
+    return make_character(fixnum_value (argv[0]));
 }
 
 object*
-number_to_string_proc (object *arguments)
+number_to_string_proc (long argc, object **argv)
 {
     char buffer[100];
+    char *digits;
 
-    sprintf(buffer, "%ld", (car(arguments))->data.fixnum.value);
-    return make_string(buffer);
+    if (is_fixnum (argv[0]))
+    {
+        sprintf(buffer, "%ld", fixnum_value (argv[0]));
+        return make_string(buffer);
+    }
+    digits = number_to_string (argv[0]);
+    return adopt_string (digits, strlen (digits), strlen (digits) + 1);
 }
 
 object*
-string_to_number_proc (object *arguments)
+string_to_number_proc (long argc, object **argv)
 {
-    return make_fixnum(atoi((car(arguments))->data.string.value));
+    char *s = argv[0]->data.string.value, *end;
+    double d;
+    object *num = string_to_integer (s);
+
+    if (num != NULL)
+        return num;
+    d = strtod (s, &end);
+    return *s != '\0' && *end == '\0' ? make_flonum (d) : f;
 }
 
 object*
-symbol_to_string_proc (object *arguments)
+exact_to_inexact_proc (long argc, object **argv)
 {
-    return make_string((car(arguments))->data.symbol.value);
+    if (type_of (argv[0]) == FLONUM)
+        return argv[0];
+    return make_flonum (number_to_double (argv[0]));
 }
 
 object*
-string_to_symbol_proc (object *arguments)
+inexact_to_exact_proc (long argc, object **argv)
 {
-    return make_symbol((car(arguments))->data.string.value);
+    object *num;
+
+    if (type_of (argv[0]) != FLONUM)
+        return argv[0];
+    num = double_to_integer (flonum_value (argv[0]));
+    if (num == NULL)
+    {
+        fprintf (stderr, "inexact->exact needs an integral flonum\n");
+        exit (1);
+    }
+    return num;
 }
 
 object*
-sub_proc (object *arguments)
+symbol_to_string_proc (long argc, object **argv)
 {
-    long result;
-    
-    result = (car(arguments))->data.fixnum.value;
-    while ((arguments = cdr(arguments))->type != NIL) {
-        result -= (car(arguments))->data.fixnum.value;
+    return make_string_len (argv[0]->data.symbol.value,
+                            argv[0]->data.symbol.length);
+}
+
+object*
+string_to_symbol_proc (long argc, object **argv)
+{
+    return intern (argv[0]->data.string.value, argv[0]->data.string.length);
+}
+
+/* The arithmetic procedures fold over number_* from number.c, which only
+ * allocate their result once they're done with the operands, so the partial
+ * results need no rooting */
+object*
+sub_proc (long argc, object **argv)
+{
+    long i;
+    object *result;
+
+    if (argc == 1)
+        return number_sub (make_fixnum (0), argv[0]);
+    result = argv[0];
+    for (i = 1; i < argc; i++) {
+        result = number_sub (result, argv[i]);
     }
-    return make_fixnum(result);
+    return result;
 }
 
 object*
-mul_proc (object *arguments)
+mul_proc (long argc, object **argv)
 {
-    long result = 1;
-    
-    while (!(arguments->type == NIL)) {
-        result *= (car(arguments))->data.fixnum.value;
-        arguments = cdr(arguments);
+    long i;
+    object *result = make_fixnum (1);
+
+    for (i = 0; i < argc; i++) {
+        result = number_mul (result, argv[i]);
     }
-    return make_fixnum(result);
+    return result;
 }
 
+/* Unlike the others number_divide allocates (the remainder that decides
+ * whether the division is exact) before it is done with its dividend, so the
+ * partial quotient is rooted */
 object*
-quotient_proc (object *arguments)
+divide_proc (long argc, object **argv)
 {
-    return make_fixnum(
-        ((car(arguments) )->data.fixnum.value)/
-        ((cadr(arguments))->data.fixnum.value));
+    long i;
+    object *result;
+    size_t roots;
+
+    if (argc == 1)
+        return number_divide (make_fixnum (1), argv[0]);
+    result = argv[0];
+    roots = gc_save_roots ();
+    gc_root (&result);
+    for (i = 1; i < argc; i++)
+        result = number_divide (result, argv[i]);
+    gc_restore_roots (roots);
+    return result;
 }
 
 object*
-remainder_proc (object *arguments)
+quotient_proc (long argc, object **argv)
 {
-    return make_fixnum(
-        ((car(arguments) )->data.fixnum.value)%
-        ((cadr(arguments))->data.fixnum.value));
+    return integer_quotient (argv[0], argv[1]);
 }
 
 object*
-is_number_equal_proc (object *arguments)
+remainder_proc (long argc, object **argv)
 {
-    long value;
-    
-    value = (car(arguments))->data.fixnum.value;
-    while (!(arguments = cdr(arguments))->type == NIL) {
-        if (value != ((car(arguments))->data.fixnum.value)) {
+    return integer_remainder (argv[0], argv[1]);
+}
+
+object*
+is_number_equal_proc (long argc, object **argv)
+{
+    long i;
+
+    for (i = 1; i < argc; i++) {
+        if (number_compare (argv[0], argv[i]) != 0) {
             return f;
         }
     }
@@ -235,18 +726,12 @@ is_number_equal_proc (object *arguments)
 }
 
 object*
-is_less_than_proc (object *arguments)
+is_less_than_proc (long argc, object **argv)
 {
-    long previous;
-    long next;
+    long i;
     
-    previous = (car(arguments))->data.fixnum.value;
-    while ((arguments = cdr(arguments))->type != NIL) {
-        next = (car(arguments))->data.fixnum.value;
-        if (previous < next) {
-            previous = next;
-        }
-        else {
+    for (i = 1; i < argc; i++) {
+        if (number_compare (argv[i - 1], argv[i]) >= 0) {
             return f;
         }
     }
@@ -254,123 +739,271 @@ is_less_than_proc (object *arguments)
 }
 
 object*
-is_greater_than_proc (object *arguments)
+is_greater_than_proc (long argc, object **argv)
 {
-    long previous;
-    long next;
+    long i;
     
-    previous = (car(arguments))->data.fixnum.value;
-    while ((arguments = cdr(arguments))->type != NIL) {
-        next = (car(arguments))->data.fixnum.value;
-        if (previous > next) {
-            previous = next;
-        }
-        else {
+    for (i = 1; i < argc; i++) {
+        /* flipped rather than <= 0, which an UNORDERED NaN would pass */
+        if (number_compare (argv[i], argv[i - 1]) >= 0) {
             return f;
         }
     }
     return t;
 }
 
-/*
- * Extracts the arguments of a variable arity function call
- * returns them in a list
- */
+
 object*
-list_of_values(object *exps, object *env)
+cons_proc (long argc, object **argv)
 {
-    if (exps->type == NIL) {
-        return nil;
+    return cons(argv[0], argv[1]);
+}
+
+object*
+car_proc (long argc, object **argv)
+{
+    return car(argv[0]);
+}
+
+object*
+cdr_proc (long argc, object **argv)
+{
+    return cdr(argv[0]);
+}
+
+object*
+set_car_proc (long argc, object **argv)
+{
+    set_car(argv[0], argv[1]);
+    return ok;
+}
+
+object*
+set_cdr_proc(long argc, object **argv)
+{
+    set_cdr(argv[0], argv[1]);
+    return ok;
+}
+
+/* Vectors are slotted objects with an element per slot, so indexing one is
+ * a bounds check and a load */
+object*
+make_vector (long size, object *fill)
+{
+    object *vec;
+    long i;
+    size_t roots = gc_save_roots ();
+    gc_root (&fill);
+    vec = alloc_slotted (VECTOR, size);
+    gc_restore_roots (roots);
+    for (i = 0; i < size; i++)
+        vector_elements (vec)[i] = fill;
+    return vec;
+}
+
+object*
+list_to_vector (object *list)
+{
+    object *vec, **elements;
+    size_t roots = gc_save_roots ();
+    gc_root (&list);
+    vec = alloc_slotted (VECTOR, list_length (list));
+    gc_restore_roots (roots);
+    for (elements = vector_elements (vec); type_of (list) == PAIR;
+         list = cdr (list))
+        *elements++ = car (list);
+    return vec;
+}
+
+static object*
+check_vector (object *obj)
+{
+    if (type_of (obj) != VECTOR)
+    {
+        fprintf (stderr, "expected a vector\n");
+        exit (1);
     }
-    else 
+    return obj;
+}
+
+static long
+vector_index (object *vec, object *k)
+{
+    check_vector (vec);
+    if (!is_fixnum (k) || fixnum_value (k) < 0
+            || fixnum_value (k) >= vec->data.vector.size)
     {
-        return cons(eval(car (exps), env),
-                    list_of_values(cdr (exps), env));
+        fprintf (stderr, "vector index out of range\n");
+        exit (1);
     }
+    return fixnum_value (k);
+}
+
+/* the arguments are on the argument stack, so they stay rooted while the
+ * list is consed up from the back */
+object*
+list_proc(long argc, object **argv)
+{
+    object *list = nil;
+    size_t roots = gc_save_roots ();
+    gc_root (&list);
+    while (argc > 0)
+        list = cons(argv[--argc], list);
+    gc_restore_roots (roots);
+    return list;
 }
 
+object*
+is_vector_proc (long argc, object **argv)
+{
+    return type_of (argv[0]) == VECTOR ? t : f;
+}
 
 object*
-cons_proc (object *arguments)
+make_vector_proc (long argc, object **argv)
 {
-    return cons(car(arguments), cadr(arguments));
+    if (!is_fixnum (argv[0]) || fixnum_value (argv[0]) < 0)
+    {
+        fprintf (stderr, "expected a vector length\n");
+        exit (1);
+    }
+    return make_vector (fixnum_value (argv[0]),
+                        argc > 1 ? argv[1] : make_fixnum (0));
 }
 
 object*
-car_proc (object *arguments)
+vector_proc (long argc, object **argv)
 {
-    return caar(arguments);
+    object *vec = make_vector (argc, nil);
+    memcpy (vector_elements (vec), argv, argc * sizeof *argv);
+    return vec;
 }
 
 object*
-cdr_proc (object *arguments)
+vector_length_proc (long argc, object **argv)
 {
-    return cdar(arguments);
+    return make_fixnum (check_vector (argv[0])->data.vector.size);
 }
 
 object*
-set_car_proc (object *arguments)
+vector_ref_proc (long argc, object **argv)
 {
-    set_car(car(arguments), cadr(arguments));
-    return ok;
+    return vector_elements (argv[0])[vector_index (argv[0], argv[1])];
 }
 
 object*
-set_cdr_proc(object *arguments)
+vector_set_proc (long argc, object **argv)
 {
-    set_cdr(car(arguments), cadr(arguments));
+    vector_elements (argv[0])[vector_index (argv[0], argv[1])] = argv[2];
     return ok;
 }
 
+/* the vector is on the argument stack, so it stays rooted while the list is
+ * consed up from the back */
 object*
-list_proc(object *arguments)
+vector_to_list_proc (long argc, object **argv)
 {
-    return arguments;
+    object *vec = check_vector (argv[0]), *list = nil;
+    long i = vec->data.vector.size;
+    size_t roots = gc_save_roots ();
+    gc_root (&list);
+    while (i-- > 0)
+        list = cons (vector_elements (vec)[i], list);
+    gc_restore_roots (roots);
+    return list;
 }
 
 object*
-is_eq_proc (object *arguments)
+list_to_vector_proc (long argc, object **argv)
 {
-    object *obj1;
-    object *obj2;
-    
-    obj1 = car(arguments);
-    obj2 = cadr(arguments);
-    
-    if (obj1->type != obj2->type) {
-        return f;
+    return list_to_vector (argv[0]);
+}
+
+/* eq? compares strings and numbers by value, so it doubles as eqv? */
+bool
+is_eq (object *obj1, object *obj2)
+{
+    /* immediates (fixnums, characters, booleans and ()) are equal exactly
+     * when their words are */
+    if (obj1 == obj2) {
+        return true;
+    }
+    if (is_immediate (obj1) || is_immediate (obj2) 
+            || obj1->type != obj2->type) {
+        return false;
     }
     switch (obj1->type) {
-        case FIXNUM:
-            return (obj1->data.fixnum.value == 
-                    obj2->data.fixnum.value) ?
-                        t : f;
-            break;
-        case CHARACTER:
-            return (obj1->data.character.value == 
-                    obj2->data.character.value) ?
-                        t : f;
-            break;
         case STRING:
-            return (strcmp(obj1->data.string.value, 
-                           obj2->data.string.value) == 0) ?
-                        t : f;
-            break;
+            return obj1->data.string.length == obj2->data.string.length
+                   && memcmp (obj1->data.string.value, obj2->data.string.value,
+                              obj1->data.string.length) == 0;
+        case BIGNUM:
+            return integer_compare (obj1, obj2) == 0;
+        case FLONUM:
+            return flonum_value (obj1) == flonum_value (obj2);
         default:
-            return (obj1 == obj2) ? t: f;
+            return false;
     }
 }
 
-object*
-add_proc (object *arg)
+/* Structural equality, descending into pairs and vectors */
+bool
+is_equal (object *obj1, object *obj2)
 {
-    long result = 0;
-    while (arg->type != NIL)
+    long i;
+
+    while (!is_eq (obj1, obj2))
     {
-        result += (car (arg))->data.fixnum.value;
-        arg = cdr (arg);
+        if (type_of (obj1) != type_of (obj2))
+            return false;
+        switch (type_of (obj1))
+        {
+            case PAIR:
+                if (!is_equal (car (obj1), car (obj2)))
+                    return false;
+                obj1 = cdr (obj1);
+                obj2 = cdr (obj2);
+                break;
+            case VECTOR:
+                if (obj1->data.vector.size != obj2->data.vector.size)
+                    return false;
+                for (i = 0; i < obj1->data.vector.size; i++)
+                    if (!is_equal (vector_elements (obj1)[i],
+                                   vector_elements (obj2)[i]))
+                        return false;
+                return true;
+            case F64VECTOR:
+            case S64VECTOR:
+                return obj1->data.numvec.length == obj2->data.numvec.length
+                       && memcmp (object_slots (obj1), object_slots (obj2),
+                                  obj1->data.numvec.length * 8) == 0;
+            default:
+                return false;
+        }
     }
-    return make_fixnum (result);
+    return true;
+}
+
+object*
+is_eq_proc (long argc, object **argv)
+{
+    return is_eq (argv[0], argv[1]) ? t : f;
+}
+
+object*
+is_equal_proc (long argc, object **argv)
+{
+    return is_equal (argv[0], argv[1]) ? t : f;
+}
+
+object*
+add_proc (long argc, object **argv)
+{
+    long i;
+    object *result = make_fixnum (0);
+    for (i = 0; i < argc; i++)
+        result = number_add (result, argv[i]);
+    return result;
 }
 
 /*
@@ -379,30 +1012,35 @@ add_proc (object *arg)
  */
 
 object*
-curr_env_proc (object *arg)
+curr_env_proc (long argc, object **argv)
 {
     return global_env;
 }
 
 object*
-new_env_proc (object *arg)
+new_env_proc (long argc, object **argv)
 {
     return setup_env();
 }
 
 object*
-toplevel_env_proc (object *arg)
+toplevel_env_proc (long argc, object **argv)
 {
     return make_env ();
 }
 
 /* The followng 3 functions implement the cons, car, and cdr list operator for
- * lists and pairs
+ * lists and pairs. cons roots its arguments itself so callers can nest it
  */
 object*
 cons (object *car, object *cdr)
 {
-    object *obj = alloc_object ();
+    object *obj;
+    size_t roots = gc_save_roots ();
+    gc_root (&car);
+    gc_root (&cdr);
+    obj = alloc_object ();
+    gc_restore_roots (roots);
     obj->type = PAIR;
     obj->data.pair.car = car;
     obj->data.pair.cdr = cdr;
@@ -412,7 +1050,7 @@ cons (object *car, object *cdr)
 object*
 car (object *pair)
 {
-    if (pair->type != PAIR)
+    if (type_of (pair) != PAIR)
     {
         fprintf (stderr, "Object is not a list\n");
         exit (1);
@@ -428,7 +1066,7 @@ set_car (object *obj, object* value) {
 object*
 cdr (object *pair)
 {
-    if (pair->type != PAIR)
+    if (type_of (pair) != PAIR)
     {
         fprintf (stderr, "Object is not a list\n");
         exit (1);
@@ -462,79 +1100,125 @@ bool is_symbol_start (int c)
              c == '<' || c == '=' || c == '?' || c == '!';
 }
 
-/* checks the next character in the input stream without removing it from the
- * stream
+/* Input is parsed from a byte buffer through a cursor instead of a getc at a
+ * time. A reader over memory sees all of its input at once, a reader over a
+ * FILE reads it in READ_CHUNK_LEN blocks as the cursor reaches the end of
+ * what it has, keeping the bytes not yet consumed
  */
-int 
-peek (FILE *in)
-{
-    int value;
-    value = getc (in);
-    ungetc (value, in);
-    return value;
-}
 
-/* removes whitespace, used to ignore whitespace at the beginning of input and
- * in pairs
+/* The reader read parses its FILE with */
+static reader file_reader;
+
+/* Where a symbol is spelled out as it's read, for intern */
+static char *symbol_chars;
+static size_t symbol_cap;
+
+/* Moves the unconsumed bytes of R to the front of its buffer and reads more
+ * of its file after them. Returns false if there was no more input
  */
-void 
-rem_whitespace (FILE *in)
+static bool
+fill_reader (reader *r)
 {
-    int c;
+    size_t unread = r->end - r->pos, n;
 
-    while ((c = getc (in)) != EOF)
+    if (r->file == NULL)
+        return false;
+    if (unread > 0)
+        memmove (r->buf, r->pos, unread);
+    if (r->cap - unread < READ_CHUNK_LEN)
     {
-        if (isspace (c))
-            continue;
-        else if (c == ';')
+        r->cap = r->cap * 2 > unread + READ_CHUNK_LEN ? r->cap * 2
+                 : unread + READ_CHUNK_LEN;
+        r->buf = realloc (r->buf, r->cap);
+        if (r->buf == NULL)
         {
-            while ((c = getc(in)) != EOF && c != '\n');
+            fprintf (stderr, "no more memory");
+            exit (1);
+        }
+    }
+    /* stdin is taken a line at a time so the REPL answers each line as it's
+     * typed instead of waiting for a whole chunk */
+    if (r->file == stdin)
+        n = fgets (r->buf + unread, r->cap - unread, stdin) == NULL ? 0
+            : strlen (r->buf + unread);
+    else
+        n = fread (r->buf + unread, 1, r->cap - unread, r->file);
+    r->pos = r->buf;
+    r->end = r->buf + unread + n;
+    r->offset = ftell (r->file);
+    return n > 0;
+}
+
+/* checks the next character in the input without consuming it, EOF if there
+ * is none
+ */
+int 
+peek_char (reader *r)
+{
+    if (r->pos == r->end && !fill_reader (r))
+        return EOF;
+    return (unsigned char)*r->pos;
+}
+
+/* consumes and returns the next character in the input, EOF if there is none
+ */
+int
+next_char (reader *r)
+{
+    if (r->pos == r->end && !fill_reader (r))
+        return EOF;
+    return (unsigned char)*r->pos++;
+}
 
+/* removes whitespace, used to ignore whitespace at the beginning of input and
+ * in pairs. Runs of whitespace and comments are skipped a vector at a time
+ */
+void 
+skip_whitespace (reader *r)
+{
+    const char *newline;
+
+    while (r->pos < r->end || fill_reader (r))
+    {
+        r->pos = scan_whitespace (r->pos, r->end);
+        if (r->pos == r->end)
             continue;
+        if (*r->pos != ';')
+            return;
+        while ((newline = memchr (r->pos, '\n', r->end - r->pos)) == NULL)
+        {
+            r->pos = r->end;
+            if (!fill_reader (r))
+                return;
         }
-        ungetc (c, in);
-        break;
+        r->pos = newline + 1;
     }
 }
 
-/* Retursn whether or not the next characters in input match INPUT. If they do,
- * those characters are removed from the stream, and if not, they are put back
- * (the stream doesn't change if the function returns false
+/* Returns whether or not the next characters in input match INPUT. If they
+ * do, those characters are consumed, and if not the input doesn't change
  */
 bool
-is_next_input (FILE *in, char *input)
-{
-   int input_len = strlen (input);
-   char buf[input_len];
-   int i = 0;
-
-   while ((buf[i] = getc (in)) != EOF && *input != '\0')
-   {
-       if(buf[i] != *input)
-       {
-           break;
-       }
-       i++;
-       input++;
-   }
-   if(*input == '\0')
-       return true;
-   while(i >= 0)
-   {
-       ungetc (buf[i], in);
-       i--;
-   }
-   return false;
+is_next_input (reader *r, char *input)
+{
+    size_t input_len = strlen (input);
+
+    while ((size_t)(r->end - r->pos) < input_len && fill_reader (r));
+    if ((size_t)(r->end - r->pos) < input_len
+        || memcmp (r->pos, input, input_len) != 0)
+        return false;
+    r->pos += input_len;
+    return true;
 }
     
 /* Reads a scheme character (delimited with #\), used for tokenization of all
  * character literals
  */
 char
-read_character (FILE *in)
+read_character (reader *r)
 {
     int c;
-    c = getc (in);
+    c = next_char (r);
     if (c == EOF || c == '\n')
     {
         fprintf (stderr, "Premature EOF\n");
@@ -542,12 +1226,12 @@ read_character (FILE *in)
     }
     /* This conditional detects the special scheme newline and space characters
      * */
-    if (c == 's' && is_next_input (in, "pace"))
+    if (c == 's' && is_next_input (r, "pace"))
         return ' ';
-    else if (c == 'n' && is_next_input (in, "ewline"))
+    else if (c == 'n' && is_next_input (r, "ewline"))
         return '\n';
 
-    if (!is_delimiter (peek (in)))
+    if (!is_delimiter (peek_char (r)))
     {
         fprintf (stderr, "No delimiter\n");
         exit (1);
@@ -555,24 +1239,55 @@ read_character (FILE *in)
     return c;
 }
 
-/* tokenizes string literals */
-void
-read_string (FILE* in, char* buf)
+/* Appends the N bytes at P to *BUF, a malloc'd block of *CAP bytes holding
+ * *LEN of them, growing it so there's always room for a null after them
+ */
+static void
+append_bytes (char **buf, size_t *len, size_t *cap, const char *p, size_t n)
+{
+    if (*len + n >= *cap)
+    {
+        while (*len + n >= *cap)
+            *cap = *cap == 0 ? 32 : *cap * 2;
+        *buf = realloc (*buf, *cap);
+        if (*buf == NULL)
+        {
+            fprintf (stderr, "no more memory");
+            exit (1);
+        }
+    }
+    memcpy (*buf + *len, p, n);
+    *len += n;
+}
+
+/* tokenizes string literals straight into the storage of the new string,
+ * copying the runs between escapes in bulk */
+object*
+read_string (reader *r)
 {
     int c;
-    int i = 0;
-    while ((c = getc (in)) != EOF && i < MAX_STRING_LEN)
+    char *chars = NULL, escaped;
+    size_t length = 0, capacity = 0;
+    const char *stop;
+    while (1)
     {
+        stop = scan_string (r->pos, r->end);
+        append_bytes (&chars, &length, &capacity, r->pos, stop - r->pos);
+        r->pos = stop;
+        if ((c = next_char (r)) == EOF)
+            break;
        if (c == '"')
         {
-            buf[i++] = '\0';
-            return;
+            chars[length] = '\0';
+            return adopt_string (chars, length, capacity);
         }
 
        if (c == '\\')
         {
-            c = getc (in);
-            if (c == 'n')
+            c = next_char (r);
+            if (c == EOF)
+                break;
+            else if (c == 'n')
                 c = '\n';
             else if (c == '"')
                 c = '"';
@@ -583,73 +1298,146 @@ read_string (FILE* in, char* buf)
             else if (c == 'a')
                 c = '\a';
         }
-        buf[i++] = c;
+        escaped = c;
+        append_bytes (&chars, &length, &capacity, &escaped, 1);
     }
-    fprintf (stderr, "Reached EOF or exceeded string max limit\n");
+    fprintf (stderr, "Reached EOF inside a string\n");
     exit (1);
 }
 
-/* Reads lists and improper lists (pairs) of arbitrary length and composition.
- * Used to tokenize lists, mutually recursive with the read function
+/* What a level of the reader's stack is building, kept as a fixnum in the car
+ * of the level's sentinel pair. A DOTTED list is waiting for the datum after
+ * its dot, and a FINISHED one for the close paren after that */
+enum { LIST_LEVEL, VECTOR_LEVEL, QUOTE_LEVEL, DOTTED_LEVEL, FINISHED_LEVEL };
+
+#define level_kind(level) fixnum_value (caar (level))
+#define set_level_kind(level, kind) set_car (car (level), make_fixnum (kind))
+
+/* Pushes a level of KIND onto *STACK. A level is a (sentinel . tail) pair,
+ * the datum read so far hangs off the sentinel and TAIL is its last pair.
+ * Levels popped onto *SPARE are used again before any new ones are made
+ */
+static void
+push_level (object **stack, object **spare, int kind)
+{
+    object *cell = *spare;
+
+    if (cell == nil)
+    {
+        cell = cons (make_fixnum (kind), nil);
+        cell = cons (cons (cell, cell), *stack);
+    }
+    else
+    {
+        *spare = cdr (cell);
+        set_car (caar (cell), make_fixnum (kind));
+        set_cdr (caar (cell), nil);
+        set_cdr (car (cell), caar (cell));
+        set_cdr (cell, *stack);
+    }
+    *stack = cell;
+}
+
+/* Pops the top level of *STACK onto *SPARE */
+static void
+pop_level (object **stack, object **spare)
+{
+    object *cell = *stack;
+    *stack = cdr (cell);
+    set_cdr (cell, *spare);
+    *spare = cell;
+}
+
+/* Reads the rest of a number whose first character (a digit or a minus
+ * sign) was C. Digits accumulate in NUM while it is sure to stay a fixnum,
+ * longer numbers and ones with a point or an exponent are collected as text
+ * for string_to_integer or strtod
  */
 object*
-read_pair (FILE* in)
+read_number (reader *r, int c)
 {
-    int c;
-    object *car;
-    object *cdr;
+    int sign = 1;
+    long num = 0;
+    char *text = NULL, *end;
+    size_t len = 0, cap = 0;
+    bool flonum = false;
+    object *obj;
 
-    rem_whitespace (in);
-    
-    if ((c = getc (in)) == ')')
-        return nil;
-    ungetc (c, in);
-    car = read (in);
+    if (c == '-')
+        sign = -1;
+    else
+        num = c - '0';
 
-    rem_whitespace (in);
-    c = getc (in);
-    if (c == '.')
+    while (1)
     {
-        if (!is_delimiter (peek (in)))
+        c = peek_char (r);
+        if (isdigit (c) && text == NULL && num <= (FIXNUM_MAX - 9) / 10)
+        {
+            num = (num * 10) + (c - '0');
+            r->pos++;
+            continue;
+        }
+        if (c == '.' || c == 'e' || c == 'E')
+            flonum = true;
+        else if (!isdigit (c) && !(flonum && (c == '+' || c == '-')
+                                   && (text[len - 1] | 0x20) == 'e'))
+            break;
+        if (text == NULL)
         {
-            fprintf (stderr, "need a delimiter after dot op\n");
+            cap = 64;
+            text = malloc (cap);
+            len = text == NULL ? 0
+                  : sprintf (text, "%s%ld", sign < 0 ? "-" : "", num);
+        }
+        else if (len + 2 > cap)
+            text = realloc (text, cap *= 2);
+        if (text == NULL)
+        {
+            fprintf (stderr, "no more memory");
             exit (1);
         }
-        cdr = read (in);
-        rem_whitespace (in);
-        if ((c = getc (in)) != ')')
+        text[len++] = c;
+        r->pos++;
+    }
+    if (!is_delimiter (c))
+    {
+        fprintf(stderr, "You need to end a number with a delimiter\n");
+        exit (1);
+    }
+    if (text == NULL)
+        return make_fixnum (sign * num);
+    text[len] = '\0';
+    if (flonum)
+    {
+        obj = make_flonum (strtod (text, &end));
+        if (*end != '\0')
         {
-            fprintf (stderr, "unmatched parenthesis\n");
+            fprintf (stderr, "%s is not a number\n", text);
             exit (1);
         }
-        return cons (car, cdr);
     }
-        
-    ungetc (c, in);
-    cdr = read_pair (in);
-    return cons (car, cdr);
+    else
+        obj = string_to_integer (text);
+    free (text);
+    return obj;
 }
 
-/* Tokenizer function that calls case specific tokenizers and handles errors */
+/* Tokenizer function for everything but lists, vectors and quotes, whose
+ * first character C has been consumed. Calls case specific tokenizers and
+ * handles errors
+ */
 object*
-read (FILE *in)
+read_atom (reader *r, int c)
 {
-    int c;
-    int sign = 1;
-    long num = 0;
-
-    rem_whitespace (in);
-    c = getc (in);
-    
     if (c == '#')
     {
-        c = getc (in);
+        c = next_char (r);
         if (c == 't')
             return t;
         else if (c == 'f')
             return f;
         else if (c == '\\')
-            return make_character (read_character (in));
+            return make_character (read_character (r));
         else
         {
             fprintf (stderr, "Unknown boolean literal %c\n", c);
@@ -657,267 +1445,1822 @@ read (FILE *in)
         }
     }
 
-    else if (c == '"')
-    {
-        char buf[MAX_STRING_LEN];
-        read_string (in, buf);
-        return make_string (buf);
-    }
+    else if (c == '"')
+        return read_string (r);
+
+    else if (isdigit (c) || (c == '-' && isdigit (peek_char (r))))
+        return read_number (r, c);
+    else if (is_symbol_start (c) || ((c == '+' || c == '-') 
+             && is_delimiter (peek_char (r))))
+    {
+        size_t len = 0;
+        const char *stop;
+        char first = c;
+        append_bytes (&symbol_chars, &len, &symbol_cap, &first, 1);
+        do
+        {
+            stop = scan_symbol (r->pos, r->end);
+            append_bytes (&symbol_chars, &len, &symbol_cap, r->pos,
+                          stop - r->pos);
+            r->pos = stop;
+        }
+        while (r->pos == r->end && fill_reader (r));
+        if (is_delimiter (peek_char (r)))
+            return intern (symbol_chars, len);
+        else
+        {
+            fprintf (stderr, "need to end symbol with delimiter\n");
+            exit (1);
+        }
+    }
+    else
+    {
+        fprintf (stderr, "Bad input, unexpected %c\n", c);
+        exit (1);
+    }
+
+    fprintf (stderr, "read illegal state\n");
+    exit (1);
+}
+
+/* Reads the next datum, or returns NULL once the input runs out. Lists are
+ * built front to back through a tail pointer and the lists, vectors and
+ * quotes still open are kept on a stack in the heap, so the C stack stays
+ * the same however long or deeply nested the datum is
+ */
+object*
+read_datum (reader *r)
+{
+    int c;
+    object *stack = nil, *spare = nil, *obj = NULL, *level;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&stack);
+    gc_root (&spare);
+    gc_root (&obj);
+    while (1)
+    {
+        skip_whitespace (r);
+        c = next_char (r);
+        if (c == '(')
+        {
+            push_level (&stack, &spare, LIST_LEVEL);
+            continue;
+        }
+        else if (c == '#' && peek_char (r) == '(')
+        {
+            r->pos++;
+            push_level (&stack, &spare, VECTOR_LEVEL);
+            continue;
+        }
+        else if (c == '\'')
+        {
+            push_level (&stack, &spare, QUOTE_LEVEL);
+            continue;
+        }
+        else if (c == '.' && stack != nil && is_delimiter (peek_char (r))
+                 && level_kind (car (stack)) == LIST_LEVEL)
+        {
+            if (cdr (car (stack)) == car (car (stack)))
+            {
+                fprintf (stderr, "need a datum before the dot op\n");
+                exit (1);
+            }
+            set_level_kind (car (stack), DOTTED_LEVEL);
+            continue;
+        }
+        else if (c == ')')
+        {
+            if (stack == nil || level_kind (car (stack)) == QUOTE_LEVEL
+                || level_kind (car (stack)) == DOTTED_LEVEL)
+            {
+                fprintf (stderr, "unmatched parenthesis\n");
+                exit (1);
+            }
+            obj = cdr (car (car (stack)));
+            if (level_kind (car (stack)) == VECTOR_LEVEL)
+                obj = list_to_vector (obj);
+            pop_level (&stack, &spare);
+        }
+        else if (c == EOF)
+        {
+            if (stack != nil)
+            {
+                fprintf (stderr, "Premature EOF\n");
+                exit (1);
+            }
+            gc_restore_roots (roots);
+            return NULL;
+        }
+        else
+            obj = read_atom (r, c);
+
+        /* OBJ is complete, hand it to the levels waiting on it */
+        while (stack != nil && level_kind (car (stack)) == QUOTE_LEVEL)
+        {
+            obj = cons (quote, cons (obj, nil));
+            pop_level (&stack, &spare);
+        }
+        if (stack == nil)
+            break;
+        level = car (stack);
+        if (level_kind (level) == FINISHED_LEVEL)
+        {
+            fprintf (stderr, "unmatched parenthesis\n");
+            exit (1);
+        }
+        else if (level_kind (level) == DOTTED_LEVEL)
+        {
+            set_cdr (cdr (level), obj);
+            set_level_kind (level, FINISHED_LEVEL);
+        }
+        else
+        {
+            obj = cons (obj, nil);
+            set_cdr (cdr (level), obj);
+            set_cdr (level, obj);
+        }
+    }
+    gc_restore_roots (roots);
+    return obj;
+}
+
+/* The reader for IN. It starts over whenever IN isn't where its last refill
+ * left it, so another FILE or a rewind of this one picks up from there
+ */
+static reader*
+file_input (FILE *in)
+{
+    if (in != file_reader.file || ftell (in) != file_reader.offset)
+    {
+        file_reader.file = in;
+        file_reader.pos = file_reader.end = file_reader.buf;
+        file_reader.offset = ftell (in);
+    }
+    return &file_reader;
+}
+
+/* checks the next character in IN without removing it */
+int
+peek (FILE *in)
+{
+    return peek_char (file_input (in));
+}
+
+/* removes whitespace and comments from the front of IN */
+void
+rem_whitespace (FILE *in)
+{
+    skip_whitespace (file_input (in));
+}
+
+/* Reads the next datum from IN, exiting when the input runs out */
+object*
+read (FILE *in)
+{
+    object *obj = read_datum (file_input (in));
+    if (obj == NULL)
+        exit (0);
+    return obj;
+}
+
+/* Reads every datum in the LEN bytes at BUF, which needn't be null
+ * terminated, and returns them as a list in order
+ */
+object*
+read_from_buffer (const char *buf, size_t len)
+{
+    reader r = { buf, buf + len, NULL, 0, NULL, 0 };
+    object *data = nil, *last = NULL, *obj = NULL;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&data);
+    gc_root (&obj);
+    while ((obj = read_datum (&r)) != NULL)
+    {
+        obj = cons (obj, nil);
+        if (last == NULL)
+            data = obj;
+        else
+            set_cdr (last, obj);
+        last = obj;
+    }
+    gc_restore_roots (roots);
+    return data;
+}
+
+bool
+is_self_evaluating (object *o)
+{
+    object_t ty = type_of (o);
+    return (ty == BOOLEAN || ty == FIXNUM || ty == BIGNUM || ty == FLONUM
+            || ty == CHARACTER || ty == STRING || ty == VECTOR);
+}
+
+/* Collects the names defined by internal defines anywhere in BODY (but not in
+ * nested lambdas or quoted data) that aren't already in VARS, and returns VARS
+ * with them appended. These become extra slots in the procedure's frame
+ */
+object*
+internal_defines (object *body, object *vars)
+{
+    object *exp, *name, *v;
+    size_t roots = gc_save_roots ();
+    gc_root (&vars);
+    for (; type_of (body) == PAIR; body = cdr (body))
+    {
+        exp = car (body);
+        if (type_of (exp) != PAIR || has_symbol (quote, exp)
+                || has_symbol (lambda, exp))
+            continue;
+        if (has_symbol (define, exp))
+        {
+            name = cadr (exp);
+            if (type_of (name) == PAIR)
+                name = car (name);
+            for (v = vars; type_of (v) == PAIR && car (v) != name; v = cdr (v))
+                ;
+            if (type_of (v) != PAIR)
+                vars = append (vars, cons (name, nil));
+            if (type_of (cadr (exp)) == PAIR)
+                continue;
+            exp = cddr (exp);
+        }
+        vars = internal_defines (exp, vars);
+    }
+    gc_restore_roots (roots);
+    return vars;
+}
+
+/* Returns a fresh list with the elements of LIST followed by TAIL */
+object*
+append (object *list, object *tail)
+{
+    object *rest;
+    size_t roots;
+    if (type_of (list) != PAIR)
+        return tail;
+    roots = gc_save_roots ();
+    gc_root (&list);
+    rest = append (cdr (list), tail);
+    rest = cons (car (list), rest);
+    gc_restore_roots (roots);
+    return rest;
+}
+
+/* let and its relatives. let*, letrec, letrec* and do are rewritten into
+ * plain and named lets (see expand_derived), which the analyzer and the VM
+ * compiler handle directly. A named let whose name is only ever called in
+ * tail position of its own body runs as a loop that stores the new values
+ * over the variables of one frame (see is_loop), any other named let becomes
+ * a local procedure (see expand_named_let)
+ */
+enum binding_part { BINDING_VARIABLE, BINDING_INIT, BINDING_STEP };
+
+/* Returns a fresh list of the PART of each binding in BINDINGS. A binding
+ * without a step (the third element in do) steps to its own variable */
+static object*
+binding_parts (object *bindings, enum binding_part part)
+{
+    object *rest, *binding;
+    size_t roots;
+    if (type_of (bindings) != PAIR)
+        return nil;
+    roots = gc_save_roots ();
+    gc_root (&bindings);
+    rest = binding_parts (cdr (bindings), part);
+    binding = car (bindings);
+    if (part == BINDING_STEP && type_of (cddr (binding)) == PAIR)
+        binding = caddr (binding);
+    else if (part == BINDING_INIT)
+        binding = cadr (binding);
+    else
+        binding = car (binding);
+    rest = cons (binding, rest);
+    gc_restore_roots (roots);
+    return rest;
+}
+
+object*
+let_variables (object *bindings)
+{
+    return binding_parts (bindings, BINDING_VARIABLE);
+}
+
+object*
+let_inits (object *bindings)
+{
+    return binding_parts (bindings, BINDING_INIT);
+}
+
+/* Returns ((HEAD . X) ...) for each X in LIST, followed by TAIL */
+static object*
+prefix_each (object *head, object *list, object *tail)
+{
+    object *rest;
+    size_t roots;
+    if (type_of (list) != PAIR)
+        return tail;
+    roots = gc_save_roots ();
+    gc_root (&head);
+    gc_root (&list);
+    rest = prefix_each (head, cdr (list), tail);
+    gc_root (&rest);
+    rest = cons (cons (head, car (list)), rest);
+    gc_restore_roots (roots);
+    return rest;
+}
+
+/* Rewrites the first clause of the cond expression EXP into an if (or for
+ * else, a begin) around the cond of the remaining clauses, REST
+ *     (cond (else exp ...))          (begin exp ...)
+ *     (cond (test) . rest)           (let ((" cond" test))
+ *                                      (if " cond" " cond" (cond . rest)))
+ *     (cond (test => f) . rest)      (let ((" cond" test))
+ *                                      (if " cond" (f " cond") (cond . rest)))
+ *     (cond (test exp ...) . rest)   (if test (begin exp ...) (cond . rest))
+ * The last clause has no (cond . rest), so a cond where nothing matched has
+ * the value of if without an alternative
+ */
+static object*
+expand_cond (object *exp)
+{
+    object *clause, *result = NULL, *rest = NULL, *name;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&exp);
+    gc_root (&result);
+    gc_root (&rest);
+    if (type_of (cdr (exp)) != PAIR)
+    {
+        result = cons (begin, nil);
+        gc_restore_roots (roots);
+        return result;
+    }
+    clause = cadr (exp);
+    if (car (clause) == make_symbol ("else"))
+    {
+        result = cons (begin, cdr (clause));
+        gc_restore_roots (roots);
+        return result;
+    }
+    if (type_of (cddr (exp)) == PAIR)
+    {
+        rest = cons (car (exp), cddr (exp));
+        rest = cons (rest, nil);
+    }
+    else
+        rest = nil;
+    if (type_of (cdr (clause)) != PAIR || cadr (clause) == make_symbol ("=>"))
+    {
+        name = make_symbol (" cond");
+        if (type_of (cdr (clause)) != PAIR)
+            result = name;
+        else
+        {
+            result = cons (name, nil);
+            result = cons (caddr (clause), result);
+        }
+        rest = cons (result, rest);
+        rest = cons (name, rest);
+        rest = cons (ifs, rest);
+        rest = cons (rest, nil);
+        result = cons (car (clause), nil);
+        result = cons (name, result);
+        result = cons (result, nil);
+        result = cons (result, rest);
+        result = cons (let, result);
+    }
+    else
+    {
+        result = cons (begin, cdr (clause));
+        rest = cons (result, rest);
+        rest = cons (car (clause), rest);
+        result = cons (ifs, rest);
+    }
+    gc_restore_roots (roots);
+    return result;
+}
+
+/* Rewrites the let*, letrec, do or cond expression EXP into the lets and
+ * ifs it stands for
+ *     (let* (b1 b2 ...) . body)      (let (b1) (let* (b2 ...) . body))
+ *     (letrec ((v init) ...) . body) (let () (define v init) ... . body)
+ *     (do ((v init step) ...) (test exp ...) command ...)
+ *         (let " do" ((v init step) ...)
+ *           (if test (begin exp ...) (begin command ... (" do" step ...))))
+ * letrec* is the same as letrec, for cond see expand_cond. The names of the
+ * do loop and the cond temporary can't be read, so they never shadow a
+ * variable of the program
+ */
+object*
+expand_derived (object *exp)
+{
+    object *result = NULL, *rest = NULL, *name;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&exp);
+    gc_root (&result);
+    gc_root (&rest);
+    switch (special_form (car (exp)))
+    {
+    case LET_STAR_FORM:
+        if (type_of (cadr (exp)) != PAIR || type_of (cdadr (exp)) != PAIR)
+        {
+            result = cons (let, cdr (exp));
+            break;
+        }
+        rest = cons (cdadr (exp), cddr (exp));
+        rest = cons (car (exp), rest);
+        rest = cons (rest, nil);
+        result = cons (caadr (exp), nil);
+        result = cons (result, rest);
+        result = cons (let, result);
+        break;
+    case LETREC_FORM:
+        result = prefix_each (define, cadr (exp), cddr (exp));
+        result = cons (nil, result);
+        result = cons (let, result);
+        break;
+    case DO_FORM:
+        name = make_symbol (" do");
+        rest = binding_parts (cadr (exp), BINDING_STEP);
+        rest = cons (name, rest);
+        rest = cons (rest, nil);
+        rest = append (cdddr (exp), rest);
+        rest = cons (begin, rest);
+        rest = cons (rest, nil);
+        result = cons (begin, cdaddr (exp));
+        rest = cons (result, rest);
+        rest = cons (caaddr (exp), rest);
+        rest = cons (ifs, rest);
+        rest = cons (rest, nil);
+        result = cons (cadr (exp), rest);
+        result = cons (name, result);
+        result = cons (let, result);
+        break;
+    case COND_FORM:
+        result = expand_cond (exp);
+        break;
+    default:
+        result = exp;
+        break;
+    }
+    gc_restore_roots (roots);
+    return result;
+}
+
+/* A case with fewer datums than this compares the key with each in turn */
+#define CASE_TABLE_MIN 8
+
+/* Returns what case_clause looks the key of a case up in, given its CLAUSES.
+ * That is a list of (datum . clause number) for a few datums, and an eqv?
+ * hash table from datums to clause numbers for many, so dispatch takes the
+ * same time whichever clause matches. The first clause with a datum wins
+ */
+object*
+case_dispatch (object *clauses)
+{
+    object *dispatch = nil, *datums, *entry;
+    long i, n = 0;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&clauses);
+    gc_root (&dispatch);
+    for (datums = clauses; type_of (datums) == PAIR; datums = cdr (datums))
+        n += list_length (caar (datums));
+    if (n >= CASE_TABLE_MIN)
+        dispatch = make_hash_table (false);
+    for (i = 0; type_of (clauses) == PAIR; clauses = cdr (clauses), i++)
+        for (datums = caar (clauses); type_of (datums) == PAIR;
+                datums = cdr (datums))
+        {
+            if (n < CASE_TABLE_MIN)
+            {
+                entry = cons (car (datums), make_fixnum (i));
+                dispatch = append (dispatch, cons (entry, nil));
+            }
+            else if (hash_table_get (dispatch, car (datums)) == NULL)
+                hash_table_put (dispatch, car (datums), make_fixnum (i));
+        }
+    gc_restore_roots (roots);
+    return dispatch;
+}
+
+/* Returns the number of the clause KEY selects in DISPATCH (made by
+ * case_dispatch), or -1 if none does */
+long
+case_clause (object *dispatch, object *key)
+{
+    object *clause;
+    if (type_of (dispatch) == HASHTABLE)
+    {
+        clause = hash_table_get (dispatch, key);
+        return clause != NULL ? fixnum_value (clause) : -1;
+    }
+    for (; type_of (dispatch) == PAIR; dispatch = cdr (dispatch))
+        if (is_eq (caar (dispatch), key))
+            return fixnum_value (cdar (dispatch));
+    return -1;
+}
+
+/* Rewrites the named let EXP into a call of a local procedure
+ *     (let name ((v init) ...) . body)
+ *     ((let () (define name (lambda (v ...) . body)) name) init ...)
+ */
+object*
+expand_named_let (object *exp)
+{
+    object *result = NULL, *rest = NULL;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&exp);
+    gc_root (&result);
+    gc_root (&rest);
+    result = let_variables (caddr (exp));
+    result = cons (result, cdddr (exp));
+    result = cons (lambda, result);
+    result = cons (result, nil);
+    result = cons (cadr (exp), result);
+    result = cons (define, result);
+    rest = cons (cadr (exp), nil);
+    result = cons (result, rest);
+    result = cons (nil, result);
+    result = cons (let, result);
+    rest = let_inits (caddr (exp));
+    result = cons (result, rest);
+    gc_restore_roots (roots);
+    return result;
+}
+
+/* Whether one of BINDINGS binds VAR */
+static bool
+binds (object *bindings, object *var)
+{
+    for (; type_of (bindings) == PAIR; bindings = cdr (bindings))
+        if (type_of (car (bindings)) == PAIR && caar (bindings) == var)
+            return true;
+    return false;
+}
+
+static bool loop_exp (object *, long, object *, bool);
+
+/* Checks each expression of BODY with loop_exp, the last one in TAIL
+ * position if the body is */
+static bool
+loop_body (object *name, long argc, object *body, bool tail)
+{
+    for (; type_of (body) == PAIR; body = cdr (body))
+        if (!loop_exp (name, argc, car (body), tail
+                       && type_of (cdr (body)) != PAIR))
+            return false;
+    return true;
+}
+
+static bool
+loop_inits (object *name, long argc, object *bindings)
+{
+    for (; type_of (bindings) == PAIR; bindings = cdr (bindings))
+        if (!loop_exp (name, argc, cadar (bindings), false))
+            return false;
+    return true;
+}
+
+/* Whether EXP, in TAIL position of the body of the loop NAME or not, only
+ * uses NAME as the operator of tail calls with ARGC arguments. A lambda
+ * anywhere in it could keep the loop's frame past an iteration, so it is
+ * never a loop body either. Where a let rebinds NAME its body is left alone
+ */
+static bool
+loop_exp (object *name, long argc, object *exp, bool tail)
+{
+    bool result;
+    size_t roots;
+
+    if (exp == name)
+        return false;
+    if (type_of (exp) != PAIR)
+        return true;
+    roots = gc_save_roots ();
+    gc_root (&exp);
+    switch (special_form (car (exp)))
+    {
+    case QUOTE_FORM:
+        result = true;
+        break;
+    case LAMBDA_FORM:
+        result = false;
+        break;
+    /* (define (f) ...) is a lambda too */
+    case SET_FORM:
+    case DEFINE_FORM:
+        result = cadr (exp) != name && type_of (cadr (exp)) != PAIR
+                 && loop_body (name, argc, cddr (exp), false);
+        break;
+    case IF_FORM:
+        result = loop_exp (name, argc, cadr (exp), false)
+                 && loop_exp (name, argc, caddr (exp), tail)
+                 && (type_of (cdddr (exp)) != PAIR
+                     || loop_exp (name, argc, cadddr (exp), tail));
+        break;
+    case BEGIN_FORM:
+    case AND_FORM:
+    case OR_FORM:
+        result = loop_body (name, argc, cdr (exp), tail);
+        break;
+    case LET_FORM:
+        if (type_of (cadr (exp)) == SYMBOL)
+            result = is_loop (exp) && loop_inits (name, argc, caddr (exp))
+                     && (cadr (exp) == name || binds (caddr (exp), name)
+                         || loop_body (name, argc, cdddr (exp), tail));
+        else
+            result = loop_inits (name, argc, cadr (exp))
+                     && (binds (cadr (exp), name)
+                         || loop_body (name, argc, cddr (exp), tail));
+        break;
+    case CASE_FORM:
+        result = loop_exp (name, argc, cadr (exp), false);
+        for (exp = cddr (exp); result && type_of (exp) == PAIR;
+                exp = cdr (exp))
+            result = loop_body (name, argc, cdar (exp), tail);
+        break;
+    case LET_STAR_FORM:
+    case LETREC_FORM:
+    case DO_FORM:
+    case COND_FORM:
+        result = loop_exp (name, argc, expand_derived (exp), tail);
+        break;
+    default:
+        if (car (exp) == name)
+            result = tail && list_length (cdr (exp)) == argc
+                     && loop_body (name, argc, cdr (exp), false);
+        else
+            result = loop_body (name, argc, exp, false);
+        break;
+    }
+    gc_restore_roots (roots);
+    return result;
+}
+
+/* Whether the named let EXP can run as a loop in a single frame: its name
+ * is only called, in tail position and with one argument per variable, and
+ * nothing can hold on to the frame */
+bool
+is_loop (object *exp)
+{
+    return !binds (caddr (exp), cadr (exp))
+           && loop_body (cadr (exp), list_length (caddr (exp)), cdddr (exp),
+                         true);
+}
+
+/* Returns what the call of NAME in SCOPE jumps to, if NAME is the innermost
+ * binding of that name and is one of the named let LOOPS, a list of
+ * (name scope . target) with the scope of each loop's body. *DEPTH is then
+ * the number of frames out the loop's frame is
+ */
+object*
+find_loop (object *name, object *loops, object *scope, long *depth)
+{
+    object *s;
+    long local, index;
+
+    for (; type_of (loops) == PAIR; loops = cdr (loops))
+    {
+        if (caar (loops) != name)
+            continue;
+        for (*depth = 0, s = scope; type_of (s) == PAIR && s != cadar (loops);
+                (*depth)++, s = cdr (s))
+            ;
+        if (type_of (s) != PAIR)
+            continue;
+        if (find_local (name, scope, &local, &index) && local <= *depth)
+            return NULL;
+        return cddar (loops);
+    }
+    return NULL;
+}
+
+/* The analyzer turns an expression into a tree of NODE objects once, in the
+ * style of SICP's analyzing evaluator. A node holds the C function that runs
+ * it and its operands (child nodes, constants, frame addresses as fixnums) in
+ * its slots, so running a procedure body never looks at list structure again.
+ * Nodes are ordinary heap objects, the collector traces them like frames
+ */
+object*
+make_node (exec_fn exec, long size)
+{
+    object *obj = alloc_slotted (NODE, size);
+    obj->data.node.exec = exec;
+    return obj;
+}
+
+/* Finds VAR in the compile time SCOPE, a list of frames that each list their
+ * variables in slot order, and returns its entry there: the variable, or a
+ * list of it if it lives in a box (see box_variables). Returns NULL if VAR
+ * isn't bound locally and so must be a global
+ */
+object*
+scope_entry (object *var, object *scope, long *depth, long *index)
+{
+    object *vars;
+    for (*depth = 0; type_of (scope) == PAIR; (*depth)++, scope = cdr (scope))
+        for (*index = 0, vars = car (scope); type_of (vars) == PAIR;
+                (*index)++, vars = cdr (vars))
+            if (car (vars) == var || (type_of (car (vars)) == PAIR
+                                      && caar (vars) == var))
+                return car (vars);
+    return NULL;
+}
+
+bool
+find_local (object *var, object *scope, long *depth, long *index)
+{
+    return scope_entry (var, scope, depth, index) != NULL;
+}
+
+/* Closure conversion. A lambda doesn't keep the frames around it, only a
+ * closure record: a frame with the values of its free variables (the local
+ * variables of enclosing frames its body uses), whose parent is the
+ * toplevel. Inside the body the record is the frame one out from the
+ * lambda's own, so a captured variable is one load away. A variable that is
+ * both captured and assigned (by set! or an internal define) lives in a
+ * box, a pair whose car is its value, which the frame and every record
+ * share. Boxes never escape into Scheme values
+ */
+typedef struct variable_uses
+{
+    object *scope;      /* where free variables are looked up, or NULL */
+    object *free;       /* the scope entries of the free variables found */
+    object *captured;   /* the variables used inside a nested lambda */
+    object *assigned;   /* the variables set! or defined */
+} variable_uses;
+
+static bool
+is_member (object *obj, object *list)
+{
+    for (; type_of (list) == PAIR; list = cdr (list))
+        if (car (list) == obj)
+            return true;
+    return false;
+}
+
+/* Notes a use of VAR, not bound by anything inside the expression walked */
+static void
+use_variable (variable_uses *uses, object *var, bool assigned, bool nested)
+{
+    object *entry;
+    long depth, index;
+
+    if (uses->scope != NULL)
+    {
+        entry = scope_entry (var, uses->scope, &depth, &index);
+        if (entry != NULL && !is_member (entry, uses->free))
+            uses->free = append (uses->free, cons (entry, nil));
+        return;
+    }
+    if (nested && !is_member (var, uses->captured))
+        uses->captured = cons (var, uses->captured);
+    if (assigned && !is_member (var, uses->assigned))
+        uses->assigned = cons (var, uses->assigned);
+}
+
+static void walk_uses (object *, object *, bool, variable_uses *);
+
+/* Walks BODY with VARS bound around it, and their frame's internal defines */
+static void
+walk_body (object *body, object *vars, object *shadow, bool nested,
+           variable_uses *uses)
+{
+    size_t roots = gc_save_roots ();
+
+    gc_root (&body);
+    gc_root (&shadow);
+    vars = internal_defines (body, vars);
+    shadow = append (vars, shadow);
+    for (; type_of (body) == PAIR; body = cdr (body))
+        walk_uses (car (body), shadow, nested, uses);
+    gc_restore_roots (roots);
+}
+
+/* Passes each variable EXP uses, other than those in SHADOW (bound inside
+ * what is walked), to use_variable. NESTED says whether EXP is inside a
+ * lambda. The forms are seen as analyze sees them, named lets that aren't
+ * loops and the derived forms expanded
+ */
+static void
+walk_uses (object *exp, object *shadow, bool nested, variable_uses *uses)
+{
+    object *rest;
+    size_t roots;
+
+    if (type_of (exp) == SYMBOL)
+    {
+        if (!is_member (exp, shadow))
+            use_variable (uses, exp, false, nested);
+        return;
+    }
+    if (type_of (exp) != PAIR)
+        return;
+    roots = gc_save_roots ();
+    gc_root (&exp);
+    gc_root (&shadow);
+    switch (special_form (car (exp)))
+    {
+    case QUOTE_FORM:
+        break;
+    case SET_FORM:
+    case DEFINE_FORM:
+        if (type_of (cadr (exp)) == PAIR)
+        {
+            rest = cons (lambda, cons (cdadr (exp), cddr (exp)));
+            exp = cons (car (exp), cons (caadr (exp), cons (rest, nil)));
+        }
+        if (!is_member (cadr (exp), shadow))
+            use_variable (uses, cadr (exp), true, nested);
+        for (rest = cddr (exp); type_of (rest) == PAIR; rest = cdr (rest))
+            walk_uses (car (rest), shadow, nested, uses);
+        break;
+    case LAMBDA_FORM:
+        walk_body (cddr (exp), cadr (exp), shadow, true, uses);
+        break;
+    case LET_FORM:
+        if (type_of (cadr (exp)) == SYMBOL && !is_loop (exp))
+        {
+            walk_uses (expand_named_let (exp), shadow, nested, uses);
+            break;
+        }
+        if (type_of (cadr (exp)) == SYMBOL)
+        {
+            shadow = cons (cadr (exp), shadow);
+            exp = cdr (exp);
+        }
+        for (rest = cadr (exp); type_of (rest) == PAIR; rest = cdr (rest))
+            walk_uses (cadar (rest), shadow, nested, uses);
+        walk_body (cddr (exp), let_variables (cadr (exp)), shadow, nested,
+                   uses);
+        break;
+    case LET_STAR_FORM:
+    case LETREC_FORM:
+    case DO_FORM:
+    case COND_FORM:
+        walk_uses (expand_derived (exp), shadow, nested, uses);
+        break;
+    case CASE_FORM:
+        walk_uses (cadr (exp), shadow, nested, uses);
+        for (rest = cddr (exp); type_of (rest) == PAIR; rest = cdr (rest))
+            walk_uses (cons (begin, cdar (rest)), shadow, nested, uses);
+        break;
+    /* the rest, and applications, use all their subexpressions */
+    default:
+        for (rest = exp; type_of (rest) == PAIR; rest = cdr (rest))
+            walk_uses (car (rest), shadow, nested, uses);
+        break;
+    }
+    gc_restore_roots (roots);
+}
+
+/* Returns the scope entries of the free variables of the lambda EXP, as
+ * found in the SCOPE it is in, in the order they first appear. These are
+ * the slots of its closure record
+ */
+object*
+free_variables (object *exp, object *scope)
+{
+    variable_uses uses;
+    size_t roots = gc_save_roots ();
+
+    uses.scope = scope;
+    uses.free = uses.captured = uses.assigned = nil;
+    gc_root (&uses.scope);
+    gc_root (&uses.free);
+    walk_body (cddr (exp), cadr (exp), nil, false, &uses);
+    gc_restore_roots (roots);
+    return uses.free;
+}
+
+/* Returns VARS with each variable in USES->captured and USES->assigned in a
+ * list of its own */
+static object*
+mark_boxes (object *vars, variable_uses *uses)
+{
+    object *rest, *entry;
+    size_t roots;
+
+    if (type_of (vars) != PAIR)
+        return nil;
+    roots = gc_save_roots ();
+    gc_root (&vars);
+    rest = mark_boxes (cdr (vars), uses);
+    gc_root (&rest);
+    entry = car (vars);
+    if (is_member (entry, uses->captured) && is_member (entry, uses->assigned))
+        entry = cons (entry, nil);
+    rest = cons (entry, rest);
+    gc_restore_roots (roots);
+    return rest;
+}
+
+/* Returns VARS, the variables of the frame BODY runs in, with those that
+ * need a box (captured and assigned in BODY) each in a list of its own */
+object*
+box_variables (object *vars, object *body)
+{
+    variable_uses uses;
+    size_t roots = gc_save_roots ();
+
+    uses.scope = NULL;
+    uses.free = uses.captured = uses.assigned = nil;
+    gc_root (&vars);
+    gc_root (&body);
+    gc_root (&uses.captured);
+    gc_root (&uses.assigned);
+    for (; type_of (body) == PAIR; body = cdr (body))
+        walk_uses (car (body), nil, false, &uses);
+    vars = mark_boxes (vars, &uses);
+    gc_restore_roots (roots);
+    return vars;
+}
+
+long
+list_length (object *list)
+{
+    long n = 0;
+    for (; type_of (list) == PAIR; list = cdr (list))
+        n++;
+    return n;
+}
+
+/* The exec functions for each kind of node. Operand nodes are run with
+ * execute, nodes in tail position are handed back through NEXT
+ */
+static object*
+exec_constant (object *node, object **env, object **next)
+{
+    return node_slot (node, 0);
+}
+
+/* Slot 0 is the symbol, slots 1 to 3 an inline cache of the toplevel and
+ * global_version it was last looked up at and the value found */
+static object*
+exec_global_ref (object *node, object **env, object **next)
+{
+    object *top = toplevel_env (*env);
+    if (node_slot (node, 1) != top
+            || fixnum_value (node_slot (node, 2)) != (long)global_version)
+    {
+        node_slot (node, 3) = lookup_variable (node_slot (node, 0), top);
+        node_slot (node, 1) = top;
+        node_slot (node, 2) = make_fixnum (global_version);
+    }
+    return node_slot (node, 3);
+}
+
+static object*
+exec_local_ref (object *node, object **env, object **next)
+{
+    return lookup_local (fixnum_value (node_slot (node, 0)),
+                         fixnum_value (node_slot (node, 1)), *env);
+}
+
+/* most references are to the innermost frame, skip the walk for those */
+static object*
+exec_local_ref0 (object *node, object **env, object **next)
+{
+    object *val = frame_slots (*env)[fixnum_value (node_slot (node, 1))];
+    if (val == UNASSIGNED_OBJ)
+    {
+        fprintf (stderr, "Unbound variable, could not lookup\n");
+        exit (1);
+    }
+    return val;
+}
+
+/* set! and internal defines of a local both store to its slot */
+static object*
+exec_set_local (object *node, object **env, object **next)
+{
+    object *val = execute (node_slot (node, 2), *env);
+    set_local (fixnum_value (node_slot (node, 0)),
+               fixnum_value (node_slot (node, 1)), val, *env);
+    return ok;
+}
+
+/* A boxed variable, slots 0 and 1 are the depth and index of its box */
+static object*
+exec_box_ref (object *node, object **env, object **next)
+{
+    object *val = car (*local_cell (fixnum_value (node_slot (node, 0)),
+                                    fixnum_value (node_slot (node, 1)), *env));
+    if (val == UNASSIGNED_OBJ)
+    {
+        fprintf (stderr, "Unbound variable, could not lookup\n");
+        exit (1);
+    }
+    return val;
+}
+
+static object*
+exec_set_box (object *node, object **env, object **next)
+{
+    object *val = execute (node_slot (node, 2), *env);
+    set_car (*local_cell (fixnum_value (node_slot (node, 0)),
+                          fixnum_value (node_slot (node, 1)), *env), val);
+    return ok;
+}
+
+/* Puts the value in each slot of the current frame listed in NODE in a box */
+static object*
+exec_box (object *node, object **env, object **next)
+{
+    object *box;
+    long i, index;
+    for (i = 0; i < node->data.node.size; i++)
+    {
+        index = fixnum_value (node_slot (node, i));
+        box = cons (frame_slots (*env)[index], nil);
+        frame_slots (*env)[index] = box;
+    }
+    return ok;
+}
+
+static object*
+exec_set_global (object *node, object **env, object **next)
+{
+    set_variable (node_slot (node, 0), execute (node_slot (node, 1), *env),
+                  *env);
+    return ok;
+}
+
+static object*
+exec_define_global (object *node, object **env, object **next)
+{
+    define_variable (node_slot (node, 0), execute (node_slot (node, 1), *env),
+                     *env);
+    return ok;
+}
+
+static object*
+exec_if (object *node, object **env, object **next)
+{
+    if (execute (node_slot (node, 0), *env) != f)
+        *next = node_slot (node, 1);
+    else
+        *next = node_slot (node, 2);
+    return NULL;
+}
+
+/* Mandated by R5RS, the last expression of a sequence is a tail call */
+static object*
+exec_sequence (object *node, object **env, object **next)
+{
+    long i, last = node->data.node.size - 1;
+    for (i = 0; i < last; i++)
+        execute (node_slot (node, i), *env);
+    *next = node_slot (node, last);
+    return NULL;
+}
+
+/* short circuited and and or */
+static object*
+exec_and (object *node, object **env, object **next)
+{
+    long i, last = node->data.node.size - 1;
+    for (i = 0; i < last; i++)
+        if (execute (node_slot (node, i), *env) == f)
+            return f;
+    *next = node_slot (node, last);
+    return NULL;
+}
+
+static object*
+exec_or (object *node, object **env, object **next)
+{
+    long i, last = node->data.node.size - 1;
+    for (i = 0; i < last; i++)
+        if (execute (node_slot (node, i), *env) == t)
+            return t;
+    *next = node_slot (node, last);
+    return NULL;
+}
+
+/* Slot 0 is the frame size (parameters then internal defines), slot 1 the
+ * body and the rest pairs of the depth and index of each free variable. A
+ * lambda without any closes over the toplevel alone
+ */
+static object*
+exec_lambda (object *node, object **env, object **next)
+{
+    object *record = toplevel_env (*env);
+    long i, n = (node->data.node.size - 2) / 2;
+
+    if (n == 0)
+        return make_compound_proc (node, record);
+    record = make_frame (n, record);
+    for (i = 0; i < n; i++)
+        frame_slots (record)[i] =
+            *local_cell (fixnum_value (node_slot (node, 2 + 2 * i)),
+                         fixnum_value (node_slot (node, 3 + 2 * i)), *env);
+    return make_compound_proc (node, record);
+}
+
+/* Evaluates the slots of NODE from FIRST on left to right onto the argument
+ * stack and returns where they start */
+static object**
+push_operands (object *node, long first, object **env)
+{
+    object **base = arg_top, *result;
+    long i;
+
+    if (base + node->data.node.size > arg_stack + ARG_STACK_LEN)
+        arg_stack_overflow ();
+    for (i = first; i < node->data.node.size; i++)
+    {
+        result = execute (node_slot (node, i), *env);
+        *arg_top++ = result;
+    }
+    return base;
+}
+
+/* Slot 0 is the operator, the remaining slots are the operands. The operator
+ * and then the operands are evaluated left to right onto the argument stack,
+ * and popped again once the procedure has been applied
+ */
+static object**
+push_application (object *node, object **env)
+{
+    return push_operands (node, 0, env);
+}
+
+static object*
+exec_application (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    object *result = apply_procedure (node->data.node.size - 1, base + 1, env,
+                                      next);
+    arg_top = base;
+    return result;
+}
+
+/* Slot 0 is the frame size (variables then internal defines), slot 1 the
+ * body and the remaining slots the inits. Their values fill a new frame the
+ * body runs in, as the tail of the let
+ */
+static object*
+exec_let (object *node, object **env, object **next)
+{
+    object **base = push_operands (node, 2, env);
+    *env = extend_env (fixnum_value (node_slot (node, 0)), arg_top - base,
+                       base, *env);
+    arg_top = base;
+    *next = node_slot (node, 1);
+    return NULL;
+}
+
+/* Slot 0 is the key, slot 1 the case_dispatch of the datums, slot 2 the
+ * else clause and the remaining slots the other clauses in order. The
+ * selected clause is the tail of the case
+ */
+static object*
+exec_case (object *node, object **env, object **next)
+{
+    object *key = execute (node_slot (node, 0), *env);
+    long clause = case_clause (node_slot (node, 1), key);
+    *next = node_slot (node, clause < 0 ? 2 : clause + 3);
+    return NULL;
+}
+
+/* A call of a named let loop. Slot 0 is how many frames out the loop's frame
+ * is, slot 1 the loop's let node and the remaining slots the new values of
+ * its variables, which replace the old ones before the body runs again
+ */
+static object*
+exec_loop (object *node, object **env, object **next)
+{
+    object **base = push_operands (node, 2, env), *frame = *env;
+    long i;
+
+    for (i = fixnum_value (node_slot (node, 0)); i > 0; i--)
+        frame = enclosing_env (frame);
+    for (i = 0; i < arg_top - base; i++)
+        frame_slots (frame)[i] = base[i];
+    arg_top = base;
+    *env = frame;
+    *next = node_slot (node_slot (node, 1), 1);
+    return NULL;
+}
+
+/* Two operand calls of + - * = < > quotient and remainder, laid out like any
+ * application. While the operator is still the library procedure and the
+ * operands are fixnums the operation is done inline, otherwise it is applied
+ * as usual. A sum or difference of two fixnums always fits a long, so only
+ * the result needs checking against the fixnum range
+ */
+#define fixnum_operation(base, fun) \
+    (is_fixnum ((base)[1]) && is_fixnum ((base)[2]) \
+     && is_primitive ((base)[0], fun))
+
+static object*
+apply_operation (object **base, object **env, object **next)
+{
+    object *result = apply_procedure (2, base + 1, env, next);
+    arg_top = base;
+    return result;
+}
+
+static object*
+exec_add (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    long result;
+    if (!fixnum_operation (base, add_proc))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    result = fixnum_value (base[1]) + fixnum_value (base[2]);
+    return fixnum_fits (result) ? make_fixnum (result) : make_integer (result);
+}
+
+static object*
+exec_sub (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    long result;
+    if (!fixnum_operation (base, sub_proc))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    result = fixnum_value (base[1]) - fixnum_value (base[2]);
+    return fixnum_fits (result) ? make_fixnum (result) : make_integer (result);
+}
+
+static object*
+exec_mul (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    long result;
+    if (!fixnum_operation (base, mul_proc)
+            || !fixnum_mul (fixnum_value (base[1]), fixnum_value (base[2]),
+                            &result))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    return make_fixnum (result);
+}
+
+/* division by zero is left to the library procedure, and FIXNUM_MIN / -1
+ * becomes a bignum */
+static object*
+exec_quotient (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    long result;
+    if (!fixnum_operation (base, quotient_proc) || base[2] == make_fixnum (0))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    result = fixnum_value (base[1]) / fixnum_value (base[2]);
+    return fixnum_fits (result) ? make_fixnum (result) : make_integer (result);
+}
+
+static object*
+exec_remainder (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    if (!fixnum_operation (base, remainder_proc) || base[2] == make_fixnum (0))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    return make_fixnum (fixnum_value (base[1]) % fixnum_value (base[2]));
+}
 
-    else if (c == '\'')
-        return cons (quote, cons (read (in), nil));
+static object*
+exec_number_equal (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    if (!fixnum_operation (base, is_number_equal_proc))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    return base[1] == base[2] ? t : f;
+}
 
-    else if (c == '(')
-    {
-        return read_pair (in);
-    }
+static object*
+exec_less_than (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    if (!fixnum_operation (base, is_less_than_proc))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    return fixnum_value (base[1]) < fixnum_value (base[2]) ? t : f;
+}
 
-    else if (isdigit (c) || (c == '-' && isdigit (peek (in))))
-    {
-        if (c == '-')
-            sign = -1;
-        else ungetc (c, in);
+static object*
+exec_greater_than (object *node, object **env, object **next)
+{
+    object **base = push_application (node, env);
+    if (!fixnum_operation (base, is_greater_than_proc))
+        return apply_operation (base, env, next);
+    arg_top = base;
+    return fixnum_value (base[1]) > fixnum_value (base[2]) ? t : f;
+}
 
-        while (isdigit ((c = getc (in))))
-            num = (num * 10) + (c - '0');
-        num *= sign;
-        if (is_delimiter (c))
-        {
-            ungetc (c, in);
-            return make_fixnum (num);
-        }
-        else
+/* Applies the procedure at ARGV[-1] on the argument stack to the ARGC
+ * arguments after it, which must be the top of the stack. Primitives run
+ * right away, for a compound procedure (and for eval) the body becomes the
+ * tail call *NEXT in the environment *ENV
+ */
+object*
+apply_procedure (long argc, object **argv, object **env, object **next)
+{
+    object *procedure = argv[-1], *lambda, *list;
+    long i;
+
+    /* If the procedure is apply, we treat it slightly differently. Then the
+     * real procedure is the first argument of apply, and the arguments are
+     * the rest of the members of the form, with the last (a list) spread out
+     * on the stack
+     */
+    while (type_of (procedure) == PRIM_PROC
+            && procedure->data.prim_proc.fun == apply_proc)
+    {
+        check_arity (procedure, argc);
+        list = argv[argc - 1];
+        procedure = argv[-1] = argv[0];
+        for (i = 0; i < argc - 2; i++)
+            argv[i] = argv[i + 1];
+        arg_top = argv + argc - 2;
+        for (; type_of (list) == PAIR; list = cdr (list))
         {
-            fprintf(stderr, "You need to end a number with a delimiter\n");
-            exit (1);
+            if (arg_top == arg_stack + ARG_STACK_LEN)
+                arg_stack_overflow ();
+            *arg_top++ = car (list);
         }
+        argc = arg_top - argv;
     }
-    else if (is_symbol_start (c) || ((c == '+' || c == '-') 
-             && is_delimiter (peek (in))))
+    /* If the procedure is eval, we treat it differently. The first argument
+     * is an expression to evaluate and the second is an environment to
+     * evaluate it in. We analyze the expression and tail call it there
+     */
+    if (type_of (procedure) == PRIM_PROC
+            && procedure->data.prim_proc.fun == eval_proc)
     {
-        int i = 1;
-        char buf[MAX_STRING_LEN];
-        buf[0] = c;
-        while ((c = getc (in)) != EOF && (is_symbol_start (c) 
-                || isdigit (c) || c == '+' || c == '-'))
-        {
-            if (i < MAX_STRING_LEN - 1)
-                buf[i++] = c;
-            else
-            {
-                fprintf (stderr, "symbol too long\n");
-                exit (1);
-            }
-        }
-        if (is_delimiter (c))
-        {
-            buf[i] = '\0';
-            ungetc (c, in);
-            return make_symbol (buf);
-        }
-        else
-        {
-            fprintf (stderr, "need to end symbol with delimiter\n");
-            exit (1);
-        }
+        check_arity (procedure, argc);
+        *next = analyze (argv[0], nil);
+        *env = argv[1];
+        return NULL;
     }
-    else if (c == EOF)
-        exit (0);
-    else
+    /* Otherwise, if it's a primitive (library) procedure, we apply it to
+     * its arguments
+     */
+    if (type_of (procedure) == PRIM_PROC)
+        return apply_primitive (procedure, argc, argv);
+    /* If we are applying a compound (user defined) procedure, we add a
+     * env frame (like a stack frame in C) with the procedure variables and
+     * their supplied values and evaluate the body in that new frame
+     */
+    if (type_of (procedure) == COMPOUND_PROC)
     {
-        fprintf (stderr, "Bad input, unexpected %c\n", c);
-        exit (1);
+        lambda = procedure->data.compound_proc.lambda;
+        *env = extend_env (fixnum_value (node_slot (lambda, 0)), argc, argv,
+                           procedure->data.compound_proc.env);
+        *next = node_slot (lambda, 1);
+        return NULL;
     }
-
-    fprintf (stderr, "read illegal state\n");
-    exit (1);
+    return ok;
 }
 
-bool
-is_self_evaluating (object *o)
-{
-    object_t ty = o->type;
-    return (ty == BOOLEAN || ty == FIXNUM || ty == CHARACTER || ty == STRING);
-}
+/* Each nested execute (a call in operand position, say) recurses on the C
+ * stack. The outermost one notes where the stack stands, and the others check
+ * how far below that they are against the C stack limit, less
+ * C_STACK_SLACK for its callers and for the library code the nodes run. An
+ * unlimited stack is held to C_STACK_UNLIMITED. Running out is reported like
+ * running out of argument stack
+ */
+#define C_STACK_SLACK (256 * 1024)
+#define C_STACK_UNLIMITED (64L * 1024 * 1024)
+static uintptr_t c_stack_base;
+static size_t c_stack_max;
 
-object *
-get_apply_arguments (object *arguments)
+static size_t
+c_stack_budget (void)
 {
-    if ((cdr (arguments))->type == NIL)
-        return car (arguments);
+    struct rlimit limit;
 
-    return cons (car (arguments), get_apply_arguments (cdr (arguments)));
+    if (getrlimit (RLIMIT_STACK, &limit) != 0
+            || limit.rlim_cur == RLIM_INFINITY
+            || limit.rlim_cur > C_STACK_UNLIMITED)
+        return C_STACK_UNLIMITED - C_STACK_SLACK;
+    if (limit.rlim_cur < 2 * C_STACK_SLACK)
+        return limit.rlim_cur / 2;
+    return limit.rlim_cur - C_STACK_SLACK;
 }
 
-/* Evaluator of scheme expressions. Self evaluating atoms are returned as is,
- * while tokens representing operators are applied to arguments. This function
- * simulates tail call optimization by using the same stack for tail recursive
- * calls via a goto and variable renaming
+/* Runs NODE in ENV. Nodes in tail position come back through NEXT and are run
+ * by this loop, so tail calls don't grow the C stack
  */
 object*
-eval (object *exp, object *env)
+execute (object *node, object *env)
 {
+    object *result, *next;
+    size_t roots = gc_save_roots ();
+    uintptr_t here = (uintptr_t)&result;
+    bool outermost = c_stack_base == 0;
 
-tailcall:
-    if (is_self_evaluating (exp))
-        return exp;
-    /* quotes symbol back to screen */
-    else if (has_symbol (quote, exp))
-        return cadr (exp);
-    /* Sets previously defined variable */
-    else if (has_symbol (set, exp))
-    {
-        set_variable (cadr (exp), eval (caddr (exp), env),env);
-        return ok;
-    }
-    /* creates/redefines varisable in current scope */
-    else if (has_symbol (define, exp))
-    {
-        object *def_val, *def_var;
-        /* If the defined thing is bound to a symbol, we define the value as the
-         * supplied value
-         */
-        if ((cadr (exp))->type == SYMBOL)
-            def_val = caddr (exp);
-        /* Otherwise we are usoing the shortform for a lambda, so we create a
-         * lambda expression to eval
-         */
-        else
-           def_val = cons(lambda, cons(cdadr (exp), cddr (exp)));
-        if ((cadr (exp))->type == SYMBOL)
-            def_var = cadr (exp);
-        else
-            def_var = caadr (exp);
+    if (outermost)
+    {
+        c_stack_base = here;
+        if (c_stack_max == 0)
+            c_stack_max = c_stack_budget ();
+    }
+    else if ((here < c_stack_base ? c_stack_base - here : here - c_stack_base)
+             > c_stack_max)
+        arg_stack_overflow ();
+    gc_root (&node);
+    gc_root (&env);
+    for (;;)
+    {
+        next = NULL;
+        result = node->data.node.exec (node, &env, &next);
+        if (next == NULL)
+            break;
+        node = next;
+    }
+    if (outermost)
+        c_stack_base = 0;
+    gc_restore_roots (roots);
+    return result;
+}
+
+static object*
+make_constant_node (object *value)
+{
+    object *node;
+    size_t roots = gc_save_roots ();
+    gc_root (&value);
+    node = make_node (exec_constant, 1);
+    node_slot (node, 0) = value;
+    gc_restore_roots (roots);
+    return node;
+}
+
+/* Builds a node with one slot per expression in EXPS, each analyzed in
+ * SCOPE, starting at slot FIRST */
+static object*
+analyze_operands (exec_fn exec, object *exps, long first, object *scope)
+{
+    object *node = NULL, *child;
+    long i;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&exps);
+    gc_root (&scope);
+    gc_root (&node);
+    node = make_node (exec, first + list_length (exps));
+    for (i = first; type_of (exps) == PAIR; i++, exps = cdr (exps))
+    {
+        child = analyze (car (exps), scope);
+        node_slot (node, i) = child;
+    }
+    gc_restore_roots (roots);
+    return node;
+}
 
-        define_variable (def_var, eval (def_val, env),env);
-        return ok;
+/* Analyzes the expressions of a body or begin. A single expression needs no
+ * sequence node */
+object*
+analyze_sequence (object *exps, object *scope)
+{
+    if (type_of (exps) != PAIR)
+        return make_constant_node (ok);
+    if (type_of (cdr (exps)) != PAIR)
+        return analyze (car (exps), scope);
+    return analyze_operands (exec_sequence, exps, 0, scope);
+}
+
+/* Store to a variable: a frame slot if it is local, otherwise the global
+ * table through set! or define */
+static object*
+analyze_assignment (object *var, object *value, object *scope,
+                    exec_fn global_exec)
+{
+    object *node = NULL, *child, *entry;
+    long depth, index;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&value);
+    gc_root (&scope);
+    gc_root (&node);
+    entry = scope_entry (var, scope, &depth, &index);
+    if (entry != NULL)
+    {
+        node = make_node (type_of (entry) == PAIR ? exec_set_box
+                          : exec_set_local, 3);
+        node_slot (node, 0) = make_fixnum (depth);
+        node_slot (node, 1) = make_fixnum (index);
+        child = analyze (value, scope);
+        node_slot (node, 2) = child;
     }
-    /* Mandated by R5RS, h=implementation of tail calls */
-    else if (has_symbol (begin, exp))
+    else
     {
-        exp = begin_actions (exp);
-        while ((cdr (exp))->type != NIL)
-        {
-            eval (car (exp), env);
-            exp = cdr (exp);
-        }
-        exp = car (exp);
-        goto tailcall;
+        node = make_node (global_exec, 2);
+        node_slot (node, 0) = var;
+        child = analyze (value, scope);
+        node_slot (node, 1) = child;
     }
+    gc_restore_roots (roots);
+    return node;
+}
 
-    else if (has_symbol (ifs, exp))
+/* Analyzes the body of a lambda or let in SCOPE, whose innermost frame is
+ * the one it runs in. If any of that frame's variables live in boxes, the
+ * body starts by putting them there
+ */
+static object*
+analyze_body (object *body, object *scope)
+{
+    object *node = NULL, *vars, *box = NULL;
+    long i, n = 0;
+    size_t roots = gc_save_roots ();
+
+    for (vars = car (scope); type_of (vars) == PAIR; vars = cdr (vars))
+        n += type_of (car (vars)) == PAIR;
+    if (n == 0)
+        return analyze_sequence (body, scope);
+    gc_root (&body);
+    gc_root (&scope);
+    gc_root (&box);
+    box = make_node (exec_box, n);
+    for (i = 0, n = 0, vars = car (scope); type_of (vars) == PAIR;
+            i++, vars = cdr (vars))
+        if (type_of (car (vars)) == PAIR)
+            node_slot (box, n++) = make_fixnum (i);
+    node = analyze_operands (exec_sequence, body, 1, scope);
+    node_slot (node, 0) = box;
+    gc_restore_roots (roots);
+    return node;
+}
+
+/* The closure record of a lambda gets the free variables' slots (or boxes)
+ * from where they are in SCOPE, the body sees it one frame out */
+static object*
+analyze_lambda (object *exp, object *scope)
+{
+    object *node = NULL, *vars = NULL, *free = NULL, *child;
+    long i, depth, index;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&exp);
+    gc_root (&scope);
+    gc_root (&node);
+    gc_root (&vars);
+    gc_root (&free);
+    free = free_variables (exp, scope);
+    node = make_node (exec_lambda, 2 + 2 * list_length (free));
+    for (i = 2, vars = free; type_of (vars) == PAIR; i += 2, vars = cdr (vars))
     {
-        object *if_predicate = cadr(exp);
-        object *if_consequent = caddr(exp);
-        object *if_alternative = (cdddr (exp) == nil)? f : cadddr(exp);
-        object *result = eval (if_predicate, env);
-        if (result != f)
-            exp = if_consequent;
-        else
-            exp = if_alternative;
-        goto tailcall;
+        child = type_of (car (vars)) == PAIR ? caar (vars) : car (vars);
+        find_local (child, scope, &depth, &index);
+        node_slot (node, i) = make_fixnum (depth);
+        node_slot (node, i + 1) = make_fixnum (index);
+    }
+    vars = internal_defines (cddr (exp), cadr (exp));
+    node_slot (node, 0) = make_fixnum (list_length (vars));
+    vars = box_variables (vars, cddr (exp));
+    scope = cons (free, nil);
+    scope = cons (vars, scope);
+    child = analyze_body (cddr (exp), scope);
+    node_slot (node, 1) = child;
+    gc_restore_roots (roots);
+    return node;
+}
+
+/* The named let loops whose bodies are being analyzed, see find_loop */
+static object *named_loops = NIL_OBJ;
+
+/* A let's inits are analyzed in SCOPE and BODY in the scope of its frame.
+ * Calls of the loop NAME (if not NULL) in the body become loop nodes. A
+ * plain let without any variables needs no frame
+ */
+static object*
+analyze_let (object *name, object *bindings, object *body, object *scope)
+{
+    object *node = NULL, *vars = NULL, *child, *loops = named_loops;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&bindings);
+    gc_root (&body);
+    gc_root (&scope);
+    gc_root (&node);
+    gc_root (&vars);
+    vars = let_variables (bindings);
+    vars = internal_defines (body, vars);
+    if (vars == nil && name == NULL)
+    {
+        node = analyze_sequence (body, scope);
+        gc_restore_roots (roots);
+        return node;
     }
-    /* short circuited and and or */
-    else if (has_symbol (and, exp))
+    node = analyze_operands (exec_let, let_inits (bindings), 2, scope);
+    node_slot (node, 0) = make_fixnum (list_length (vars));
+    vars = box_variables (vars, body);
+    scope = cons (vars, scope);
+    if (name != NULL)
     {
-        object *result;
-        exp = cdr (exp);
-        if (exp->type == NIL)
-            return t;
-        while ((cdr (exp))->type != NIL)
-        {
-            result = eval (car (exp), env);
-            if (result == f)
-                return f;
-            exp = cdr (exp);
-        }
-        exp = car (exp);
-        goto tailcall;
+        gc_root (&named_loops);
+        named_loops = cons (cons (name, cons (scope, node)), named_loops);
     }
-    else if (has_symbol (or, exp))
+    child = analyze_body (body, scope);
+    node_slot (node, 1) = child;
+    named_loops = loops;
+    gc_restore_roots (roots);
+    return node;
+}
+
+/* The exec function for a two operand call of the global VAR, open coded if
+ * VAR names one of the fixnum operations */
+static exec_fn
+application_exec (object *var)
+{
+    static const struct
     {
-        object *result;
-        exp = cdr (exp);
-        if (exp->type == NIL)
-            return f;
-        while ((cdr (exp))->type != NIL)
+        char *name;
+        exec_fn exec;
+    } operations[] = {
+        {"+", exec_add}, {"-", exec_sub}, {"*", exec_mul},
+        {"quotient", exec_quotient}, {"remainder", exec_remainder},
+        {"=", exec_number_equal}, {"<", exec_less_than},
+        {">", exec_greater_than}
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof operations / sizeof operations[0]; i++)
+        if (strcmp (var->data.symbol.value, operations[i].name) == 0)
+            return operations[i].exec;
+    return exec_application;
+}
+
+/* Turns EXP into a node tree. SCOPE lists the variables of each enclosing
+ * lambda, innermost first, and is how references are resolved to a frame
+ * depth and slot. Anything not found there is a global
+ */
+object*
+analyze (object *exp, object *scope)
+{
+    object *node = NULL, *vars = NULL, *child;
+    long depth, index;
+    exec_fn exec;
+    size_t roots;
+
+    if (is_self_evaluating (exp))
+        return make_constant_node (exp);
+    if (type_of (exp) == SYMBOL)
+    {
+        child = scope_entry (exp, scope, &depth, &index);
+        if (child == NULL)
         {
-            result = eval (car (exp), env);
-            if (result == t)
-                return t;
-            exp = cdr (exp);
+            node = make_node (exec_global_ref, 4);
+            node_slot (node, 0) = exp;
+            return node;
         }
-        exp = car (exp);
-        goto tailcall;
+        if (type_of (child) == PAIR)
+            exec = exec_box_ref;
+        else
+            exec = depth == 0 ? exec_local_ref0 : exec_local_ref;
+        node = make_node (exec, 2);
+        node_slot (node, 0) = make_fixnum (depth);
+        node_slot (node, 1) = make_fixnum (index);
+        return node;
     }
-    /* Anonymous function definitions */ 
-    else if (has_symbol (lambda, exp))
+    if (type_of (exp) != PAIR)
     {
-        object *params = cadr (exp);
-        object *body = cddr (exp);
-        return make_compound_proc (params, body, env);
+        fprintf (stderr, "expression has unknown type");
+        exit (1);
     }
-    /* Symbol evaluator */
-    else if (exp->type == SYMBOL)
-        return lookup_variable (exp, env);
 
-    /* This is a beast. If we've come here in eval, that means we have a form,
-     * which is a lisp/scheme construct surrounded by parenthesis. We have to
-     * deconstruct the form into it's constituent partys and recursively
-     * evaluate all those parts, which may themselves be forms. Since we've
-     * reached this point we can assume we're at some sort of application
-     */
-    else if (exp->type == PAIR)
-    {
-        /* First we get the procedure and is arguments */
-        object *procedure = eval (car (exp), env);
-        object *arguments = list_of_values (cdr (exp), env);
-        /* If the procedure is apply, we treat it slightly differently. Then the
-         * real procedure is the first argument of apply, and the arguments are
-         * the rest of the members of the form
-         */
-        if (procedure->type == PRIM_PROC 
-                && procedure->data.prim_proc.fun == apply_proc)
+    roots = gc_save_roots ();
+    gc_root (&exp);
+    gc_root (&scope);
+    gc_root (&node);
+    gc_root (&vars);
+    switch (special_form (car (exp)))
+    {
+    /* quotes symbol back to screen */
+    case QUOTE_FORM:
+        node = make_constant_node (cadr (exp));
+        break;
+    case SET_FORM:
+        node = analyze_assignment (cadr (exp), caddr (exp), scope,
+                                   exec_set_global);
+        break;
+    /* Inside a lambda the defined name always has a slot in the current
+     * frame (see internal_defines), so those are plain stores */
+    case DEFINE_FORM:
+        if (type_of (cadr (exp)) == PAIR)
         {
-            procedure = car (arguments);
-            arguments = get_apply_arguments (cdr (arguments));
+            /* (define (name args) body) is shorthand for a lambda */
+            vars = cons (lambda, cons (cdadr (exp), cddr (exp)));
+            node = analyze_assignment (caadr (exp), vars, scope,
+                                       exec_define_global);
         }
-        /* If the procedure is eval, we treat it differently. The first argument
-         * is an expression to evaluate and the second is an environment to
-         * evaluate it in. We get those and tail recursively evaluate the exp
-         */
-        if (procedure->type == PRIM_PROC 
-                && procedure->data.prim_proc.fun == eval_proc)
+        else
+            node = analyze_assignment (cadr (exp), caddr (exp), scope,
+                                       exec_define_global);
+        break;
+    case BEGIN_FORM:
+        node = analyze_sequence (begin_actions (exp), scope);
+        break;
+    case IF_FORM:
+        node = make_node (exec_if, 3);
+        child = analyze (cadr (exp), scope);
+        node_slot (node, 0) = child;
+        child = analyze (caddr (exp), scope);
+        node_slot (node, 1) = child;
+        if (type_of (cdddr (exp)) == NIL)
+            child = make_constant_node (f);
+        else
+            child = analyze (cadddr (exp), scope);
+        node_slot (node, 2) = child;
+        break;
+    case AND_FORM:
+        if (type_of (cdr (exp)) == NIL)
+            node = make_constant_node (t);
+        else
+            node = analyze_operands (exec_and, cdr (exp), 0, scope);
+        break;
+    case OR_FORM:
+        if (type_of (cdr (exp)) == NIL)
+            node = make_constant_node (f);
+        else
+            node = analyze_operands (exec_or, cdr (exp), 0, scope);
+        break;
+    /* Anonymous function definitions. The frame gets a slot for every
+     * parameter and then every internal define of the body */
+    case LAMBDA_FORM:
+        node = analyze_lambda (exp, scope);
+        break;
+    case LET_FORM:
+        if (type_of (cadr (exp)) != SYMBOL)
+            node = analyze_let (NULL, cadr (exp), cddr (exp), scope);
+        else if (is_loop (exp))
+            node = analyze_let (cadr (exp), caddr (exp), cdddr (exp), scope);
+        else
+            node = analyze (expand_named_let (exp), scope);
+        break;
+    case LET_STAR_FORM:
+    case LETREC_FORM:
+    case DO_FORM:
+    case COND_FORM:
+        node = analyze (expand_derived (exp), scope);
+        break;
+    /* Each clause is analyzed as a body, the else clause (if any) goes in
+     * slot 2 */
+    case CASE_FORM:
+        node = make_node (exec_case, 3 + list_length (cddr (exp)));
+        child = analyze (cadr (exp), scope);
+        node_slot (node, 0) = child;
+        child = case_dispatch (cddr (exp));
+        node_slot (node, 1) = child;
+        child = make_constant_node (ok);
+        node_slot (node, 2) = child;
+        for (index = 3, vars = cddr (exp); type_of (vars) == PAIR;
+                index++, vars = cdr (vars))
         {
-            exp = car (arguments);
-            env = cadr (arguments);
-            goto tailcall;
+            child = analyze_sequence (cdar (vars), scope);
+            node_slot (node, caar (vars) == make_symbol ("else") ? 2 : index)
+                = child;
         }
-        /* Otherwise, if it's a primitive (library) procedure, we apply it to
-         * its arguments
-         */
-        if (procedure->type == PRIM_PROC)
-            return (procedure->data.prim_proc.fun)(arguments);
-        /* If we are applying a compound (user defined) procedure, we add a
-         * env frame (like a stack frame in C) with the procedure variables and
-         * their supplied values and evaluate the body in that new frame
-         */
-        else if (procedure->type == COMPOUND_PROC)
+        break;
+    /* Everything else is an application, or the call of a loop */
+    default:
+        child = find_loop (car (exp), named_loops, scope, &depth);
+        if (child != NULL)
         {
-            env = extend_env( 
-                       procedure->data.compound_proc.parameters,
-                       arguments,
-                       procedure->data.compound_proc.env);
-            exp = cons (begin, procedure->data.compound_proc.body);
-            goto tailcall;
+            node = analyze_operands (exec_loop, cdr (exp), 2, scope);
+            node_slot (node, 0) = make_fixnum (depth);
+            node_slot (node, 1) = child;
+            break;
         }
-   }
-   else
-   {
-        fprintf (stderr, "expression has unknown type");
-        exit (1);
-   }
-   return ok;
+        exec = exec_application;
+        if (type_of (car (exp)) == SYMBOL && list_length (cdr (exp)) == 2
+                && !find_local (car (exp), scope, &depth, &index))
+            exec = application_exec (car (exp));
+        node = analyze_operands (exec, cdr (exp), 1, scope);
+        child = analyze (car (exp), scope);
+        node_slot (node, 0) = child;
+        break;
+    }
+    gc_restore_roots (roots);
+    return node;
+}
+
+/* Evaluates EXP in the toplevel environment ENV by analyzing it and running
+ * the resulting nodes
+ */
+object*
+eval (object *exp, object *env)
+{
+    object *node;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&env);
+    node = analyze (exp, nil);
+    node = execute (node, env);
+    gc_restore_roots (roots);
+    return node;
 }
 
 /* checks if a given EXP contains the specified SYMBOL in its car position, used
@@ -926,7 +3269,7 @@ tailcall:
 bool
 has_symbol (object *symbol, object *exp)
 {
-    return (exp->type == PAIR && (car (exp))->type == SYMBOL 
+    return (type_of (exp) == PAIR && type_of (car (exp)) == SYMBOL 
             && (car (exp)) == symbol);
 }
 
@@ -934,22 +3277,33 @@ has_symbol (object *symbol, object *exp)
 void
 write (object *obj)
 {
-    switch (obj->type)
+    switch (type_of (obj))
     {
         case FIXNUM:
-            printf ("%ld", obj->data.fixnum.value);
+            printf ("%ld", fixnum_value (obj));
+            break;
+        case BIGNUM:
+        case FLONUM:
+        {
+            char *digits = number_to_string (obj);
+            printf ("%s", digits);
+            free (digits);
             break;
+        }
         case BOOLEAN:
-            if (obj->data.boolean.value)
+            if (obj == t)
                 printf("#t");
             else
                 printf("#f");
             break;
         case CHARACTER:
-            printf("%c", obj->data.character.value);
+            printf("%c", char_value (obj));
             break;
         case STRING:
-            printf("\"%s\"", obj->data.string.value);
+            putchar ('"');
+            fwrite (obj->data.string.value, 1, obj->data.string.length,
+                    stdout);
+            putchar ('"');
             break;
         case NIL:
             printf("()");
@@ -962,12 +3316,54 @@ write (object *obj)
         case SYMBOL:
             printf ("%s", obj->data.symbol.value);
             break;
+        case NODE:
+        case CODE:
+            printf ("#<code>");
+            break;
         case PRIM_PROC:
             printf ("#<procedure>");
             break;
         case COMPOUND_PROC:
             printf ("#<procedure>");
             break;
+        case TOPLEVEL:
+        case FRAME:
+            printf ("#<environment>");
+            break;
+        case VECTOR:
+        {
+            long i;
+            printf ("#(");
+            for (i = 0; i < obj->data.vector.size; i++)
+            {
+                if (i > 0)
+                    printf (" ");
+                write (vector_elements (obj)[i]);
+            }
+            printf (")");
+            break;
+        }
+        case F64VECTOR:
+        case S64VECTOR:
+        {
+            long i;
+            char *num;
+            printf (obj->type == F64VECTOR ? "#f64(" : "#s64(");
+            for (i = 0; i < obj->data.numvec.length; i++)
+            {
+                if (obj->type == F64VECTOR)
+                {
+                    num = flonum_to_string (f64vector_elements (obj)[i]);
+                    printf ("%s%s", i > 0 ? " " : "", num);
+                    free (num);
+                }
+                else
+                    printf ("%s%lld", i > 0 ? " " : "",
+                            (long long)s64vector_elements (obj)[i]);
+            }
+            printf (")");
+            break;
+        }
         default:
             fprintf (stderr, "Unknown type\n");
             exit (1);
@@ -984,11 +3380,11 @@ write_pair (object* pair)
 
     write(pair->data.pair.car);
     cdr = pair->data.pair.cdr;
-    if (cdr->type == PAIR) {
+    if (type_of (cdr) == PAIR) {
         printf(" ");
         write_pair(cdr);
     }
-    else if (cdr->type == NIL)
+    else if (type_of (cdr) == NIL)
         return;
     else {
         printf(" . ");
@@ -996,17 +3392,24 @@ write_pair (object* pair)
     }
 }
 
+void
+arg_stack_overflow (void)
+{
+    fprintf (stderr, "stack overflow\n");
+    exit (1);
+}
+
 /* The following two functions are dummpy library procedures that exist only so
  * we can bind them to symbols to make them callable. These are never called,
  * but are checked for in eval
  */
 object*
-apply_proc (object *ignore)
+apply_proc (long argc, object **argv)
 {
     return NULL;
 }
 object*
-eval_proc (object *ignore)
+eval_proc (long argc, object **argv)
 {
     return NULL;
 }
@@ -1015,14 +3418,22 @@ object*
 make_env (void)
 {
     object *env = setup_env();
+    size_t roots = gc_save_roots ();
+    gc_root (&env);
     populate_env (env);
+    gc_restore_roots (roots);
     return env;
 }
 
 void
-add_procedure (char *name, object *(*fun)(struct object *arguments), object *env)
+add_procedure (char *name, object *(*fun)(long argc, struct object **argv),
+               long arity, object *env)
 {
-    define_variable (make_symbol (name), make_primitive_proc(fun), env);
+    object *proc = make_primitive_proc (fun, arity);
+    size_t roots = gc_save_roots ();
+    gc_root (&proc);
+    define_variable (make_symbol (name), proc, env);
+    gc_restore_roots (roots);
 }
 
 /* creates all the global objects (the boolean literals for true and false, the
@@ -1032,141 +3443,212 @@ add_procedure (char *name, object *(*fun)(struct object *arguments), object *env
 void
 make_singletons (void)
 {
-    t = alloc_object();
-    t->type = BOOLEAN;
-    t->data.boolean.value = true;
-    f = alloc_object();
-    f->type = BOOLEAN;
-    f->data.boolean.value = false;
-
-    nil = alloc_object();
-    nil->type = NIL;
+    t = TRUE_OBJ;
+    f = FALSE_OBJ;
+    nil = NIL_OBJ;
 
     global_env = make_env ();
 
 
-    quote = make_symbol ("quote");
-    define = make_symbol ("define");
-    set = make_symbol ("set!");
+    quote = make_special_form ("quote", QUOTE_FORM);
+    define = make_special_form ("define", DEFINE_FORM);
+    set = make_special_form ("set!", SET_FORM);
     ok = make_symbol ("ok");
-    ifs = make_symbol ("if");
-    lambda = make_symbol ("lambda");
-    begin = make_symbol ("begin");
-    cond = make_symbol ("cond");
-    and = make_symbol ("and");
-    or = make_symbol ("or");
+    ifs = make_special_form ("if", IF_FORM);
+    lambda = make_special_form ("lambda", LAMBDA_FORM);
+    begin = make_special_form ("begin", BEGIN_FORM);
+    cond = make_special_form ("cond", COND_FORM);
+    and = make_special_form ("and", AND_FORM);
+    or = make_special_form ("or", OR_FORM);
+    let = make_special_form ("let", LET_FORM);
+    make_special_form ("let*", LET_STAR_FORM);
+    make_special_form ("letrec", LETREC_FORM);
+    make_special_form ("letrec*", LETREC_FORM);
+    make_special_form ("do", DO_FORM);
+    make_special_form ("case", CASE_FORM);
 }
 
 /* Adds library procedures to a given argument */
 void
 populate_env (object *env)
 {
-    add_procedure("null?"     , is_null_proc, env);
-    add_procedure("boolean?"  , is_boolean_proc, env);
-    add_procedure("symbol?"   , is_symbol_proc, env);
-    add_procedure("integer?"  , is_integer_proc, env);
-    add_procedure("char?"     , is_char_proc, env);
-    add_procedure("string?"   , is_string_proc, env);
-    add_procedure("pair?"     , is_pair_proc, env);
-    add_procedure("procedure?", is_procedure_proc, env);
+    add_procedure("null?"     , is_null_proc, 1, env);
+    add_procedure("boolean?"  , is_boolean_proc, 1, env);
+    add_procedure("symbol?"   , is_symbol_proc, 1, env);
+    add_procedure("integer?"  , is_integer_proc, 1, env);
+    add_procedure("number?"   , is_number_proc, 1, env);
+    add_procedure("char?"     , is_char_proc, 1, env);
+    add_procedure("string?"   , is_string_proc, 1, env);
+    add_procedure("pair?"     , is_pair_proc, 1, env);
+    add_procedure("procedure?", is_procedure_proc, 1, env);
     
-    add_procedure("char->integer" , char_to_integer_proc, env);
-    add_procedure("integer->char" , integer_to_char_proc, env);
-    add_procedure("number->string", number_to_string_proc, env);
-    add_procedure("string->number", string_to_number_proc, env);
-    add_procedure("symbol->string", symbol_to_string_proc, env);
-    add_procedure("string->symbol", string_to_symbol_proc, env);
+    add_procedure("char->integer" , char_to_integer_proc, 1, env);
+    add_procedure("integer->char" , integer_to_char_proc, 1, env);
+    add_procedure("number->string", number_to_string_proc, 1, env);
+    add_procedure("string->number", string_to_number_proc, 1, env);
+    add_procedure("exact->inexact", exact_to_inexact_proc, 1, env);
+    add_procedure("inexact->exact", inexact_to_exact_proc, 1, env);
+    add_procedure("symbol->string", symbol_to_string_proc, 1, env);
+    add_procedure("string->symbol", string_to_symbol_proc, 1, env);
       
-    add_procedure("+"        , add_proc, env);
-    add_procedure("-"        , sub_proc, env);
-    add_procedure("*"        , mul_proc, env);
-    add_procedure("quotient" , quotient_proc, env);
-    add_procedure("remainder", remainder_proc, env);
-    add_procedure("="        , is_number_equal_proc, env);
-    add_procedure("<"        , is_less_than_proc, env);
-    add_procedure(">"        , is_greater_than_proc, env);
-
-    add_procedure("cons"    , cons_proc, env);
-    add_procedure("car"     , car_proc, env);
-    add_procedure("cdr"     , cdr_proc, env);
-    add_procedure("set-car!", set_car_proc, env);
-    add_procedure("set-cdr!", set_cdr_proc, env);
-    add_procedure("list"    , list_proc, env);
-
-    add_procedure("eq?", is_eq_proc, env);
-    add_procedure("apply", apply_proc, env);
-    add_procedure("eval", eval_proc, env);
-
-    add_procedure("new", new_env_proc, env);
-    add_procedure("currenv", curr_env_proc, env);
-    add_procedure("toplevelenv", toplevel_env_proc, env);
-    add_procedure("eval", eval_proc, env);
-}
-
-
-/* The following functions are used in the symbol table, a chained hash map of
- * symbols
+    add_procedure("+"        , add_proc, VARIADIC (0), env);
+    add_procedure("-"        , sub_proc, VARIADIC (1), env);
+    add_procedure("*"        , mul_proc, VARIADIC (0), env);
+    add_procedure("/"        , divide_proc, VARIADIC (1), env);
+    add_procedure("quotient" , quotient_proc, 2, env);
+    add_procedure("remainder", remainder_proc, 2, env);
+    add_procedure("="        , is_number_equal_proc, VARIADIC (1), env);
+    add_procedure("<"        , is_less_than_proc, VARIADIC (1), env);
+    add_procedure(">"        , is_greater_than_proc, VARIADIC (1), env);
+
+    add_procedure("cons"    , cons_proc, 2, env);
+    add_procedure("car"     , car_proc, 1, env);
+    add_procedure("cdr"     , cdr_proc, 1, env);
+    add_procedure("set-car!", set_car_proc, 2, env);
+    add_procedure("set-cdr!", set_cdr_proc, 2, env);
+    add_procedure("list"    , list_proc, VARIADIC (0), env);
+
+    add_procedure("vector?"      , is_vector_proc, 1, env);
+    add_procedure("make-vector"  , make_vector_proc, VARIADIC (1), env);
+    add_procedure("vector"       , vector_proc, VARIADIC (0), env);
+    add_procedure("vector-length", vector_length_proc, 1, env);
+    add_procedure("vector-ref"   , vector_ref_proc, 2, env);
+    add_procedure("vector-set!"  , vector_set_proc, 3, env);
+    add_procedure("vector->list" , vector_to_list_proc, 1, env);
+    add_procedure("list->vector" , list_to_vector_proc, 1, env);
+
+    add_procedure("eq?", is_eq_proc, 2, env);
+    add_procedure("eqv?", is_eq_proc, 2, env);
+    add_procedure("equal?", is_equal_proc, 2, env);
+    add_procedure("apply", apply_proc, VARIADIC (2), env);
+    add_procedure("eval", eval_proc, 2, env);
+
+    add_procedure("new", new_env_proc, 0, env);
+    add_procedure("currenv", curr_env_proc, 0, env);
+    add_procedure("toplevelenv", toplevel_env_proc, 0, env);
+    add_procedure("eval", eval_proc, 2, env);
+
+    add_numvec_procedures (env);
+    add_hashtable_procedures (env);
+}
+
+
+/* The following functions are used in the symbol table, an open addressing
+ * table of every symbol. Entries cache the hash of their symbol's name, so a
+ * probe only compares names (lengths first) when the hashes match, and
+ * growing the table never hashes a name again. string_hash hashes any LENGTH
+ * bytes, and hash tables use it too
  */
 unsigned
-hash (char *s)
+string_hash (const char *s, size_t length)
 {
-    unsigned hashval;
-    for (hashval = 0; *s != '\0'; s++)
-        hashval = *s + 31 * hashval;
-    return hashval % SYMBOL_TABLE_LEN;
+    unsigned hashval = 2166136261u;
+    while (length-- > 0)
+        hashval = (hashval ^ (unsigned char)*s++) * 16777619u;
+    return hashval;
 }
 
-symbol_table_entry*
-lookup (char *val)
+/* Doubles the symbol table, moving every entry by its cached hash */
+static void
+grow_symbol_table (void)
 {
-    symbol_table_entry *e = symbol_table[hash(val)];
-    while (e != NULL)
+    size_t i, j, capacity = symbol_table_capacity == 0
+                            ? SYMBOL_TABLE_INITIAL_LEN
+                            : symbol_table_capacity * 2;
+    symbol_table_entry *entries = calloc (capacity, sizeof *entries);
+    if (entries == NULL)
     {
-        if (strcmp(e->object->data.symbol.value, val) == 0)
-            return e;
-        e = e->next;
+        fprintf (stderr, "no more memory");
+        exit (1);
     }
-    return NULL;
+    for (i = 0; i < symbol_table_capacity; i++)
+    {
+        if (symbol_table[i].object == NULL)
+            continue;
+        j = symbol_table[i].hash & (capacity - 1);
+        while (entries[j].object != NULL)
+            j = (j + 1) & (capacity - 1);
+        entries[j] = symbol_table[i];
+    }
+    free (symbol_table);
+    symbol_table = entries;
+    symbol_table_capacity = capacity;
 }
 
-symbol_table_entry*
-install (object *obj)
+/* Returns the entry of the symbol named by the LENGTH characters at NAME,
+ * whose hash is HASHVAL, or the empty entry it would go in
+ */
+static symbol_table_entry*
+probe_symbol (const char *name, size_t length, unsigned hashval)
 {
-    unsigned hashval;
-    symbol_table_entry *e = lookup (obj->data.symbol.value);
-    if (e == NULL)
+    size_t mask = symbol_table_capacity - 1, i = hashval & mask;
+    symbol_table_entry *e;
+    while ((e = &symbol_table[i])->object != NULL)
     {
-        e = (symbol_table_entry *)malloc (sizeof (symbol_table_entry));
-        if (e == NULL)
-            return NULL;
-        e->object = obj;
-        hashval = hash (obj->data.symbol.value);
-        e->next = symbol_table[hashval];
-        symbol_table[hashval] = e;
+        if (e->hash == hashval && e->object->data.symbol.length == length
+            && memcmp (e->object->data.symbol.value, name, length) == 0)
+            return e;
+        i = (i + 1) & mask;
     }
-    else
-        free (e->object);
-    e->object = obj;
     return e;
 }
 
-/* Creates a symbol IR and adds it to the symbol table */
-object* 
-make_symbol (char *value)
+/* Returns the symbol named VAL, or NULL if there is none yet */
+object*
+lookup (char *val)
+{
+    size_t length = strlen (val);
+    if (symbol_table_capacity == 0)
+        return NULL;
+    return probe_symbol (val, length, string_hash (val, length))->object;
+}
+
+/* Returns the symbol named by the LENGTH characters at NAME, creating it and
+ * adding it to the symbol table the first time
+ */
+object*
+intern (const char *name, size_t length)
 {
-    symbol_table_entry *e = lookup (value);
-    if (e != NULL && strcmp(e->object->data.symbol.value, value) == 0)
+    unsigned hashval = string_hash (name, length);
+    symbol_table_entry *e;
+    object *obj;
+
+    if ((symbol_table_count + 1) * 4 > symbol_table_capacity * 3)
+        grow_symbol_table ();
+    e = probe_symbol (name, length, hashval);
+    if (e->object != NULL)
         return e->object;
-    object *obj = alloc_object ();
+    obj = alloc_object ();
     obj->type = SYMBOL;
-    obj->data.symbol.value = (char*) malloc(strlen(value)+1);
+    obj->data.symbol.value = malloc (length + 1);
     if (obj->data.symbol.value == NULL)
     {
         fprintf (stderr, "no more memory");
         exit (1);
     }
-    strcpy (obj->data.symbol.value, value);
-    install (obj);
+    memcpy (obj->data.symbol.value, name, length);
+    obj->data.symbol.value[length] = '\0';
+    obj->data.symbol.length = length;
+    obj->data.symbol.form = NOT_SPECIAL;
+    e->object = obj;
+    e->hash = hashval;
+    symbol_table_count++;
+    return obj;
+}
+
+/* Creates a symbol IR and adds it to the symbol table */
+object* 
+make_symbol (char *value)
+{
+    return intern (value, strlen (value));
+}
+
+/* Interns the keyword VALUE and tags it as special form FORM for eval */
+object*
+make_special_form (char *value, special_form_t form)
+{
+    object *obj = make_symbol (value);
+    obj->data.symbol.form = form;
     return obj;
 }
 
@@ -1174,6 +3656,8 @@ void
 interpret(FILE *in, bool silent)
 {
     int instr_count = 1;
+    object *exp = NULL;
+    gc_root (&exp);
     make_singletons ();
     if (!silent)
         printf ("Welcome to Scum, the shitty Scheme interpreter!\n");
@@ -1182,105 +3666,198 @@ interpret(FILE *in, bool silent)
         if (!silent)
         {
             printf ("%d> ", instr_count++);
-            write (eval (read (in), global_env));
+            exp = read (in);
+            write (evaluate (exp, global_env));
             printf ("\n");
         }
         else
         {
-            eval (read (in), global_env);
+            exp = read (in);
+            evaluate (exp, global_env);
         }
     }
     fclose (in);
 }
 
-/* Creates an empty environment */
+/* Creates an empty toplevel environment. Globals live in an open addressing
+ * table keyed by symbol identity, each entry a (symbol . value) cell, so
+ * lookup, define and set! don't depend on how many globals there are
+ */
 object*
 setup_env (void)
 {
-    return extend_env(nil, nil, nil);
+    object *env = alloc_object ();
+    global_version++;
+    env->type = TOPLEVEL;
+    env->data.toplevel.count = 0;
+    env->data.toplevel.capacity = TOPLEVEL_INITIAL_LEN;
+    env->data.toplevel.cells = calloc (TOPLEVEL_INITIAL_LEN, sizeof (object *));
+    if (env->data.toplevel.cells == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    return env;
+}
+
+/* Slot VAR hashes to in a table of CAPACITY entries (a power of two) */
+static size_t
+toplevel_slot (object *var, size_t capacity)
+{
+    return (((uintptr_t)var >> 4) * 2654435761u) & (capacity - 1);
+}
+
+/* Doubles the table of the toplevel ENV, reinserting every cell */
+static void
+grow_toplevel (object *env)
+{
+    size_t i, j, capacity = env->data.toplevel.capacity * 2;
+    object **old = env->data.toplevel.cells;
+    object **cells = calloc (capacity, sizeof (object *));
+    if (cells == NULL)
+    {
+        fprintf (stderr, "no more memory");
+        exit (1);
+    }
+    for (i = 0; i < env->data.toplevel.capacity; i++)
+    {
+        if (old[i] == NULL)
+            continue;
+        j = toplevel_slot (car (old[i]), capacity);
+        while (cells[j] != NULL)
+            j = (j + 1) & (capacity - 1);
+        cells[j] = old[i];
+    }
+    free (old);
+    env->data.toplevel.cells = cells;
+    env->data.toplevel.capacity = capacity;
+}
+
+/* Returns the (symbol . value) cell for VAR in the toplevel ENV, or NULL if
+ * VAR is unbound there
+ */
+object*
+global_cell (object *var, object *env)
+{
+    size_t mask = env->data.toplevel.capacity - 1;
+    size_t i = toplevel_slot (var, env->data.toplevel.capacity);
+    object *cell;
+    while ((cell = env->data.toplevel.cells[i]) != NULL)
+    {
+        if (cell->data.pair.car == var)
+            return cell;
+        i = (i + 1) & mask;
+    }
+    return NULL;
 }
 
-/* Adds a frame to the top of the 'stack' containing the specified variable and
- * value lists. The values in the value list correspond to the symbols in thje
- * vars list in order 
+/* Binds VAR to VAL in the toplevel ENV, reusing the cell if there is one */
+void
+define_global (object *var, object *val, object *env)
+{
+    object *cell = global_cell (var, env);
+    size_t i, mask;
+    if (cell != NULL)
+    {
+        set_cdr (cell, val);
+        return;
+    }
+    cell = cons (var, val);
+    if ((env->data.toplevel.count + 1) * 4 > env->data.toplevel.capacity * 3)
+        grow_toplevel (env);
+    mask = env->data.toplevel.capacity - 1;
+    i = toplevel_slot (var, env->data.toplevel.capacity);
+    while (env->data.toplevel.cells[i] != NULL)
+        i = (i + 1) & mask;
+    env->data.toplevel.cells[i] = cell;
+    env->data.toplevel.count++;
+}
+
+/* Adds a frame to the top of the 'stack' with SIZE slots (a lambda's
+ * parameters followed by its internal defines). Slots are filled from the
+ * ARGC values at ARGV (on the argument stack, so they survive the
+ * allocation), the rest start unassigned
  */
 object 
-*extend_env(object *vars, object *vals, object *base_env) 
+*extend_env(long size, long argc, object **argv, object *base_env) 
 {
-    return cons(make_frame(vars, vals), base_env);
+    object *frame = make_frame (size, base_env);
+    object **slots = frame_slots (frame);
+    long i;
+
+    for (i = 0; i < size && i < argc; i++)
+        slots[i] = argv[i];
+    return frame;
+}
+
+/* Returns the toplevel env at the end of ENV's chain of local frames */
+object*
+toplevel_env (object *env)
+{
+    while (type_of (env) == FRAME)
+        env = enclosing_env (env);
+    return env;
+}
+
+/* Returns the address of slot INDEX of the frame DEPTH frames out of ENV */
+object**
+local_cell (long depth, long index, object *env)
+{
+    for (; depth > 0; depth--)
+        env = enclosing_env (env);
+    return &frame_slots (env)[index];
+}
+
+object*
+lookup_local (long depth, long index, object *env)
+{
+    object *val = *local_cell (depth, index, env);
+    if (val == UNASSIGNED_OBJ)
+    {
+        fprintf (stderr, "Unbound variable, could not lookup\n");
+        exit (1);
+    }
+    return val;
 }
 
 void
-add_binding (object *var, object *val, object *frame)
+set_local (long depth, long index, object *val, object *env)
 {
-    set_car(frame, cons(var, car(frame)));
-    set_cdr(frame, cons(val, cdr(frame)));
+    *local_cell (depth, index, env) = val;
 }
 
-/* looks up a variable in the entirety of the env */
+/* looks up a global variable. Locals never get here, the analyzer has already
+ * resolved them to frame slots */
 object*
 lookup_variable (object *var, object *env)
 {
-    object *frame, *vars, *vals;
-    while (env->type != NIL)
+    object *cell = global_cell (var, toplevel_env (env));
+    if (cell == NULL)
     {
-        frame = first_frame (env);
-        vars = frame_variables(frame);
-        vals = frame_values(frame);
-        while (vars->type != NIL)
-        {
-            if (var == car (vars))
-                return car (vals);
-            vars = cdr (vars);
-            vals = cdr (vals);
-        }
-        env = enclosing_env(env);
+        fprintf (stderr, "Unbound variable, could not lookup\n");
+        exit (1);
     }
-    fprintf (stderr, "Unbound variable, could not lookup\n");
-    exit (1);
+    return cell->data.pair.cdr;
 }
 
 void
 set_variable (object *var, object *val, object *env)
 {
-    object *frame, *vars, *vals;
-    while (env->type != NIL)
+    object *cell = global_cell (var, toplevel_env (env));
+    if (cell == NULL)
     {
-        frame = first_frame (env);
-        vars = frame_variables(frame);
-        vals = frame_values(frame);
-        while (vars->type != NIL)
-        {
-            if (var == car (vars))
-            {
-                set_car (vals, val);
-                return;
-            }
-            vars = cdr (vars);
-            vals = cdr (vals);
-        }
-        env = enclosing_env(env);
+        fprintf (stderr, "Unbound variable, could not set\n");
+        exit (1);
     }
-    fprintf (stderr, "Unbound variable, could not set\n");
-    exit (1);
+    set_cdr (cell, val);
+    global_version++;
 }
 
+/* Defines VAR in the toplevel environment of ENV. Internal defines never get
+ * here, the analyzer turns them into stores to the slot it reserved */
 void
 define_variable (object *var, object *val, object *env)
 {
-    object *frame, *vars, *vals;
-    frame = first_frame (env);
-    vars = frame_variables(frame);
-    vals = frame_values(frame);
-    while (vars->type != NIL)
-    {
-        if (var == car (vars))
-        {
-            set_car (vals, val);
-            return;
-        }
-        vars = cdr (vars);
-        vals = cdr (vals);
-    }
-    add_binding (var, val, frame);
+    define_global (var, val, toplevel_env (env));
+    global_version++;
 }
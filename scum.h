@@ -6,10 +6,14 @@
 #include <ctype.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
 #include <assert.h>
 
-#define MAX_STRING_LEN 1000
-#define SYMBOL_TABLE_LEN 100
+#define SYMBOL_TABLE_INITIAL_LEN 256
+#define TOPLEVEL_INITIAL_LEN 64
+#define SLOTTED_CACHE_LEN 8
+#define READ_CHUNK_LEN 65536
 #define caar(obj)   car(car(obj))
 #define cadr(obj)   car(cdr(obj))
 #define cdar(obj)   cdr(car(obj))
@@ -39,96 +43,378 @@
 #define cdddar(obj) cdr(cdr(cdr(car(obj))))
 #define cddddr(obj) cdr(cdr(cdr(cdr(obj))))
 
-#define enclosing_env(env) cdr(env)
-#define first_frame(env) car(env)
-#define make_frame(vars, vals) cons(vars, vals)
-#define frame_variables(frame) car(frame)
-#define frame_values(frame) cdr(frame)
+#define enclosing_env(env) ((env)->data.frame.parent)
+#define object_slots(obj) ((object **)((obj) + 1))
+#define frame_slots(frame) object_slots(frame)
+#define node_slot(node, i) (object_slots(node)[i])
+#define vector_elements(vec) object_slots(vec)
+#define code_ops(code) ((intptr_t *)(object_slots(code) + (code)->data.code.nconsts))
 
 #define begin_actions(exp) cdr(exp)
 
+/* Special forms eval dispatches on, stored on the keyword's symbol */
+typedef enum { NOT_SPECIAL, QUOTE_FORM, SET_FORM, DEFINE_FORM, BEGIN_FORM,
+               IF_FORM, AND_FORM, OR_FORM, LAMBDA_FORM, LET_FORM,
+               LET_STAR_FORM, LETREC_FORM, DO_FORM, COND_FORM,
+               CASE_FORM} special_form_t;
+
 /* Internal representation of Scheme objects/data */
 typedef enum { SYMBOL, PAIR, FIXNUM, BOOLEAN, CHARACTER, STRING, NIL, PRIM_PROC,
-                COMPOUND_PROC} object_t;
+                COMPOUND_PROC, TOPLEVEL, FRAME, NODE, CODE, BIGNUM, FLONUM,
+                F64VECTOR, S64VECTOR, VECTOR, HASHTABLE, FREE_CELL} object_t;
+
+/* Executes an analyzed node in the environment *ENV. A node in tail position
+ * may instead store the node to continue with in *NEXT (and a new
+ * environment in *ENV) and return NULL, see execute */
+typedef struct object *(*exec_fn) (struct object *node, struct object **env,
+                                   struct object **next);
 
 typedef struct object
 {
     object_t type;
+    /* set by the garbage collector when the object is reachable from a root */
+    bool marked;
     union 
     {
-        struct 
-        {
-            long value;
-        } fixnum;
-        struct
-        {
-            bool value;
-        } boolean;
-        struct
-        {
-            char value;
-        } character;
+        /* LENGTH characters and a null at VALUE, in a block of CAPACITY
+         * bytes */
         struct
         {
             char *value;
+            size_t length;
+            size_t capacity;
         } string;
         struct
+        {
+            double value;
+        } flonum;
+        struct
         {
             struct object *car;
             struct object *cdr;
         } pair;
+        /* LENGTH characters and a null at VALUE */
         struct
         {
             char *value;
+            size_t length;
+            special_form_t form;
         } symbol;
         struct
         {
-            struct object *(*fun)(struct object *arguments);
+            struct object *(*fun)(long argc, struct object **argv);
+            long arity;
         } prim_proc;
         struct
         {
-            struct object *parameters;
-            struct object *body;
+            struct object *lambda;
             struct object *env;
         } compound_proc;
+        struct
+        {
+            size_t count;
+            size_t capacity;
+            struct object **cells;
+        } toplevel;
+        struct
+        {
+            struct hash_table *table;
+        } hashtable;
+        /* frames, nodes and code are followed by SIZE slots in the same
+         * block, see object_slots. All start with the same NEXT and SIZE
+         * fields */
+        struct
+        {
+            struct object *next;
+            long size;
+            struct object *parent;
+        } frame;
+        struct
+        {
+            struct object *next;
+            long size;
+            exec_fn exec;
+        } node;
+        /* compiled bytecode, the first NCONSTS slots are its constants and
+         * the rest hold the instructions, see code_ops */
+        struct
+        {
+            struct object *next;
+            long size;
+            int nconsts;
+            int frame_size;
+        } code;
+        /* an integer too big for a fixnum, LENGTH 32 bit limbs of its
+         * magnitude (least significant first) packed into the slots, see
+         * number.c */
+        struct
+        {
+            struct object *next;
+            long size;
+            int sign;
+            int length;
+        } bignum;
+        /* a vector's SIZE elements are its slots */
+        struct
+        {
+            struct object *next;
+            long size;
+        } vector;
+        /* f64vectors and s64vectors keep their LENGTH elements unboxed in
+         * the slots, see numvec.c */
+        struct
+        {
+            struct object *next;
+            long size;
+            long length;
+        } numvec;
     } data;
 } object;
 
+/* Fixnums, characters, booleans and the empty list are immediates, encoded in
+ * the object pointer itself and never allocated. Heap cells are at least 8
+ * byte aligned, so a pointer with any of its low 3 bits set is one of
+ *     ...xxx1  fixnum, the value shifted left one bit
+ *     ...x010  character, the value shifted left three bits
+ *     ...x110  #f, #t or (), see FALSE_OBJ, TRUE_OBJ and NIL_OBJ
+ */
+#define TAG_MASK    7
+#define FIXNUM_TAG  1
+#define CHAR_TAG    2
+#define FALSE_OBJ   ((object *)0x06)
+#define TRUE_OBJ    ((object *)0x0e)
+#define NIL_OBJ     ((object *)0x16)
+/* marks a frame slot whose internal define hasn't run yet */
+#define UNASSIGNED_OBJ ((object *)0x1e)
+
+#define is_immediate(obj)  (((uintptr_t)(obj) & TAG_MASK) != 0)
+#define is_fixnum(obj)     (((uintptr_t)(obj) & FIXNUM_TAG) != 0)
+#define fixnum_value(obj)  ((long)((intptr_t)(obj) >> 1))
+#define char_value(obj)    ((char)((uintptr_t)(obj) >> 3))
+
+/* The range of fixnums. Arithmetic on fixnums checks its result against it
+ * and goes to number.c (which makes BIGNUMs) when it overflows */
+#define FIXNUM_MAX (LONG_MAX >> 1)
+#define FIXNUM_MIN (-FIXNUM_MAX - 1)
+#define fixnum_fits(v) ((v) >= FIXNUM_MIN && (v) <= FIXNUM_MAX)
+
+/* Stores A * B in *P, returning false if it isn't a fixnum */
+static inline bool
+fixnum_mul (long a, long b, long *p)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if (__builtin_mul_overflow (a, b, p))
+        return false;
+#else
+    if (a != 0 && (b > LONG_MAX / (a < 0 ? -a : a)
+                   || b < -(LONG_MAX / (a < 0 ? -a : a))))
+        return false;
+    *p = a * b;
+#endif
+    return fixnum_fits (*p);
+}
+
+static inline object_t
+type_of (object *obj)
+{
+    if (is_fixnum (obj))
+        return FIXNUM;
+    switch ((uintptr_t)obj & TAG_MASK)
+    {
+        case 0:
+            return obj->type;
+        case CHAR_TAG:
+            return CHARACTER;
+        default:
+            return obj == NIL_OBJ ? NIL : BOOLEAN;
+    }
+}
+
+/* Returns the special form OBJ names, if it is a keyword symbol */
+static inline special_form_t
+special_form (object *obj)
+{
+    return type_of (obj) == SYMBOL ? obj->data.symbol.form : NOT_SPECIAL;
+}
+
+/* Calls the primitive PROC on the ARGC arguments at ARGV, which must be on
+ * the argument stack, after checking them against its declared arity:
+ * exactly ARITY arguments, or at least N for VARIADIC (N) */
+#define VARIADIC(n) (-(n) - 1)
+
+static inline void
+check_arity (object *proc, long argc)
+{
+    long arity = proc->data.prim_proc.arity;
+    if (arity >= 0 ? argc != arity : argc < -arity - 1)
+    {
+        fprintf (stderr, "wrong number of arguments to a primitive\n");
+        exit (1);
+    }
+}
+
+static inline object*
+apply_primitive (object *proc, long argc, object **argv)
+{
+    check_arity (proc, argc);
+    return proc->data.prim_proc.fun (argc, argv);
+}
+
 /* Functions and data structures used to create variables in scopes
  * (collectively called the environment )
  */
-void add_binding (object*, object*, object*);
 object* lookup_variable (object *, object *);
 void set_variable (object *, object *, object*);
 void define_variable (object*, object*, object*);
 object *setup_env(void);
-object *extend_env (object*, object*, object*);
+object *extend_env (long, long, object **, object*);
 void populate_env (object*);
 object *make_env (void);
-void add_procedure (char *, object*(object*) , object *);
+object *toplevel_env (object *);
+object *global_cell (object *, object *);
+extern unsigned long global_version;
+void define_global (object *, object *, object *);
+object *alloc_slotted (object_t, long);
+object *make_frame (long, object *);
+object **local_cell (long, long, object *);
+object *lookup_local (long, long, object *);
+void set_local (long, long, object *, object *);
+void add_procedure (char *, object *(*)(long, object **), long, object *);
+
+/* A cursor over buffered input. A reader over memory has no FILE, one over a
+ * FILE owns BUF and refills it from the FILE (which was at OFFSET after the
+ * last refill) as the cursor reaches END */
+typedef struct reader
+{
+    const char *pos, *end;
+    char *buf;
+    size_t cap;
+    FILE *file;
+    long offset;
+} reader;
 
 /* Functions used to read input from files ansd tokenize that input */
 bool is_delimiter (int);
+int peek_char (reader*);
+int next_char (reader*);
+void skip_whitespace (reader*);
 int peek (FILE*);
 void rem_whitespace (FILE*);
-bool is_next_input (FILE*, char*);
-char read_character (FILE*);
+bool is_next_input (reader*, char*);
+char read_character (reader*);
+object *read_datum (reader*);
 object *read(FILE*);
-void read_string (FILE*, char*);
-object *read_pair (FILE*);
+object *read_from_buffer (const char*, size_t);
+object *read_string (reader*);
+object *read_atom (reader*, int);
+object *read_number (reader*, int);
 bool is_symbol_start (int);
 
+/* Vectorized scanning of the reader's input, in scan.c */
+const char *scan_whitespace (const char *, const char *);
+const char *scan_string (const char *, const char *);
+const char *scan_symbol (const char *, const char *);
+
 /* Functions to create IR structures/tokens from string file input */
 object *alloc_object (void);
 object *make_fixnum (long);
 object *make_boolean (bool);
 object *make_character (char);
 object *make_string (char*);
-object *make_primitive_proc (object *(*fun)(struct object *arguments));
-object *make_compound_proc (object *, object *, object *);
+object *make_string_len (const char*, size_t);
+object *adopt_string (char*, size_t, size_t);
+object *make_primitive_proc (object *(*fun)(long argc, struct object **argv),
+                             long);
+object *make_compound_proc (object *, object *);
+
+/* Functions for the mark and sweep garbage collector. Objects held only in C
+ * variables must be registered as roots while an allocation can happen */
+#define GC_DEFAULT_THRESHOLD 100000
+#define SLAB_SIZE 65536
+void gc_root (object **);
+size_t gc_save_roots (void);
+void gc_restore_roots (size_t);
+
+/* The argument stack, see arg_stack in scum.c */
+#define ARG_STACK_LEN (1 << 20)
+extern object *arg_stack[ARG_STACK_LEN];
+extern object **arg_top;
+void arg_stack_overflow (void);
+void gc_collect (void);
+void gc_set_threshold (size_t);
+size_t gc_heap_size (void);
+size_t gc_allocations (void);
+
+/* Functions for the analyzer, which turns an expression into a tree of nodes
+ * once (resolving local variables to frame slots) so evaluation only has to
+ * run the nodes */
+object *internal_defines (object *, object *);
+object *append (object *, object *);
+object *let_variables (object *);
+object *let_inits (object *);
+object *expand_derived (object *);
+object *expand_named_let (object *);
+bool is_loop (object *);
+object *case_dispatch (object *);
+long case_clause (object *, object *);
+object *find_loop (object *, object *, object *, long *);
+object *make_node (exec_fn, long);
+object *analyze (object *, object *);
+object *analyze_sequence (object *, object *);
+bool find_local (object *, object *, long *, long *);
+object *scope_entry (object *, object *, long *, long *);
+object *free_variables (object *, object *);
+object *box_variables (object *, object *);
+long list_length (object *);
+
+/* Functions for the bytecode compiler and virtual machine in vm.c, an
+ * alternative to the analyzer used by scum-vm. Both share the object
+ * representation, so results can be compared */
+object *compile (object *);
+object *vm_execute (object *, object *);
+object *vm_eval (object *, object *);
+
+/* Integer arithmetic in number.c, on fixnums and BIGNUMs alike */
+object *make_integer (long);
+object *integer_add (object *, object *);
+object *integer_sub (object *, object *);
+object *integer_mul (object *, object *);
+object *integer_quotient (object *, object *);
+object *integer_remainder (object *, object *);
+object *integer_negate (object *);
+int integer_compare (object *, object *);
+char *integer_to_string (object *);
+object *string_to_integer (const char *);
+#define is_integer(obj) (is_fixnum (obj) || type_of (obj) == BIGNUM)
+bool integer_to_s64 (object *, int64_t *);
+
+/* Generic arithmetic: exact while both operands are integers, a flonum as
+ * soon as one of them is */
+#define flonum_value(obj) ((obj)->data.flonum.value)
+#define is_number(obj) (is_integer (obj) || type_of (obj) == FLONUM)
+/* what number_compare returns when a NaN makes its operands unordered */
+#define UNORDERED 2
+object *make_flonum (double);
+double number_to_double (object *);
+object *double_to_integer (double);
+object *number_add (object *, object *);
+object *number_sub (object *, object *);
+object *number_mul (object *, object *);
+object *number_divide (object *, object *);
+int number_compare (object *, object *);
+char *flonum_to_string (double);
+char *number_to_string (object *);
+
+/* Homogeneous numeric vectors in numvec.c */
+#define f64vector_elements(obj) ((double *)object_slots (obj))
+#define s64vector_elements(obj) ((int64_t *)object_slots (obj))
+void add_numvec_procedures (object *);
 
 /* Functions used to evaluate Scheme code */
+extern object *(*evaluate) (object *, object *);
 object *eval (object*, object *);
+object *execute (object*, object *);
+object *apply_procedure (long, object **, object **, object **);
 bool has_symbol (object*, object*);
 bool is_self_evaluating (object *);
 
@@ -143,28 +429,63 @@ object *cdr (object*);
 void set_car (object *, object *);
 void set_cdr (object *, object *);
 
-/* Functions and data structures for managing the symbol table */
+/* Equivalence predicates, eq? also serves as eqv? */
+bool is_eq (object *, object *);
+bool is_equal (object *, object *);
+
+/* Hash tables in hashtable.c */
+struct hash_table;
+void free_hash_table (struct hash_table *);
+void mark_hash_table (struct hash_table *, void (*) (object *));
+void add_hashtable_procedures (object *);
+object *make_hash_table (bool);
+object *hash_table_get (object *, object *);
+void hash_table_put (object *, object *, object *);
+
+/* Functions for vectors */
+object *make_vector (long, object *);
+object *list_to_vector (object *);
+
+/* Functions and data structures for managing the symbol table. An empty
+ * entry has no OBJECT, a full one caches the hash of its symbol's name */
 typedef struct symbol_table_entry
 {
     object *object;
-    struct symbol_table_entry *next;
+    unsigned hash;
 } symbol_table_entry;
-unsigned hash (char *);
-symbol_table_entry *lookup (char *);
-symbol_table_entry *install (object *);
+unsigned string_hash (const char *, size_t);
+object *lookup (char *);
+object *intern (const char *, size_t);
 object *make_symbol (char *);
+object *make_special_form (char *, special_form_t);
+
+/* Library procedures the analyzer and the VM open code for fixnums */
+#define is_primitive(obj, fn) \
+    (type_of (obj) == PRIM_PROC && (obj)->data.prim_proc.fun == (fn))
+object *add_proc (long, object **);
+object *sub_proc (long, object **);
+object *mul_proc (long, object **);
+object *quotient_proc (long, object **);
+object *remainder_proc (long, object **);
+object *is_number_equal_proc (long, object **);
+object *is_less_than_proc (long, object **);
+object *is_greater_than_proc (long, object **);
+
+/* The equivalences hash tables can be keyed by */
+object *is_eq_proc (long, object **);
+object *is_equal_proc (long, object **);
 
 /* For APPLY and EVAL trickery */
-object *apply_proc (object *);
-object *get_apply_arguments(object *);
-object *eval_proc (object *);
+object *apply_proc (long, object **);
+object *eval_proc (long, object **);
 
-static symbol_table_entry *symbol_table[SYMBOL_TABLE_LEN];
+extern symbol_table_entry *symbol_table;
+extern size_t symbol_table_count, symbol_table_capacity;
 
 void make_singletons (void);
 
 void interpret (FILE *, bool);
 
-static object *t, *f, *nil, *quote, *define, *set, *ok, *ifs, *plus, *lambda, *global_env, *begin,
-              *cond, *and, *or;
+extern object *t, *f, *nil, *quote, *define, *set, *ok, *ifs, *plus, *lambda, *global_env, *begin,
+              *cond, *and, *or, *let;
 #endif
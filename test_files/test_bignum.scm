@@ -0,0 +1,10 @@
+(define (fact n) (if (= n 0) 1 (* n (fact (- n 1)))))
+(define big (* (fact 30) (fact 40)))
+(define a (* 100000000000000000000001 100000000000000000000001 7))
+(list (number->string (fact 30))
+      (= (quotient big (fact 40)) (fact 30))
+      (remainder (+ big 7) (fact 30))
+      (- (+ 4611686018427387903 1) 1)
+      (- -123456789012345678901234567890 -123456789012345678901234567891)
+      (= (/ a 7) (* 100000000000000000000001 100000000000000000000001))
+      (/ a 7 1000000000000000000000000000007))
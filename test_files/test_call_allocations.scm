@@ -0,0 +1,2 @@
+(define (down n) (if (= n 0) n (down (- n 1))))
+(down 10000)
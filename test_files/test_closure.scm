@@ -0,0 +1,46 @@
+(define (make-counter)
+  (let ((n 0))
+    (lambda () (set! n (+ n 1)) n)))
+(define c1 (make-counter))
+(define c2 (make-counter))
+(c1)
+(c1)
+(c2)
+(define (make-account balance)
+  (define (withdraw amount) (set! balance (- balance amount)) balance)
+  (define (deposit amount) (set! balance (+ balance amount)) balance)
+  (lambda (op amount)
+    (if (eq? op 'withdraw) (withdraw amount) (deposit amount))))
+(define acc (make-account 100))
+(acc 'withdraw 30)
+(define (curry3 f) (lambda (a) (lambda (b) (lambda (c) (f a b c)))))
+(define (parity n)
+  (define (even? n) (if (= n 0) #t (odd? (- n 1))))
+  (define (odd? n) (if (= n 0) #f (even? (- n 1))))
+  (even? n))
+(define (shared)
+  (let ((x 1))
+    (let ((get (lambda () x)) (set (lambda (v) (set! x v))))
+      (set 42)
+      (list (get) x))))
+(define (adders n)
+  (let loop ((i 0) (fs '()))
+    (if (= i n) fs (loop (+ i 1) (cons (lambda (x) (+ x i)) fs)))))
+(define (late)
+  (define f (lambda () g))
+  (define g 'defined-later)
+  (f))
+(define (deep a)
+  (lambda (b)
+    (let ((c (+ a b)))
+      (lambda (d) (set! a (+ a 1)) (list a b c d)))))
+(define d ((deep 1) 10))
+(d 100)
+(define (keep-one n)
+  (let ((junk (let loop ((i 0) (l '())) (if (= i n) l (loop (+ i 1) (cons i l)))))
+        (x 1))
+    (lambda () x)))
+(define one (keep-one 20000))
+(list (c1) (c2) (acc 'deposit 5) ((((curry3 list) 1) 2) 3) (parity 11)
+      (shared) ((car (adders 3)) 10) (late) (d 100)
+      (let ((x 5)) ((lambda () (set! x (* x 2)) x))))
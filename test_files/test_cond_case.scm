@@ -0,0 +1,48 @@
+(define (map1 f l) (if (null? l) (quote ()) (cons (f (car l)) (map1 f (cdr l)))))
+(define (classify n)
+  (cond ((< n 0) 'negative)
+        ((= n 0) 'zero)
+        ((assv n '((1 . one) (2 . two))) => cdr)
+        ((> n 100))
+        (else 'positive)))
+(define (assv x l)
+  (cond ((null? l) #f)
+        ((eqv? x (car (car l))) (car l))
+        (else (assv x (cdr l)))))
+(define (count-down n)
+  (cond ((= n 0) 'done)
+        (else (count-down (- n 1)))))
+(define (kind x)
+  (case x
+    ((a e i o u) 'vowel)
+    ((#\a #\b) 'char)
+    ((1 2 3) 'small)
+    (else 'other)))
+(define (opcode op)
+  (case op
+    ((push) 1) ((pop) 2) ((add) 3) ((sub) 4) ((mul) 5) ((div) 6)
+    ((jump) 7) ((call) 8) ((ret) 9) ((load store) 10) ((1000000000000) 11)
+    ((#\x) 12) ((push) 13)))
+(define (run ops acc)
+  (if (null? ops)
+      acc
+      (case (car ops)
+        ((inc) (run (cdr ops) (+ acc 1)))
+        ((dec) (run (cdr ops) (- acc 1)))
+        (else (run (cdr ops) acc)))))
+(define (many n acc)
+  (if (= n 0) acc (many (- n 1) (cons 'inc acc))))
+(list (map1 classify '(-5 0 1 2 50 500))
+      (count-down 100000)
+      (map1 kind '(a z #\b 3 4))
+      (map1 opcode '(push pop add sub mul div jump call ret load store
+                     1000000000000 #\x nope))
+      (run (many 100000 '()) 0)
+      (cond)
+      (cond (#f 1))
+      (let loop ((i 0))
+        (case i ((5) i) (else (loop (+ i 1)))))
+      (let loop ((i 0))
+        (cond ((= i 5) i) (else (loop (+ i 1)))))
+      (cond (5) (else 'x))
+      (cond ((assv 2 '((1 . one) (2 . two)))) (else 'x)))
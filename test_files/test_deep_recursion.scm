@@ -0,0 +1,2 @@
+(define (g n) (+ 1 (g n)))
+(g 0)
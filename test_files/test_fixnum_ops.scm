@@ -0,0 +1,6 @@
+(define (ops a b)
+  (list (+ a b) (- a b) (* a b) (quotient a b) (remainder a b)
+        (= a b) (< a b) (> a b)))
+(define before (ops 17 -5))
+(define (quotient a b) 100)
+(list before (ops 17 -5))
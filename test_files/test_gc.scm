@@ -0,0 +1,4 @@
+(define (loop n acc)
+  (if (eq? n 0) acc
+    (loop (- n 1) (cons n '()))))
+(loop 200000 '())
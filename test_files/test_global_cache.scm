@@ -0,0 +1,8 @@
+(define (op a b) (+ a b))
+(define (use) (op 3 4))
+(define x (use))
+(set! op (lambda (a b) (* a b)))
+(define y (use))
+(set! op (lambda (a b) (+ a b)))
+(define + -)
+(list x y (use))
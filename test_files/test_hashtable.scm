@@ -0,0 +1,23 @@
+(define (fill! t i n)
+  (if (< i n)
+      (begin (hash-table-set! t i (* i i))
+             (fill! t (+ i 1) n))))
+(define (delete-evens! t i n)
+  (if (< i n)
+      (begin (hash-table-delete! t i)
+             (delete-evens! t (+ i 2) n))))
+(define (sum t i n acc)
+  (if (< i n)
+      (sum t (+ i 1) n (+ acc (hash-table-ref t i 0)))
+      acc))
+(define squares (make-hash-table eqv?))
+(fill! squares 0 1000)
+(delete-evens! squares 0 1000)
+(define names (make-hash-table))
+(hash-table-set! names (list "a" 1) 'first)
+(hash-table-set! names "b" 'second)
+(list (hash-table-count squares)
+      (sum squares 0 1000 0)
+      (hash-table-ref names (list "a" 1))
+      (hash-table-ref/default names "c" 'none)
+      (hash-table-contains? squares 999))
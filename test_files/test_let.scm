@@ -0,0 +1,31 @@
+(define x 10)
+(define (evens n)
+  (letrec ((even? (lambda (n) (if (= n 0) #t (odd? (- n 1)))))
+           (odd? (lambda (n) (if (= n 0) #f (even? (- n 1))))))
+    (even? n)))
+(define (range n)
+  (let loop ((i (- n 1)) (acc '()))
+    (if (< i 0) acc (loop (- i 1) (cons i acc)))))
+(define (squares n)
+  (do ((vec (make-vector n)) (i 0 (+ i 1)))
+      ((= i n) vec)
+    (vector-set! vec i (* i i))))
+(define (thunks n)
+  (let loop ((i 0) (fs '()))
+    (if (= i n) fs (loop (+ i 1) (cons (lambda () i) fs)))))
+(define (table n)
+  (let outer ((i 0) (acc 0))
+    (if (= i n)
+        acc
+        (let inner ((j 0) (acc acc))
+          (if (= j n) (outer (+ i 1) acc) (inner (+ j 1) (+ acc (* i j))))))))
+(list (let ((x 1) (y x)) (list x y))
+      (let* ((x 1) (y (+ x 1))) (list x y))
+      (evens 1001)
+      (range 5)
+      (squares 4)
+      ((car (thunks 3)))
+      (table 10)
+      (let loop ((i 0)) (if (< i 3) (+ 1 (loop (+ i 1))) 0))
+      (let ((a 1)) (define b 2) (+ a b))
+      (let loop ((i 0)) (let ((loop (lambda (x) 'shadowed))) (loop i))))
@@ -0,0 +1,6 @@
+(define (f x)
+  (define y (* x 2))
+  (define (g z) (+ x y z))
+  (g 1))
+(define (shadow x) ((lambda (x) (* x 10)) (+ x 1)))
+(+ (f 5) (shadow 3))
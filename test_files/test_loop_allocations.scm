@@ -0,0 +1,2 @@
+(define (count n) (let loop ((i 0)) (if (< i n) (loop (+ i 1)) i)))
+(do ((i 0 (+ i 1)) (sum 0 (+ sum (count 10)))) ((= i 10000) sum))
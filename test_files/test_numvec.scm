@@ -0,0 +1,9 @@
+(define v (f64vector 1 2 3 4 5 6 7))
+(define s (list->s64vector '(3 -1 4 1 -5 9 2 6 5)))
+(list (+ 1.5 2)
+      (/ 6 3)
+      (f64vector-dot v (f64vector-scale v 2))
+      (f64vector-ref (f64vector-add v (f64vector-mul v v)) 6)
+      (f64vector-min (f64vector-add v (make-f64vector 7 -10)))
+      (s64vector-sum (s64vector-add s s))
+      (s64vector-max (s64vector-scale s -1)))
@@ -0,0 +1,10 @@
+(define v (make-vector 5 0))
+(define (fill! i)
+  (if (< i 5)
+      (begin (vector-set! v i (* i i))
+             (fill! (+ i 1)))))
+(fill! 0)
+(list v
+      (vector-ref #(a b c) 2)
+      (vector-length (list->vector '(1 2 3)))
+      (vector->list (vector 1 2)))
@@ -0,0 +1,3 @@
+(define (count n) (if (= n 0) 0 (+ 1 (count (- n 1)))))
+(define (sum l) (if (null? l) 0 (+ (car l) (sum (cdr l)))))
+(+ (count 1000) (apply + 1 2 '(3)) (sum (list 1 2 3)) (eval '(- 5 5) (currenv)))
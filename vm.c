@@ -0,0 +1,1004 @@
+/*
+ * A bytecode compiler and virtual machine for scum. Expressions are compiled
+ * to CODE objects, whose instructions keep their values on the argument
+ * stack, which also holds the return information of non-tail calls.
+ * Environments, closures and primitives are the same objects eval uses, so
+ * the two can be compared on the same programs (scum-vm runs this, scum runs
+ * eval)
+ */
+#include "scum.h"
+
+/* room left on the argument stack at each call for the temporaries of the
+ * callee's expressions */
+#define VM_STACK_SLACK 4096
+
+/* With GCC and clang instructions are dispatched by computed goto, each
+ * handler jumping straight to the next one. Build with -DVM_SWITCH for the
+ * portable switch loop
+ */
+#if defined (__GNUC__) && !defined (VM_SWITCH)
+#define VM_THREADED
+#endif
+
+/* The instruction set. Operands follow the opcode in the instruction stream:
+ * constant indexes (K), frame depth and slot (D I), jump targets as offsets
+ * from the start of the code (L) and argument counts (N)
+ *     CONST K                 push constant K
+ *     LOCAL_REF0 I            push slot I of the current frame
+ *     LOCAL_REF D I           push slot I of the frame D frames out
+ *     GLOBAL_REF K C C C      push the global named by constant K
+ *     SET_LOCAL D I           store the top into a slot, replace it by ok
+ *     SET_GLOBAL K            set! the global K to the top, replace it by ok
+ *     DEFINE_GLOBAL K         define the global K, replace the top by ok
+ *     POP                     drop the top
+ *     JUMP L                  continue at L
+ *     JUMP_IF_FALSE L         pop, continue at L if it was #f
+ *     JUMP_IF_FALSE_OR_POP L  continue at L if the top is #f, else pop it
+ *     JUMP_IF_TRUE_OR_POP L   continue at L if the top is #t, else pop it
+ *     BOX_REF D I             push the value in the box in a slot
+ *     SET_BOX D I             store the top into the box in a slot, replace
+ *                             it by ok
+ *     BOX I                   put slot I of the current frame in a box
+ *     CLOSURE K N D I ...     push a closure of lambda K, with a record of
+ *                             the N slots at D I ... (see free_variables)
+ *     CASE K N L0 ... LN      pop a key, continue at the L of the clause it
+ *                             selects in the case_dispatch K, LN if none
+ *     ENTER N S               pop N values into a new frame of S slots
+ *     LEAVE                   return to the frame around the current one
+ *     LOOP D N L              pop N values into the frame D frames out,
+ *                             continue at L in that frame
+ *     CALL N                  call the procedure below N arguments
+ *     TAIL_CALL N             the same, replacing the current call
+ *     RETURN                  return the top to the caller
+ *     ADD K C C C, SUB, MUL, QUOTIENT, REMAINDER, NUM_EQ, LT, GT
+ *                             two fixnums on the top, while the global K is
+ *                             still the library procedure, else a call of K
+ * The C operands of instructions that look up a global are its inline cache,
+ * see cached_global
+ */
+#define OPCODES(X) \
+    X (OP_CONST) X (OP_LOCAL_REF0) X (OP_LOCAL_REF) X (OP_GLOBAL_REF) \
+    X (OP_SET_LOCAL) X (OP_SET_GLOBAL) X (OP_DEFINE_GLOBAL) X (OP_BOX_REF) \
+    X (OP_SET_BOX) X (OP_BOX) X (OP_POP) \
+    X (OP_JUMP) X (OP_JUMP_IF_FALSE) X (OP_JUMP_IF_FALSE_OR_POP) \
+    X (OP_JUMP_IF_TRUE_OR_POP) X (OP_CLOSURE) X (OP_CASE) X (OP_ENTER) \
+    X (OP_LEAVE) X (OP_LOOP) X (OP_CALL) X (OP_TAIL_CALL) X (OP_RETURN) X (OP_ADD) X (OP_SUB) X (OP_MUL) X (OP_QUOTIENT) \
+    X (OP_REMAINDER) X (OP_NUM_EQ) X (OP_LT) X (OP_GT)
+
+#define OPCODE_ENUM(op) op,
+typedef enum { OPCODES (OPCODE_ENUM) } opcode_t;
+
+/* The code being generated for one lambda body (or toplevel expression).
+ * CONSTS is a list of the constants, most recently added first
+ */
+typedef struct compiler
+{
+    intptr_t *ops;
+    long len;
+    long cap;
+    object *consts;
+    long nconsts;
+} compiler;
+
+static void compile_exp (compiler *, object *, object *, bool);
+
+/* The named let loops whose bodies are being compiled, the target of each
+ * is the offset of its body (see find_loop) */
+static object *named_loops = NIL_OBJ;
+
+static void
+emit (compiler *c, intptr_t word)
+{
+    if (c->len == c->cap)
+    {
+        c->cap = c->cap ? c->cap * 2 : 32;
+        c->ops = realloc (c->ops, c->cap * sizeof *c->ops);
+        if (c->ops == NULL)
+        {
+            fprintf (stderr, "no more memory");
+            exit (1);
+        }
+    }
+    c->ops[c->len++] = word;
+}
+
+/* Returns the index of OBJ among the constants, adding it if needed */
+static long
+constant (compiler *c, object *obj)
+{
+    object *l;
+    long i = c->nconsts - 1;
+    for (l = c->consts; type_of (l) == PAIR; l = cdr (l), i--)
+        if (car (l) == obj)
+            return i;
+    c->consts = cons (obj, c->consts);
+    return c->nconsts++;
+}
+
+/* Emits a jump with an unknown target, which is linked into the chain of
+ * jumps starting at *CHAIN so patch_jumps can fill them all in later */
+static void
+emit_jump (compiler *c, opcode_t op, long *chain)
+{
+    emit (c, op);
+    emit (c, *chain);
+    *chain = c->len - 1;
+}
+
+static void
+patch_jumps (compiler *c, long chain)
+{
+    long next;
+    for (; chain >= 0; chain = next)
+    {
+        next = c->ops[chain];
+        c->ops[chain] = c->len;
+    }
+}
+
+/* Emits OP for the global VAR, with an empty inline cache */
+static void
+emit_global (compiler *c, opcode_t op, object *var)
+{
+    emit (c, op);
+    emit (c, constant (c, var));
+    emit (c, 0);
+    emit (c, 0);
+    emit (c, 0);
+}
+
+/* An expression in tail position returns its value itself */
+static void
+finish (compiler *c, bool tail)
+{
+    if (tail)
+        emit (c, OP_RETURN);
+}
+
+/* Packs up the instructions and constants of C as a CODE object */
+static object*
+make_code (compiler *c, long frame_size)
+{
+    object *code, *l;
+    long i;
+
+    code = alloc_slotted (CODE, c->nconsts + c->len);
+    code->data.code.nconsts = c->nconsts;
+    code->data.code.frame_size = frame_size;
+    for (i = c->nconsts - 1, l = c->consts; i >= 0; i--, l = cdr (l))
+        object_slots (code)[i] = car (l);
+    memcpy (code_ops (code), c->ops, c->len * sizeof *c->ops);
+    free (c->ops);
+    return code;
+}
+
+static void
+compile_sequence (compiler *c, object *exps, object *scope, bool tail)
+{
+    if (type_of (exps) != PAIR)
+    {
+        emit (c, OP_CONST);
+        emit (c, constant (c, ok));
+        finish (c, tail);
+        return;
+    }
+    for (; type_of (cdr (exps)) == PAIR; exps = cdr (exps))
+    {
+        compile_exp (c, car (exps), scope, false);
+        emit (c, OP_POP);
+    }
+    compile_exp (c, car (exps), scope, tail);
+}
+
+/* Compiles BODY in SCOPE, whose innermost frame is the one it runs in,
+ * first boxing the variables of that frame that live in boxes */
+static void
+compile_body (compiler *c, object *body, object *scope, bool tail)
+{
+    object *vars;
+    long i;
+    for (i = 0, vars = car (scope); type_of (vars) == PAIR;
+            i++, vars = cdr (vars))
+        if (type_of (car (vars)) == PAIR)
+        {
+            emit (c, OP_BOX);
+            emit (c, i);
+        }
+    compile_sequence (c, body, scope, tail);
+}
+
+/* Compiles the body of the lambda EXP, with a frame slot for each of its
+ * parameters and internal defines, and emits the CLOSURE that makes it
+ * into a procedure with a record of its free variables in SCOPE
+ */
+static void
+compile_lambda (compiler *c, object *exp, object *scope)
+{
+    compiler body = {NULL, 0, 0, NULL, 0};
+    object *vars = NULL, *free = NULL, *code;
+    long depth, index, size;
+    size_t roots = gc_save_roots ();
+
+    body.consts = nil;
+    gc_root (&exp);
+    gc_root (&scope);
+    gc_root (&vars);
+    gc_root (&free);
+    gc_root (&body.consts);
+    free = free_variables (exp, scope);
+    vars = internal_defines (cddr (exp), cadr (exp));
+    size = list_length (vars);
+    vars = box_variables (vars, cddr (exp));
+    vars = cons (vars, cons (free, nil));
+    compile_body (&body, cddr (exp), vars, true);
+    code = make_code (&body, size);
+    emit (c, OP_CLOSURE);
+    emit (c, constant (c, code));
+    emit (c, list_length (free));
+    for (; type_of (free) == PAIR; free = cdr (free))
+    {
+        find_local (type_of (car (free)) == PAIR ? caar (free) : car (free),
+                    scope, &depth, &index);
+        emit (c, depth);
+        emit (c, index);
+    }
+    gc_restore_roots (roots);
+}
+
+/* Store to VAR: a frame slot if it is local, else the global OP */
+static void
+compile_assignment (compiler *c, object *var, object *value, object *scope,
+                    opcode_t op, bool tail)
+{
+    object *entry;
+    long depth, index;
+
+    compile_exp (c, value, scope, false);
+    entry = scope_entry (var, scope, &depth, &index);
+    if (entry != NULL)
+    {
+        emit (c, type_of (entry) == PAIR ? OP_SET_BOX : OP_SET_LOCAL);
+        emit (c, depth);
+        emit (c, index);
+    }
+    else
+    {
+        emit (c, op);
+        emit (c, constant (c, var));
+    }
+    finish (c, tail);
+}
+
+/* The fixnum operation a call of the global VAR with two arguments is open
+ * coded as, or OP_CALL if there is none */
+static opcode_t
+open_coded (object *var)
+{
+    if (var == make_symbol ("+"))
+        return OP_ADD;
+    if (var == make_symbol ("-"))
+        return OP_SUB;
+    if (var == make_symbol ("*"))
+        return OP_MUL;
+    if (var == make_symbol ("quotient"))
+        return OP_QUOTIENT;
+    if (var == make_symbol ("remainder"))
+        return OP_REMAINDER;
+    if (var == make_symbol ("="))
+        return OP_NUM_EQ;
+    if (var == make_symbol ("<"))
+        return OP_LT;
+    if (var == make_symbol (">"))
+        return OP_GT;
+    return OP_CALL;
+}
+
+/* The key is looked up in the case_dispatch of the datums, and CASE jumps
+ * through the table of clause offsets that follows it. The last entry is
+ * for the else clause, or for no clause at all
+ */
+static void
+compile_case (compiler *c, object *exp, object *scope, bool tail)
+{
+    object *clauses, *dispatch;
+    long i, table, n = list_length (cddr (exp)), end = -1;
+    bool otherwise = false;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&exp);
+    gc_root (&scope);
+    compile_exp (c, cadr (exp), scope, false);
+    dispatch = case_dispatch (cddr (exp));
+    emit (c, OP_CASE);
+    emit (c, constant (c, dispatch));
+    emit (c, n);
+    table = c->len;
+    for (i = 0; i <= n; i++)
+        emit (c, 0);
+    for (i = 0, clauses = cddr (exp); type_of (clauses) == PAIR;
+            i++, clauses = cdr (clauses))
+    {
+        if (caar (clauses) == make_symbol ("else"))
+        {
+            otherwise = true;
+            c->ops[table + n] = c->len;
+        }
+        c->ops[table + i] = c->len;
+        compile_sequence (c, cdar (clauses), scope, tail);
+        if (!tail)
+            emit_jump (c, OP_JUMP, &end);
+    }
+    if (!otherwise)
+    {
+        c->ops[table + n] = c->len;
+        emit (c, OP_CONST);
+        emit (c, constant (c, ok));
+        finish (c, tail);
+    }
+    patch_jumps (c, end);
+    gc_restore_roots (roots);
+}
+
+/* A let pushes its inits and ENTERs a frame with them for BODY, which LEAVEs
+ * it again unless it is in tail position. Calls of the loop NAME (if not
+ * NULL) in the body jump back to its start. A plain let without any
+ * variables needs no frame
+ */
+static void
+compile_let (compiler *c, object *name, object *bindings, object *body,
+             object *scope, bool tail)
+{
+    object *vars = NULL, *inits = NULL, *loops = named_loops;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&bindings);
+    gc_root (&body);
+    gc_root (&scope);
+    gc_root (&vars);
+    gc_root (&inits);
+    vars = let_variables (bindings);
+    vars = internal_defines (body, vars);
+    if (vars == nil && name == NULL)
+    {
+        compile_sequence (c, body, scope, tail);
+        gc_restore_roots (roots);
+        return;
+    }
+    for (inits = let_inits (bindings); type_of (inits) == PAIR;
+            inits = cdr (inits))
+        compile_exp (c, car (inits), scope, false);
+    emit (c, OP_ENTER);
+    emit (c, list_length (bindings));
+    emit (c, list_length (vars));
+    vars = box_variables (vars, body);
+    scope = cons (vars, scope);
+    if (name != NULL)
+    {
+        gc_root (&named_loops);
+        named_loops = cons (cons (name, cons (scope, make_fixnum (c->len))),
+                            named_loops);
+    }
+    compile_body (c, body, scope, tail);
+    if (!tail)
+        emit (c, OP_LEAVE);
+    named_loops = loops;
+    gc_restore_roots (roots);
+}
+
+static void
+compile_application (compiler *c, object *exp, object *scope, bool tail)
+{
+    object *operands, *target;
+    long depth, index, argc = list_length (cdr (exp));
+    opcode_t op = OP_CALL;
+
+    /* a call of a loop never returns here, there is nothing to finish */
+    target = find_loop (car (exp), named_loops, scope, &depth);
+    if (target != NULL)
+    {
+        for (operands = cdr (exp); type_of (operands) == PAIR;
+                operands = cdr (operands))
+            compile_exp (c, car (operands), scope, false);
+        emit (c, OP_LOOP);
+        emit (c, depth);
+        emit (c, argc);
+        emit (c, fixnum_value (target));
+        return;
+    }
+    if (type_of (car (exp)) == SYMBOL && argc == 2
+            && !find_local (car (exp), scope, &depth, &index))
+        op = open_coded (car (exp));
+    if (op != OP_CALL)
+    {
+        compile_exp (c, cadr (exp), scope, false);
+        compile_exp (c, caddr (exp), scope, false);
+        emit_global (c, op, car (exp));
+        finish (c, tail);
+        return;
+    }
+    compile_exp (c, car (exp), scope, false);
+    for (operands = cdr (exp); type_of (operands) == PAIR;
+            operands = cdr (operands))
+        compile_exp (c, car (operands), scope, false);
+    emit (c, tail ? OP_TAIL_CALL : OP_CALL);
+    emit (c, argc);
+}
+
+/* Compiles EXP, leaving its value on the stack (or returning it if it is in
+ * TAIL position). SCOPE lists the variables of each enclosing lambda,
+ * innermost first, as for analyze
+ */
+static void
+compile_exp (compiler *c, object *exp, object *scope, bool tail)
+{
+    object *value = NULL;
+    long depth, index, chain = -1, end = -1;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&exp);
+    gc_root (&scope);
+    gc_root (&value);
+    if (is_self_evaluating (exp))
+    {
+        emit (c, OP_CONST);
+        emit (c, constant (c, exp));
+        finish (c, tail);
+    }
+    else if (type_of (exp) == SYMBOL)
+    {
+        value = scope_entry (exp, scope, &depth, &index);
+        if (value == NULL)
+        {
+            emit_global (c, OP_GLOBAL_REF, exp);
+        }
+        else if (type_of (value) == PAIR)
+        {
+            emit (c, OP_BOX_REF);
+            emit (c, depth);
+            emit (c, index);
+        }
+        else if (depth == 0)
+        {
+            emit (c, OP_LOCAL_REF0);
+            emit (c, index);
+        }
+        else
+        {
+            emit (c, OP_LOCAL_REF);
+            emit (c, depth);
+            emit (c, index);
+        }
+        finish (c, tail);
+    }
+    else if (type_of (exp) != PAIR)
+    {
+        fprintf (stderr, "expression has unknown type");
+        exit (1);
+    }
+    else switch (special_form (car (exp)))
+    {
+    case QUOTE_FORM:
+        emit (c, OP_CONST);
+        emit (c, constant (c, cadr (exp)));
+        finish (c, tail);
+        break;
+    case SET_FORM:
+        compile_assignment (c, cadr (exp), caddr (exp), scope, OP_SET_GLOBAL,
+                            tail);
+        break;
+    case DEFINE_FORM:
+        if (type_of (cadr (exp)) == PAIR)
+        {
+            value = cons (lambda, cons (cdadr (exp), cddr (exp)));
+            compile_assignment (c, caadr (exp), value, scope,
+                                OP_DEFINE_GLOBAL, tail);
+        }
+        else
+            compile_assignment (c, cadr (exp), caddr (exp), scope,
+                                OP_DEFINE_GLOBAL, tail);
+        break;
+    case BEGIN_FORM:
+        compile_sequence (c, begin_actions (exp), scope, tail);
+        break;
+    case IF_FORM:
+        compile_exp (c, cadr (exp), scope, false);
+        emit_jump (c, OP_JUMP_IF_FALSE, &chain);
+        compile_exp (c, caddr (exp), scope, tail);
+        if (!tail)
+            emit_jump (c, OP_JUMP, &end);
+        patch_jumps (c, chain);
+        if (type_of (cdddr (exp)) == NIL)
+        {
+            emit (c, OP_CONST);
+            emit (c, constant (c, f));
+            finish (c, tail);
+        }
+        else
+            compile_exp (c, cadddr (exp), scope, tail);
+        patch_jumps (c, end);
+        break;
+    /* and stops at the first #f and or at the first #t, leaving it as the
+     * value. The jumps all land after the last operand */
+    case AND_FORM:
+    case OR_FORM:
+        if (type_of (cdr (exp)) == NIL)
+        {
+            emit (c, OP_CONST);
+            value = special_form (car (exp)) == AND_FORM ? t : f;
+            emit (c, constant (c, value));
+            finish (c, tail);
+            break;
+        }
+        for (value = cdr (exp); type_of (cdr (value)) == PAIR;
+                value = cdr (value))
+        {
+            compile_exp (c, car (value), scope, false);
+            emit_jump (c, special_form (car (exp)) == AND_FORM ?
+                       OP_JUMP_IF_FALSE_OR_POP : OP_JUMP_IF_TRUE_OR_POP,
+                       &chain);
+        }
+        compile_exp (c, car (value), scope, tail);
+        patch_jumps (c, chain);
+        finish (c, tail);
+        break;
+    case LAMBDA_FORM:
+        compile_lambda (c, exp, scope);
+        finish (c, tail);
+        break;
+    case LET_FORM:
+        if (type_of (cadr (exp)) != SYMBOL)
+            compile_let (c, NULL, cadr (exp), cddr (exp), scope, tail);
+        else if (is_loop (exp))
+            compile_let (c, cadr (exp), caddr (exp), cdddr (exp), scope,
+                         tail);
+        else
+        {
+            value = expand_named_let (exp);
+            compile_exp (c, value, scope, tail);
+        }
+        break;
+    case CASE_FORM:
+        compile_case (c, exp, scope, tail);
+        break;
+    case LET_STAR_FORM:
+    case LETREC_FORM:
+    case DO_FORM:
+    case COND_FORM:
+        value = expand_derived (exp);
+        compile_exp (c, value, scope, tail);
+        break;
+    default:
+        compile_application (c, exp, scope, tail);
+        break;
+    }
+    gc_restore_roots (roots);
+}
+
+/* Compiles the toplevel expression EXP */
+object*
+compile (object *exp)
+{
+    compiler c = {NULL, 0, 0, NULL, 0};
+    size_t roots = gc_save_roots ();
+
+    c.consts = nil;
+    gc_root (&exp);
+    gc_root (&c.consts);
+    compile_exp (&c, exp, nil, true);
+    exp = make_code (&c, 0);
+    gc_restore_roots (roots);
+    return exp;
+}
+
+/* Returns the global named by constant PC[0] of CODE. PC[1] to PC[3] cache
+ * the toplevel and global_version it was last looked up at and its value.
+ * The value isn't traced from here, but it can only be used while its
+ * binding (which keeps it alive) is unchanged
+ */
+static inline object*
+cached_global (object *code, intptr_t *pc, object *env)
+{
+    object *top = toplevel_env (env);
+    if ((object *)pc[1] != top || (unsigned long)pc[2] != global_version)
+    {
+        pc[3] = (intptr_t)lookup_variable (object_slots (code)[pc[0]], top);
+        pc[1] = (intptr_t)top;
+        pc[2] = (intptr_t)global_version;
+    }
+    return (object *)pc[3];
+}
+
+/* Runs CODE in the environment ENV and returns its value. Everything on the
+ * argument stack is a root, so values are only pushed once they are complete
+ */
+object*
+vm_execute (object *code, object *env)
+{
+#ifdef VM_THREADED
+/* Labels as values are the GNU extension -pedantic warns about, so it is
+ * silenced from here to the end of the dispatch */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#define OPCODE_LABEL(op) &&op##_LABEL,
+    static void *const labels[] = { OPCODES (OPCODE_LABEL) };
+#define VM_CASE(op) op##_LABEL
+#define NEXT goto *labels[*pc++]
+#else
+#define VM_CASE(op) case op
+#define NEXT continue
+#endif
+    intptr_t *pc;
+    object **entry, **base, *proc, *val, *lambda, *frame;
+    object *(*fun) (long, object **);
+    long argc, i, n;
+    bool tail;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&code);
+    gc_root (&env);
+    entry = arg_top;
+    pc = code_ops (code);
+
+#ifdef VM_THREADED
+    NEXT;
+#else
+    for (;;)
+        switch (*pc++)
+        {
+#endif
+    VM_CASE (OP_CONST):
+        *arg_top++ = object_slots (code)[*pc++];
+        NEXT;
+    VM_CASE (OP_LOCAL_REF0):
+        val = frame_slots (env)[*pc++];
+        if (val == UNASSIGNED_OBJ)
+        {
+            fprintf (stderr, "Unbound variable, could not lookup\n");
+            exit (1);
+        }
+        *arg_top++ = val;
+        NEXT;
+    VM_CASE (OP_LOCAL_REF):
+        val = lookup_local (pc[0], pc[1], env);
+        pc += 2;
+        *arg_top++ = val;
+        NEXT;
+    VM_CASE (OP_GLOBAL_REF):
+        val = cached_global (code, pc, env);
+        pc += 4;
+        *arg_top++ = val;
+        NEXT;
+    VM_CASE (OP_SET_LOCAL):
+        set_local (pc[0], pc[1], arg_top[-1], env);
+        pc += 2;
+        arg_top[-1] = ok;
+        NEXT;
+    VM_CASE (OP_SET_GLOBAL):
+        set_variable (object_slots (code)[*pc++], arg_top[-1], env);
+        arg_top[-1] = ok;
+        NEXT;
+    VM_CASE (OP_DEFINE_GLOBAL):
+        define_variable (object_slots (code)[*pc++], arg_top[-1], env);
+        arg_top[-1] = ok;
+        NEXT;
+    VM_CASE (OP_BOX_REF):
+        val = car (*local_cell (pc[0], pc[1], env));
+        if (val == UNASSIGNED_OBJ)
+        {
+            fprintf (stderr, "Unbound variable, could not lookup\n");
+            exit (1);
+        }
+        pc += 2;
+        *arg_top++ = val;
+        NEXT;
+    VM_CASE (OP_SET_BOX):
+        set_car (*local_cell (pc[0], pc[1], env), arg_top[-1]);
+        pc += 2;
+        arg_top[-1] = ok;
+        NEXT;
+    VM_CASE (OP_BOX):
+        val = cons (frame_slots (env)[*pc], nil);
+        frame_slots (env)[*pc++] = val;
+        NEXT;
+    VM_CASE (OP_POP):
+        arg_top--;
+        NEXT;
+    VM_CASE (OP_JUMP):
+        pc = code_ops (code) + *pc;
+        NEXT;
+    VM_CASE (OP_JUMP_IF_FALSE):
+        if (*--arg_top == f)
+            pc = code_ops (code) + *pc;
+        else
+            pc++;
+        NEXT;
+    VM_CASE (OP_JUMP_IF_FALSE_OR_POP):
+        if (arg_top[-1] == f)
+            pc = code_ops (code) + *pc;
+        else
+        {
+            arg_top--;
+            pc++;
+        }
+        NEXT;
+    VM_CASE (OP_JUMP_IF_TRUE_OR_POP):
+        if (arg_top[-1] == t)
+            pc = code_ops (code) + *pc;
+        else
+        {
+            arg_top--;
+            pc++;
+        }
+        NEXT;
+    VM_CASE (OP_CLOSURE):
+        frame = toplevel_env (env);
+        n = pc[1];
+        if (n > 0)
+        {
+            frame = make_frame (n, frame);
+            for (i = 0; i < n; i++)
+                frame_slots (frame)[i] = *local_cell (pc[2 + 2 * i],
+                                                      pc[3 + 2 * i], env);
+        }
+        val = make_compound_proc (object_slots (code)[pc[0]], frame);
+        pc += 2 + 2 * n;
+        *arg_top++ = val;
+        NEXT;
+    VM_CASE (OP_CASE):
+        i = case_clause (object_slots (code)[pc[0]], *--arg_top);
+        pc = code_ops (code) + pc[2 + (i < 0 ? pc[1] : i)];
+        NEXT;
+    VM_CASE (OP_ENTER):
+        n = pc[0];
+        frame = make_frame (pc[1], env);
+        for (i = 0; i < n; i++)
+            frame_slots (frame)[i] = arg_top[i - n];
+        arg_top -= n;
+        env = frame;
+        pc += 2;
+        NEXT;
+    VM_CASE (OP_LEAVE):
+        env = enclosing_env (env);
+        NEXT;
+    VM_CASE (OP_LOOP):
+        for (frame = env, i = pc[0]; i > 0; i--)
+            frame = enclosing_env (frame);
+        n = pc[1];
+        for (i = 0; i < n; i++)
+            frame_slots (frame)[i] = arg_top[i - n];
+        arg_top -= n;
+        env = frame;
+        pc = code_ops (code) + pc[2];
+        NEXT;
+    VM_CASE (OP_CALL):
+        argc = *pc++;
+        tail = false;
+        goto call;
+    VM_CASE (OP_TAIL_CALL):
+        argc = *pc++;
+        tail = true;
+        goto call;
+    VM_CASE (OP_RETURN):
+    do_return:
+        val = arg_top[-1];
+        if (arg_top - 1 == entry)
+        {
+            arg_top = entry;
+            gc_restore_roots (roots);
+            return val;
+        }
+        code = arg_top[-4];
+        pc = code_ops (code) + fixnum_value (arg_top[-3]);
+        env = arg_top[-2];
+        arg_top -= 4;
+        *arg_top++ = val;
+        NEXT;
+
+    /* The open coded fixnum operations. If an operand isn't a fixnum, the
+     * result overflows or the operator has been redefined, they turn into an
+     * ordinary call */
+    VM_CASE (OP_ADD):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || !is_primitive (proc, add_proc))
+            goto arith_call;
+        n = fixnum_value (arg_top[-2]) + fixnum_value (arg_top[-1]);
+        if (!fixnum_fits (n))
+            goto arith_call;
+        arg_top[-2] = make_fixnum (n);
+        arg_top--;
+        NEXT;
+    VM_CASE (OP_SUB):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || !is_primitive (proc, sub_proc))
+            goto arith_call;
+        n = fixnum_value (arg_top[-2]) - fixnum_value (arg_top[-1]);
+        if (!fixnum_fits (n))
+            goto arith_call;
+        arg_top[-2] = make_fixnum (n);
+        arg_top--;
+        NEXT;
+    VM_CASE (OP_MUL):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || !is_primitive (proc, mul_proc)
+                || !fixnum_mul (fixnum_value (arg_top[-2]),
+                                fixnum_value (arg_top[-1]), &n))
+            goto arith_call;
+        arg_top[-2] = make_fixnum (n);
+        arg_top--;
+        NEXT;
+    /* division by zero is left to the library procedure */
+    VM_CASE (OP_QUOTIENT):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || arg_top[-1] == make_fixnum (0)
+                || !is_primitive (proc, quotient_proc))
+            goto arith_call;
+        n = fixnum_value (arg_top[-2]) / fixnum_value (arg_top[-1]);
+        if (!fixnum_fits (n))
+            goto arith_call;
+        arg_top[-2] = make_fixnum (n);
+        arg_top--;
+        NEXT;
+    VM_CASE (OP_REMAINDER):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || arg_top[-1] == make_fixnum (0)
+                || !is_primitive (proc, remainder_proc))
+            goto arith_call;
+        arg_top[-2] = make_fixnum (fixnum_value (arg_top[-2])
+                                   % fixnum_value (arg_top[-1]));
+        arg_top--;
+        NEXT;
+    VM_CASE (OP_NUM_EQ):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || !is_primitive (proc, is_number_equal_proc))
+            goto arith_call;
+        arg_top[-2] = arg_top[-2] == arg_top[-1] ? t : f;
+        arg_top--;
+        NEXT;
+    VM_CASE (OP_LT):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || !is_primitive (proc, is_less_than_proc))
+            goto arith_call;
+        arg_top[-2] = fixnum_value (arg_top[-2]) < fixnum_value (arg_top[-1])
+                      ? t : f;
+        arg_top--;
+        NEXT;
+    VM_CASE (OP_GT):
+        proc = cached_global (code, pc, env);
+        pc += 4;
+        if (!is_fixnum (arg_top[-2]) || !is_fixnum (arg_top[-1])
+                || !is_primitive (proc, is_greater_than_proc))
+            goto arith_call;
+        arg_top[-2] = fixnum_value (arg_top[-2]) > fixnum_value (arg_top[-1])
+                      ? t : f;
+        arg_top--;
+        NEXT;
+    arith_call:
+        arg_top[0] = arg_top[-1];
+        arg_top[-1] = arg_top[-2];
+        arg_top[-2] = proc;
+        arg_top++;
+        argc = 2;
+        tail = false;
+        goto call;
+
+    /* Calls the procedure below the ARGC arguments on the top of the stack.
+     * A compound procedure gets a new frame and, unless this is a TAIL call,
+     * the caller's code, pc and environment are saved where the procedure
+     * and arguments were
+     */
+    call:
+        base = arg_top - argc - 1;
+        proc = *base;
+        if (type_of (proc) == COMPOUND_PROC)
+        {
+            lambda = proc->data.compound_proc.lambda;
+            frame = make_frame (lambda->data.code.frame_size,
+                                proc->data.compound_proc.env);
+            for (i = 0; i < argc && i < lambda->data.code.frame_size; i++)
+                frame_slots (frame)[i] = base[i + 1];
+            arg_top = base;
+            if (!tail)
+            {
+                if (arg_top > arg_stack + ARG_STACK_LEN - VM_STACK_SLACK)
+                    arg_stack_overflow ();
+                arg_top[0] = code;
+                arg_top[1] = make_fixnum (pc - code_ops (code));
+                arg_top[2] = env;
+                arg_top += 3;
+            }
+            code = lambda;
+            env = frame;
+            pc = code_ops (code);
+            NEXT;
+        }
+        if (type_of (proc) != PRIM_PROC)
+        {
+            arg_top = base;
+            *arg_top++ = ok;
+            if (tail)
+                goto do_return;
+            NEXT;
+        }
+        fun = proc->data.prim_proc.fun;
+        /* (apply f a ... list) calls f with the a's and the elements of
+         * list, spread out on the stack in place of apply's arguments */
+        if (fun == apply_proc)
+        {
+            check_arity (proc, argc);
+            val = base[argc];
+            for (i = 0; i < argc; i++)
+                base[i] = base[i + 1];
+            arg_top = base + argc - 1;
+            for (argc -= 2; type_of (val) == PAIR; val = cdr (val), argc++)
+            {
+                if (arg_top >= arg_stack + ARG_STACK_LEN - VM_STACK_SLACK)
+                    arg_stack_overflow ();
+                *arg_top++ = car (val);
+            }
+            goto call;
+        }
+        /* (eval exp env) compiles exp and runs it like a procedure body in
+         * env */
+        if (fun == eval_proc)
+        {
+            check_arity (proc, argc);
+            val = compile (base[1]);
+            frame = base[2];
+            arg_top = base;
+            if (!tail)
+            {
+                if (arg_top > arg_stack + ARG_STACK_LEN - VM_STACK_SLACK)
+                    arg_stack_overflow ();
+                arg_top[0] = code;
+                arg_top[1] = make_fixnum (pc - code_ops (code));
+                arg_top[2] = env;
+                arg_top += 3;
+            }
+            code = val;
+            env = frame;
+            pc = code_ops (code);
+            NEXT;
+        }
+        val = apply_primitive (proc, argc, base + 1);
+        arg_top = base;
+        *arg_top++ = val;
+        if (tail)
+            goto do_return;
+        NEXT;
+#ifndef VM_THREADED
+        }
+#else
+#pragma GCC diagnostic pop
+#endif
+#undef VM_CASE
+#undef NEXT
+}
+
+/* Evaluates EXP in the toplevel environment ENV by compiling it to bytecode
+ * and running that */
+object*
+vm_eval (object *exp, object *env)
+{
+    object *code;
+    size_t roots = gc_save_roots ();
+
+    gc_root (&env);
+    code = compile (exp);
+    code = vm_execute (code, env);
+    gc_restore_roots (roots);
+    return code;
+}